@@ -1,10 +1,16 @@
-from . import (
-    api,  # noqa: F401
-    client,  # noqa: F401
-    mcu,  # noqa: F401
-)
+import importlib
 
 try:
     from speculos.__version__ import __version__
 except ImportError:
     __version__ = "unknown version"
+
+# Subpackages pull heavy dependencies (Flask, PIL...): only import them on first access, so that running the emulator
+# doesn't pay for what it doesn't use.
+__all__ = ["api", "client", "mcu"]
+
+
+def __getattr__(name: str):
+    if name in __all__:
+        return importlib.import_module(f".{name}", __name__)
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
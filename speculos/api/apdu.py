@@ -1,6 +1,6 @@
 import json
 import threading
-from collections.abc import Generator
+from collections.abc import Generator, Iterable
 
 import jsonschema
 from flask import Response, request, stream_with_context
@@ -10,34 +10,94 @@ from speculos.resources_importer import get_resource_schema_as_json
 from ..mcu.seproxyhal import SeProxyHal
 from .restful import SephResource
 
+DEFAULT_TICK_TIMEOUT = 5 * 60 * 10
+
 
 class APDUBridge:
     def __init__(self, seph: SeProxyHal):
         # We want to be notified when APDU response is transmitted from the SE
-        self.endpoint_lock = threading.Lock()
         self.response_condition = threading.Condition()
         self._seph = seph
         self._seph.apdu_callbacks.append(self.seph_apdu_callback)
         self.response: bytes | None
 
-    def exchange(self, data: bytes, tick_timeout: int = 5 * 60 * 10) -> Generator[bytes, None, None]:
+    def _transmit(self, data: bytes, tick_timeout: int) -> bytes:
+        """
+        Send one APDU to the app and wait for its response. The caller must
+        hold the APDU arbiter of seph, shared with the TCP APDU server.
+        """
+
+        tick_count_before_exchange = self._seph.get_tick_count()
+
+        with self.response_condition:
+            self.response = None
+        self._seph.to_app(data)
+        with self.response_condition:
+            while self.response is None:
+                self.response_condition.wait(0.1)
+                exchange_tick_count = self._seph.get_tick_count() - tick_count_before_exchange
+
+                if tick_timeout != 0 and exchange_tick_count > tick_timeout:
+                    raise TimeoutError()
+            return self.response
+
+    def transmit(self, data: bytes, tick_timeout: int = DEFAULT_TICK_TIMEOUT) -> bytes:
+        """Send one APDU to the app and return its response."""
+
+        with self._seph.apdu_arbiter.exclusive():  # For a command/response of one client
+            return self._transmit(data, tick_timeout)
+
+    def exchange(self, data: bytes, tick_timeout: int = DEFAULT_TICK_TIMEOUT) -> Generator[bytes, None, None]:
         # force headers to be sent
         yield b""
 
-        tick_count_before_exchange = self._seph.get_tick_count()
+        response = self.transmit(data, tick_timeout)
+        yield json.dumps({"data": response.hex()}).encode()
+
+    def exchange_batch(
+        self,
+        apdus: Iterable[tuple[bytes, list[int] | None]],
+        stop_on_error: bool = True,
+        tick_timeout: int = DEFAULT_TICK_TIMEOUT,
+    ) -> Generator[bytes, None, None]:
+        """
+        Send the APDUs back to back and stream one JSON line per response.
 
-        with self.endpoint_lock:  # Lock for a command/response for one client
-            with self.response_condition:
-                self.response = None
-            self._seph.to_app(data)
-            with self.response_condition:
-                while self.response is None:
-                    self.response_condition.wait(0.1)
-                    exchange_tick_count = self._seph.get_tick_count() - tick_count_before_exchange
+        Each APDU comes with an optional list of expected status words. A
+        response whose status word isn't in that list is an error, which ends
+        the batch if stop_on_error is set. The app is held for the whole batch
+        so that no other client can interleave its APDUs.
+        """
+
+        # force headers to be sent
+        yield b""
 
-                    if tick_timeout != 0 and exchange_tick_count > tick_timeout:
-                        raise TimeoutError()
-            yield json.dumps({"data": self.response.hex()}).encode()
+        count = 0
+        errors = 0
+        with self._seph.apdu_arbiter.exclusive():
+            for index, (data, expected_sw) in enumerate(apdus):
+                try:
+                    response = self._transmit(data, tick_timeout)
+                except TimeoutError:
+                    yield self._batch_line({"index": index, "error": "timeout"})
+                    errors += 1
+                    break
+
+                count += 1
+                sw = int.from_bytes(response[-2:], "big") if len(response) >= 2 else None
+                ok = expected_sw is None or sw in expected_sw
+                line = {"index": index, "data": response.hex(), "sw": None if sw is None else f"{sw:04x}", "ok": ok}
+                yield self._batch_line(line)
+                if not ok:
+                    errors += 1
+                    if stop_on_error:
+                        break
+
+        yield self._batch_line({"done": True, "count": count, "errors": errors})
+
+    @staticmethod
+    def _batch_line(obj: dict) -> bytes:
+        return json.dumps(obj).encode() + b"\n"
 
     def seph_apdu_callback(self, data: bytes) -> None:
         """
@@ -49,12 +109,16 @@ class APDUBridge:
             self.response_condition.notify()
 
 
-class APDU(SephResource):
-    schema = get_resource_schema_as_json("api", "apdu.schema")
-
-    def __init__(self, *args, **kwargs):
+class BridgeResource(SephResource):
+    def __init__(self, *args, bridge: APDUBridge | None = None, **kwargs):
+        if bridge is None:
+            raise RuntimeError("Argument 'bridge' must not be None")
         super().__init__(*args, **kwargs)
-        self._bridge = APDUBridge(self.seph)
+        self._bridge = bridge
+
+
+class APDU(BridgeResource):
+    schema = get_resource_schema_as_json("api", "apdu.schema")
 
     def post(self):
         args = request.get_json(force=True)
@@ -76,3 +140,33 @@ class APDU(SephResource):
             stream_with_context(self._bridge.exchange(data)),
             content_type="application/json",
         )
+
+
+class APDUs(BridgeResource):
+    schema = get_resource_schema_as_json("api", "apdus.schema")
+
+    def post(self):
+        args = request.get_json(force=True)
+        try:
+            jsonschema.validate(instance=args, schema=self.schema)
+        except jsonschema.exceptions.ValidationError as e:
+            return {"error": f"{e}"}, 400
+
+        default_sw = args.get("expected_sw")
+        apdus = []
+        for apdu in args["apdus"]:
+            expected_sw = apdu.get("expected_sw", default_sw)
+            if expected_sw is not None:
+                expected_sw = [int(sw, 16) for sw in expected_sw]
+            apdus.append((bytes.fromhex(apdu["data"]), expected_sw))
+
+        return Response(
+            stream_with_context(
+                self._bridge.exchange_batch(
+                    apdus,
+                    stop_on_error=args.get("stop_on_error", True),
+                    tick_timeout=args.get("tick_timeout", DEFAULT_TICK_TIMEOUT),
+                )
+            ),
+            content_type="application/x-ndjson",
+        )
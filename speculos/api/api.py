@@ -13,11 +13,13 @@ from speculos.mcu.seproxyhal import SeProxyHal
 from speculos.observer import BroadcastInterface
 from speculos.resources_importer import resources
 
-from .apdu import APDU
+from .apdu import APDU, APDUBridge, APDUs
 from .automation import Automation
 from .button import Button
+from .channel import Channel
 from .events import Events
 from .finger import Finger
+from .screen import GoldenImages, ScreenCompare, ScreenObserver, ScreenObservers, ScreenStream, ScreenWait
 from .screenshot import Screenshot
 from .swagger import Swagger
 from .ticker import Ticker
@@ -77,6 +79,8 @@ class ApiWrapper:
 
         screen_kwargs = {"screen": screen}
         seph_kwargs = {"seph": seph}
+        # A single bridge serializes the exchanges of /apdu and /apdus
+        apdu_kwargs = {**seph_kwargs, "bridge": APDUBridge(seph)}
         app_kwargs = {"app": self._app}
         event_kwargs: dict[str, Any] = {
             **app_kwargs,
@@ -85,7 +89,8 @@ class ApiWrapper:
 
         self._api = Api(self._app)
 
-        self._api.add_resource(APDU, "/apdu", resource_class_kwargs=seph_kwargs)
+        self._api.add_resource(APDU, "/apdu", resource_class_kwargs=apdu_kwargs)
+        self._api.add_resource(APDUs, "/apdus", resource_class_kwargs=apdu_kwargs)
         self._api.add_resource(Automation, "/automation", resource_class_kwargs=seph_kwargs)
         self._api.add_resource(
             Button,
@@ -95,7 +100,21 @@ class ApiWrapper:
             resource_class_kwargs=seph_kwargs,
         )
         self._api.add_resource(Events, "/events", resource_class_kwargs=event_kwargs)
+        self._api.add_resource(
+            Channel,
+            "/ws",
+            resource_class_kwargs={**apdu_kwargs, "automation_server": automation_server},
+        )
         self._api.add_resource(Finger, "/finger", resource_class_kwargs=seph_kwargs)
+        self._api.add_resource(
+            ScreenCompare,
+            "/screen/compare",
+            resource_class_kwargs={**screen_kwargs, "golden_images": GoldenImages()},
+        )
+        self._api.add_resource(ScreenObservers, "/screen/observers", resource_class_kwargs=screen_kwargs)
+        self._api.add_resource(ScreenObserver, "/screen/observers/<int:observer>", resource_class_kwargs=screen_kwargs)
+        self._api.add_resource(ScreenStream, "/screen/stream", resource_class_kwargs=screen_kwargs)
+        self._api.add_resource(ScreenWait, "/screen/wait", resource_class_kwargs=screen_kwargs)
         self._api.add_resource(Screenshot, "/screenshot", resource_class_kwargs=screen_kwargs)
         self._api.add_resource(Swagger, "/swagger/", resource_class_kwargs=app_kwargs)
         self._api.add_resource(WebInterface, "/", resource_class_kwargs=app_kwargs)
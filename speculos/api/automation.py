@@ -1,4 +1,5 @@
 import json
+import re
 
 import jsonschema
 from flask import request
@@ -25,7 +26,10 @@ class Automation(SephResource):
             return "invalid document", 400
         except jsonschema.exceptions.ValidationError:
             return "invalid document", 400
+        except re.error:
+            return "invalid regexp", 400
 
+        # The rules are compiled above, swapping them doesn't pause the app
         self.seph.automation = rules
 
         return {}, 200
@@ -3,8 +3,27 @@ from flask import request
 
 from speculos.resources_importer import get_resource_schema_as_json
 
+from ..mcu.seproxyhal import SeProxyHal
 from .restful import SephResource
 
+BUTTONS = {"left": [1], "right": [2], "both": [1, 2]}
+
+
+def button_action(seph: SeProxyHal, buttons: list[int], action: str, delay: float = 0.1) -> None:
+    if action == "press-and-release":
+        for b in buttons:
+            seph.handle_button(b, True)
+        seph.handle_wait(delay)
+        for b in buttons:
+            seph.handle_button(b, False)
+        # Some app tests rely on this delay to make sure the screen is updated
+        # and the app is ready to process next button press.
+        # This is dangerous but we keep it as is to not break everything.
+        seph.handle_wait(delay)
+    else:
+        for b in buttons:
+            seph.handle_button(b, action == "press")
+
 
 class Button(SephResource):
     schema = get_resource_schema_as_json("api", "button.schema")
@@ -17,22 +36,6 @@ class Button(SephResource):
             return {"error": f"{e}"}, 400
 
         button = request.base_url.split("/")[-1]
-        buttons = {"left": [1], "right": [2], "both": [1, 2]}
-        action = args["action"]
-        delay = args.get("delay", 0.1)
-
-        if action == "press-and-release":
-            for b in buttons[button]:
-                self.seph.handle_button(b, True)
-            self.seph.handle_wait(delay)
-            for b in buttons[button]:
-                self.seph.handle_button(b, False)
-            # Some app tests rely on this delay to make sure the screen is updated
-            # and the app is ready to process next button press.
-            # This is dangerous but we keep it as is to not break everything.
-            self.seph.handle_wait(delay)
-        else:
-            for b in buttons[button]:
-                self.seph.handle_button(b, action == "press")
+        button_action(self.seph, BUTTONS[button], args["action"], args.get("delay", 0.1))
 
         return {}, 200
@@ -0,0 +1,162 @@
+import logging
+import queue
+import struct
+import threading
+from concurrent.futures import ThreadPoolExecutor
+
+from flask import Response, request
+
+from speculos.observer import ObserverInterface, TextEvent
+from speculos.websocket import (
+    APDU_HEADER,
+    BUTTON_PAYLOAD,
+    CHANNEL_ACTIONS,
+    CLOSE_UNSUPPORTED_DATA,
+    FINGER_PAYLOAD,
+    OP_BINARY,
+    ChannelMessage,
+    ProtocolError,
+    WebSocket,
+    encode_text_event,
+    handshake_response,
+)
+
+from ..mcu.seproxyhal import SeProxyHal
+from .apdu import APDUBridge, BridgeResource
+from .button import button_action
+from .events import EventsBroadcaster
+from .finger import finger_action
+
+logger = logging.getLogger("channel")
+
+
+class ConnectionUpgraded(Response):
+    """
+    Returned once the WebSocket is closed: the connection was taken over by
+    the WebSocket and must not be used by the HTTP server anymore.
+    """
+
+    def __call__(self, environ, start_response):
+        # The werkzeug development server silently drops the connection
+        raise ConnectionError("WebSocket closed")
+
+
+class ChannelSession(ObserverInterface):
+    """
+    Serve one WebSocket client: requests are read and handled in the request
+    thread, while messages are sent from a dedicated writer thread so that
+    slow clients never block the thread that broadcasts the events.
+
+    APDUs are exchanged from a worker thread, so that buttons can be pressed
+    while the app waits for a user approval before answering.
+    """
+
+    def __init__(self, ws: WebSocket, seph: SeProxyHal, bridge: APDUBridge) -> None:
+        self._ws = ws
+        self._seph = seph
+        self._bridge = bridge
+        self._outgoing: queue.SimpleQueue[bytes | None] = queue.SimpleQueue()
+        self._apdu_worker = ThreadPoolExecutor(max_workers=1, thread_name_prefix="channel-apdu")
+
+    def send_screen_event(self, event: TextEvent) -> None:
+        if event.clear:
+            self._outgoing.put(bytes([ChannelMessage.SCREEN_CHANGE]))
+        else:
+            self._outgoing.put(encode_text_event(event))
+
+    def _send_error(self, message_type: int, message: str) -> None:
+        self._outgoing.put(bytes([ChannelMessage.ERROR, message_type]) + message.encode())
+
+    def _writer(self) -> None:
+        while True:
+            message = self._outgoing.get()
+            if message is None:
+                break
+            try:
+                self._ws.send(message)
+            except OSError:
+                break
+
+    def _exchange_apdu(self, tick_timeout: int, data: bytes) -> None:
+        try:
+            response = self._bridge.transmit(data, tick_timeout)
+        except TimeoutError:
+            self._send_error(ChannelMessage.APDU, "timeout")
+        else:
+            self._outgoing.put(bytes([ChannelMessage.APDU]) + response)
+
+    def _handle(self, message: bytes) -> None:
+        message_type, payload = message[0], message[1:]
+        try:
+            if message_type == ChannelMessage.APDU:
+                (tick_timeout,) = APDU_HEADER.unpack_from(payload)
+                data = payload[APDU_HEADER.size :]
+                if not data:
+                    raise ValueError("empty APDU")
+                self._apdu_worker.submit(self._exchange_apdu, tick_timeout, data)
+            elif message_type == ChannelMessage.BUTTON:
+                mask, action, delay = BUTTON_PAYLOAD.unpack(payload)
+                buttons = [b for b in (1, 2) if mask & b]
+                if not buttons:
+                    raise ValueError("no button")
+                button_action(self._seph, buttons, CHANNEL_ACTIONS[action], delay / 1000)
+                self._outgoing.put(bytes([message_type]))
+            elif message_type == ChannelMessage.FINGER:
+                x, y, action, delay, x2, y2 = FINGER_PAYLOAD.unpack(payload)
+                finger_action(self._seph, x, y, CHANNEL_ACTIONS[action], delay / 1000, x2, y2)
+                self._outgoing.put(bytes([message_type]))
+            else:
+                self._send_error(message_type, "unknown message type")
+        except (struct.error, KeyError, ValueError) as e:
+            self._send_error(message_type, f"invalid request: {e}")
+
+    def run(self) -> None:
+        writer = threading.Thread(target=self._writer, name="channel-writer", daemon=True)
+        writer.start()
+        try:
+            while True:
+                message = self._ws.recv()
+                if message is None:
+                    break
+                opcode, payload = message
+                if opcode != OP_BINARY or not payload:
+                    raise ProtocolError("only non-empty binary messages are supported", CLOSE_UNSUPPORTED_DATA)
+                self._handle(payload)
+        except ProtocolError as e:
+            logger.warning("closing channel: %s", e)
+            self._ws.close(e.code)
+        except OSError:
+            pass
+        finally:
+            self._apdu_worker.shutdown(wait=True, cancel_futures=True)
+            self._outgoing.put(None)
+            writer.join()
+            self._ws.close()
+
+
+class Channel(BridgeResource):
+    def __init__(self, *args, automation_server: EventsBroadcaster | None = None, **kwargs) -> None:
+        if automation_server is None:
+            raise RuntimeError("Argument 'automation_server' must not be None")
+        self._broadcaster = automation_server
+        super().__init__(*args, **kwargs)
+
+    def get(self):
+        key = request.headers.get("Sec-WebSocket-Key")
+        if request.headers.get("Upgrade", "").lower() != "websocket" or key is None:
+            return {"error": "expected a WebSocket upgrade request"}, 400
+        if request.headers.get("Sec-WebSocket-Version") != "13":
+            return {"error": "unsupported WebSocket version"}, 426, {"Sec-WebSocket-Version": "13"}
+
+        sock = request.environ.get("werkzeug.socket")
+        if sock is None:
+            return {"error": "WebSocket isn't supported by this server"}, 500
+
+        sock.sendall(handshake_response(key))
+        session = ChannelSession(WebSocket(sock, client=False), self.seph, self._bridge)
+        self._broadcaster.add_client(session)
+        try:
+            session.run()
+        finally:
+            self._broadcaster.remove_client(session)
+        return ConnectionUpgraded()
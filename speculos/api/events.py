@@ -1,70 +1,170 @@
 import json
 import logging
+import re
 import threading
+import time
+from collections import deque
 from collections.abc import Generator
-from dataclasses import asdict
+from dataclasses import asdict, dataclass
+from itertools import islice
 
 from flask import Response, stream_with_context
 from flask_restful import inputs, reqparse
 
-from speculos.observer import BroadcastInterface, ObserverInterface, TextEvent
+from speculos.observer import BroadcastInterface, TextEvent
 
 from .restful import AppResource
 
+# Number of events kept in the log. Older events are dropped.
+EVENT_LOG_SIZE = 4096
+
+
+@dataclass
+class EventFilter:
+    """Server-side filter: the events must match every criterion which is set."""
+
+    text: str | None = None
+    regexp: re.Pattern | None = None
+    # x, y, w, h: the position of the event must be within this rectangle
+    region: tuple[int, int, int, int] | None = None
+
+    def match(self, event: TextEvent) -> bool:
+        if self.text is not None and event.text != self.text:
+            return False
+        if self.regexp is not None and not self.regexp.search(event.text):
+            return False
+        if self.region is not None:
+            x, y, w, h = self.region
+            if not (x <= event.x < x + w and y <= event.y < y + h):
+                return False
+        return True
+
+
+def region(value: str) -> tuple[int, int, int, int]:
+    """Parse a region given as 'x,y,w,h'."""
+
+    values = tuple(int(v) for v in value.split(","))
+    if len(values) != 4:
+        raise ValueError("expected x,y,w,h")
+    return values  # type: ignore[return-value]
+
 
 class EventsBroadcaster(BroadcastInterface):
-    """This used to be the 'Automation Server'."""
+    """
+    This used to be the 'Automation Server'.
+
+    The events are stored in a ring buffer, each with a sequence number that
+    keeps increasing even if the log is reset, so that clients can resume
+    from the last event they received.
+    """
 
     def __init__(self) -> None:
         super().__init__()
         self.screen_content: list[TextEvent] = []
-        self.events: list[TextEvent] = []
+        self.log: deque[tuple[int, TextEvent]] = deque(maxlen=EVENT_LOG_SIZE)
+        self.next_seq = 0
         self.condition = threading.Condition()
         self.logger = logging.getLogger("events")
 
+    @property
+    def events(self) -> list[TextEvent]:
+        with self.condition:
+            return [event for _, event in self.log]
+
     def clear_events(self) -> None:
         self.logger.debug("Clearing events")
         self.screen_content = []
 
+    def clear_log(self) -> None:
+        with self.condition:
+            self.log.clear()
+
     def broadcast(self, event: TextEvent) -> None:
         if event.clear:
             self.clear_events()
+            for client in self.clients:
+                client.send_screen_event(event)
             return
 
         self.logger.debug("events: broadcasting %s to %d client(s)", asdict(event), len(self.clients))
-        self.screen_content.append(event)
-        self.events.append(event)
-        for client in self.clients:
-            client.send_screen_event(event)
         with self.condition:
+            self.screen_content.append(event)
+            self.log.append((self.next_seq, event))
+            self.next_seq += 1
             self.condition.notify_all()
+        for client in self.clients:
+            client.send_screen_event(event)
 
+    def _events_since(self, since: int, event_filter: EventFilter | None) -> list[tuple[int, TextEvent]]:
+        first_seq = self.next_seq - len(self.log)
+        start = max(since - first_seq, 0)
+        return [
+            (seq, event) for seq, event in islice(self.log, start, None) if event_filter is None or event_filter.match(event)
+        ]
 
-class EventClient(ObserverInterface):
-    def __init__(self, broadcaster: EventsBroadcaster) -> None:
-        self.events: list[TextEvent] = []
-        self._broadcaster = broadcaster
+    def get_events(self, since: int, event_filter: EventFilter | None = None) -> tuple[list[tuple[int, TextEvent]], int]:
+        """
+        Return the logged events whose sequence number is at least since and
+        which match the filter, and the sequence number to resume from.
+        """
 
-    def generate(self) -> Generator[bytes, None, None]:
-        try:
-            # force headers to be sent
-            yield b""
+        with self.condition:
+            return self._events_since(since, event_filter), self.next_seq
+
+    def wait_events(
+        self, since: int, event_filter: EventFilter | None = None, timeout: float | None = None
+    ) -> tuple[list[tuple[int, TextEvent]], int]:
+        """
+        Same as get_events(), but wait up to timeout seconds (forever if None)
+        for a matching event if there isn't any yet.
+        """
 
+        deadline = None if timeout is None else time.monotonic() + timeout
+        with self.condition:
             while True:
-                with self._broadcaster.condition:
-                    self._broadcaster.condition.wait(1)
+                events = self._events_since(since, event_filter)
+                if events:
+                    return events, self.next_seq
+                # Only check the events which haven't been seen yet on wakeup
+                since = max(since, self.next_seq)
+                if deadline is None:
+                    self.condition.wait()
+                else:
+                    remaining = deadline - time.monotonic()
+                    if remaining <= 0:
+                        return [], self.next_seq
+                    self.condition.wait(remaining)
+
+
+def event_to_dict(seq: int, event: TextEvent, with_seq: bool) -> dict:
+    data = asdict(event)
+    if with_seq:
+        data["seq"] = seq
+    return data
+
+
+class EventClient:
+    def __init__(
+        self, broadcaster: EventsBroadcaster, since: int | None, event_filter: EventFilter | None, with_seq: bool
+    ) -> None:
+        self._broadcaster = broadcaster
+        # Without a sequence number, only stream the events to come
+        self._since = broadcaster.next_seq if since is None else since
+        self._filter = event_filter
+        self._with_seq = with_seq
 
-                while self.events:
-                    event = self.events.pop(0)
-                    data = json.dumps(asdict(event))
-                    # Format the event as specified in the specification:
-                    # https://html.spec.whatwg.org/multipage/server-sent-events.html#parsing-an-event-stream
-                    yield f"data: {data}\n\n".encode()
-        finally:
-            self._broadcaster.remove_client(self)
+    def generate(self) -> Generator[bytes, None, None]:
+        # force headers to be sent
+        yield b""
 
-    def send_screen_event(self, event: TextEvent) -> None:
-        self.events.append(event)
+        since = self._since
+        while True:
+            events, since = self._broadcaster.wait_events(since, self._filter)
+            for seq, event in events:
+                data = json.dumps(event_to_dict(seq, event, self._with_seq))
+                # Format the event as specified in the specification:
+                # https://html.spec.whatwg.org/multipage/server-sent-events.html#parsing-an-event-stream
+                yield f"data: {data}\n\n".encode()
 
 
 class Events(AppResource):
@@ -75,20 +175,45 @@ class Events(AppResource):
         self.parser = reqparse.RequestParser()
         self.parser.add_argument("stream", type=inputs.boolean, default=False, location="values")
         self.parser.add_argument("currentscreenonly", type=inputs.boolean, default=False, location="values")
+        self.parser.add_argument("since", type=inputs.natural, location="values")
+        self.parser.add_argument("wait", type=float, location="values")
+        self.parser.add_argument("text", type=str, location="values")
+        self.parser.add_argument("regexp", type=str, location="values")
+        self.parser.add_argument("region", type=region, location="values")
         super().__init__(*args, **kwargs)
 
-    def get(self) -> Response | tuple[dict[str, list], int]:
+    def get(self) -> Response | tuple[dict, int]:
         args = self.parser.parse_args()
+
+        event_filter = None
+        if args.text is not None or args.regexp is not None or args.region is not None:
+            try:
+                regexp = None if args.regexp is None else re.compile(args.regexp)
+            except re.error as e:
+                return {"error": f"invalid regexp: {e}"}, 400
+            event_filter = EventFilter(args.text, regexp, args.region)
+
+        # Clients using sequence numbers get them along with the events
+        with_seq = args.since is not None or args.wait is not None
+
         if args.stream:
-            client = EventClient(self._broadcaster)
-            self._broadcaster.add_client(client)
+            client = EventClient(self._broadcaster, args.since, event_filter, with_seq)
             return Response(stream_with_context(client.generate()), content_type="text/event-stream")
         elif args.currentscreenonly:
-            event_list = self._broadcaster.screen_content
+            screen_content = self._broadcaster.screen_content
+            event_list = [e for e in screen_content if event_filter is None or event_filter.match(e)]
+            return {"events": [asdict(e) for e in event_list]}, 200
+        elif with_seq:
+            since = self._broadcaster.next_seq if args.since is None else args.since
+            if args.wait is not None:
+                events, next_seq = self._broadcaster.wait_events(since, event_filter, args.wait)
+            else:
+                events, next_seq = self._broadcaster.get_events(since, event_filter)
+            return {"events": [event_to_dict(seq, e, True) for seq, e in events], "next": next_seq}, 200
         else:
-            event_list = self._broadcaster.events
-        return {"events": [asdict(e) for e in event_list]}, 200
+            events, _ = self._broadcaster.get_events(0, event_filter)
+            return {"events": [asdict(e) for _, e in events]}, 200
 
     def delete(self) -> tuple[dict, int]:
-        self._broadcaster.events.clear()
+        self._broadcaster.clear_log()
         return {}, 200
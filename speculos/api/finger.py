@@ -3,9 +3,27 @@ from flask import request
 
 from speculos.resources_importer import get_resource_schema_as_json
 
+from ..mcu.seproxyhal import SeProxyHal
 from .restful import SephResource
 
 
+def finger_action(
+    seph: SeProxyHal,
+    x: int,
+    y: int,
+    action: str,
+    delay: float = 0.1,
+    x2: int | None = None,
+    y2: int | None = None,
+) -> None:
+    if action == "press-and-release":
+        seph.handle_finger(x, y, True)
+        seph.handle_wait(delay)
+        seph.handle_finger(x if x2 is None else x2, y if y2 is None else y2, False)
+    else:
+        seph.handle_finger(x, y, action == "press")
+
+
 class Finger(SephResource):
     schema = get_resource_schema_as_json("api", "finger.schema")
 
@@ -16,16 +34,6 @@ class Finger(SephResource):
         except jsonschema.exceptions.ValidationError as e:
             return {"error": f"{e}"}, 400
 
-        action = args["action"]
-        delay = args.get("delay", 0.1)
-
-        x1, y1 = args["x"], args["y"]
-        if action == "press-and-release":
-            self.seph.handle_finger(x1, y1, True)
-            self.seph.handle_wait(delay)
-            x2, y2 = args.get("x2", x1), args.get("y2", y1)
-            self.seph.handle_finger(x2, y2, False)
-        else:
-            self.seph.handle_finger(x1, y1, action == "press")
+        finger_action(self.seph, args["x"], args["y"], args["action"], args.get("delay", 0.1), args.get("x2"), args.get("y2"))
 
         return {}, 200
@@ -0,0 +1,221 @@
+import base64
+import binascii
+import hashlib
+import io
+import queue
+import struct
+import threading
+import zlib
+from collections import OrderedDict
+from typing import Any
+
+import jsonschema
+from flask import Response, request, stream_with_context
+from flask_restful import reqparse
+
+from speculos.mcu.display import FrameBuffer, FrameUpdate
+from speculos.resources_importer import get_resource_schema_as_json
+
+from .restful import ScreenResource
+
+# Default number of seconds /screen/wait waits for the condition
+DEFAULT_WAIT_TIMEOUT = 10.0
+
+# Memory used by the decoded golden images, the least recently used ones are dropped
+GOLDEN_IMAGES_MAX_SIZE = 128 * 1024 * 1024
+
+# /screen/stream format: a header followed by frames, each one being a frame
+# header and the zlib-compressed RGB pixels of the rectangle which changed.
+# The first frame covers the whole screen.
+STREAM_MAGIC = b"SPECSTRM"
+STREAM_HEADER = struct.Struct(">8sHH")  # magic, screen width, screen height
+FRAME_HEADER = struct.Struct(">IdHHHHI")  # seq, timestamp, x, y, w, h, size of the compressed pixels
+# Frame updates queued for a client, it gets the whole screen again beyond
+STREAM_QUEUE_SIZE = 64
+
+
+class ScreenWait(ScreenResource):
+    def __init__(self, *args, **kwargs) -> None:
+        self.parser = reqparse.RequestParser()
+        self.parser.add_argument("hash", type=str, location="values")
+        self.parser.add_argument("not_hash", type=str, location="values")
+        self.parser.add_argument("timeout", type=float, default=DEFAULT_WAIT_TIMEOUT, location="values")
+        super().__init__(*args, **kwargs)
+
+    def get(self):
+        args = self.parser.parse_args()
+        if args.timeout < 0:
+            return {"error": "timeout must be positive"}, 400
+
+        fb = self.screen.display.m
+        matched, seq, frame_hash = fb.wait_frame(args.hash, args.not_hash, args.timeout)
+        if not matched:
+            return {"error": "timeout", "seq": seq, "hash": frame_hash}, 408
+        return {"seq": seq, "hash": frame_hash}, 200
+
+
+class ScreenObservers(ScreenResource):
+    def post(self):
+        observer, seq = self.screen.display.m.register_frame_observer()
+        return {"id": observer, "seq": seq}, 200
+
+
+class ScreenObserver(ScreenResource):
+    schema = get_resource_schema_as_json("api", "screen_observer.schema")
+
+    def put(self, observer: int):
+        args = request.get_json(force=True)
+        try:
+            jsonschema.validate(instance=args, schema=self.schema)
+        except jsonschema.exceptions.ValidationError as e:
+            return {"error": f"{e}"}, 400
+
+        if not self.screen.display.m.ack_frame(observer, args["seq"]):
+            return {"error": "unknown observer"}, 404
+        return {}, 200
+
+    def delete(self, observer: int):
+        if not self.screen.display.m.unregister_frame_observer(observer):
+            return {"error": "unknown observer"}, 404
+        return {}, 200
+
+
+class GoldenImages:
+    """
+    Decoded golden images, indexed by the SHA-256 of their PNG file, so that
+    clients only upload each of them once.
+    """
+
+    def __init__(self, max_size: int = GOLDEN_IMAGES_MAX_SIZE) -> None:
+        self._images: OrderedDict[str, Any] = OrderedDict()
+        self._size = 0
+        self._max_size = max_size
+        self._lock = threading.Lock()
+
+    def add(self, png: bytes) -> str:
+        # PIL is only needed for screenshots
+        from PIL import Image
+
+        digest = hashlib.sha256(png).hexdigest()
+        image = Image.open(io.BytesIO(png)).convert("RGB")
+        image_size = len(image.mode) * image.width * image.height
+        with self._lock:
+            if digest not in self._images:
+                self._images[digest] = image
+                self._size += image_size
+            self._images.move_to_end(digest)
+            while self._size > self._max_size and len(self._images) > 1:
+                _, old = self._images.popitem(last=False)
+                self._size -= len(old.mode) * old.width * old.height
+        return digest
+
+    def get(self, digest: str) -> Any | None:
+        with self._lock:
+            image = self._images.get(digest)
+            if image is not None:
+                self._images.move_to_end(digest)
+            return image
+
+
+class ScreenCompare(ScreenResource):
+    schema = get_resource_schema_as_json("api", "screen_compare.schema")
+
+    def __init__(self, *args, golden_images: GoldenImages | None = None, **kwargs) -> None:
+        if golden_images is None:
+            raise RuntimeError("Argument 'golden_images' must not be None")
+        self._golden_images = golden_images
+        super().__init__(*args, **kwargs)
+
+    def post(self):
+        args = request.get_json(force=True)
+        try:
+            jsonschema.validate(instance=args, schema=self.schema)
+        except jsonschema.exceptions.ValidationError as e:
+            return {"error": f"{e}"}, 400
+
+        # PIL is only needed for screenshots
+        from PIL import ImageChops, ImageDraw, UnidentifiedImageError
+
+        if "image" in args:
+            try:
+                digest = self._golden_images.add(base64.b64decode(args["image"], validate=True))
+            except (binascii.Error, UnidentifiedImageError) as e:
+                return {"error": f"invalid image: {e}"}, 400
+        else:
+            digest = args["hash"]
+        golden = self._golden_images.get(digest)
+        if golden is None:
+            return {"error": "unknown golden image, upload it with 'image'", "hash": digest}, 404
+
+        live = self.screen.display.m.get_image()
+        if live.size != golden.size:
+            return {"error": f"golden image size {golden.size} doesn't match the screen size {live.size}"}, 400
+
+        # The differences are computed and masked by PIL, without going through Python loops
+        diff = ImageChops.difference(live, golden)
+        draw = ImageDraw.Draw(diff)
+        for x, y, w, h in args.get("masks", []):
+            if w > 0 and h > 0:
+                draw.rectangle((x, y, x + w - 1, y + h - 1), fill=(0, 0, 0))
+        bbox = diff.getbbox()
+
+        result: dict[str, Any] = {"match": bbox is None, "hash": digest, "bbox": None if bbox is None else list(bbox)}
+        if bbox is not None and args.get("diff", False):
+            png = io.BytesIO()
+            diff.save(png, format="PNG")
+            result["diff"] = base64.b64encode(png.getvalue()).decode()
+        return result, 200
+
+
+class FrameUpdateQueue:
+    """
+    Frame updates waiting to be sent to a /screen/stream client. If the client
+    reads too slowly, the queued rectangles are replaced with the whole screen
+    instead of growing without limit.
+    """
+
+    def __init__(self, fb: FrameBuffer, size: int = STREAM_QUEUE_SIZE) -> None:
+        self._fb = fb
+        self._updates: queue.Queue[FrameUpdate] = queue.Queue(size)
+
+    def put(self, update: FrameUpdate) -> None:
+        # Frame listener: called from the MCU thread, with the screenshot lock held
+        try:
+            self._updates.put_nowait(update)
+            return
+        except queue.Full:
+            pass
+        while True:
+            try:
+                self._updates.get_nowait()
+            except queue.Empty:
+                break
+        self._updates.put_nowait(self._fb.full_frame_update())
+
+    def get(self) -> FrameUpdate:
+        return self._updates.get()
+
+
+class ScreenStream(ScreenResource):
+    def get(self):
+        fb = self.screen.display.m
+        width, height = fb.current_screen_size
+
+        def generate():
+            updates = FrameUpdateQueue(fb)
+            listener = updates.put
+            fb.add_frame_listener(listener)
+            try:
+                yield STREAM_HEADER.pack(STREAM_MAGIC, width, height)
+                while True:
+                    update = updates.get()
+                    # Compress outside of the MCU thread, the fastest level is enough for flat UI colors
+                    data = zlib.compress(update.data, 1)
+                    header = FRAME_HEADER.pack(update.seq, update.timestamp, update.x, update.y, update.w, update.h, len(data))
+                    yield header + data
+            finally:
+                fb.remove_frame_listener(listener)
+
+        response = Response(stream_with_context(generate()), content_type="application/octet-stream")
+        response.headers.add("Cache-control", "no-cache,no-store")
+        return response
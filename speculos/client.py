@@ -1,17 +1,34 @@
+import base64
+import hashlib
 import json
 import logging
+import os
+import re
 import socket
 import subprocess
 import sys
+import threading
 import time
-from collections.abc import Generator
+from collections import defaultdict, deque
+from collections.abc import Callable, Generator
 from contextlib import contextmanager
+from dataclasses import asdict
 from types import TracebackType
 
 import requests
 from PIL import Image, ImageChops
 from requests import Response
 
+from speculos import websocket
+from speculos.websocket import (
+    APDU_HEADER,
+    BUTTON_PAYLOAD,
+    FINGER_PAYLOAD,
+    ChannelAction,
+    ChannelMessage,
+    decode_text_event,
+)
+
 logger = logging.getLogger("speculos-client")
 logger.setLevel(logging.INFO)
 
@@ -72,12 +89,120 @@ def screenshot_equal(
     return diff_img.getbbox() is None
 
 
+class PendingRequest:
+    def __init__(self) -> None:
+        self.done = False
+        self.body = b""
+        self.error: str | None = None
+
+
+class Channel:
+    """
+    Client side of the /ws WebSocket channel. Text events received while
+    waiting for a response are kept until they are read with next_event().
+
+    The server answers the requests of a given type in order, but an APDU
+    response can come after the answers to buttons and finger actions sent
+    later: responses are matched to the oldest pending request of their type.
+    Requests can be sent from several threads, for instance to press a button
+    while another thread waits for the response to an APDU; the thread which
+    waits reads the messages for all of them.
+    """
+
+    def __init__(self, ws: websocket.WebSocket) -> None:
+        self.ws = ws
+        self.events: deque[dict] = deque()
+        self.screen_changes = 0
+        self._pending: dict[int, deque[PendingRequest]] = defaultdict(deque)
+        self._received = threading.Condition()
+        self._reading = False
+
+    def close(self) -> None:
+        self.ws.close()
+
+    def _receive(self) -> None:
+        message = self.ws.recv()
+        if message is None:
+            raise ClientException("WebSocket channel closed by the server")
+        _, payload = message
+        message_type, body = payload[0], payload[1:]
+        with self._received:
+            if message_type == ChannelMessage.TEXT_EVENT:
+                self.events.append(asdict(decode_text_event(body)))
+            elif message_type == ChannelMessage.SCREEN_CHANGE:
+                self.screen_changes += 1
+            elif message_type == ChannelMessage.ERROR and body and self._pending[body[0]]:
+                pending = self._pending[body[0]].popleft()
+                pending.error = body[1:].decode()
+                pending.done = True
+            elif self._pending[message_type]:
+                pending = self._pending[message_type].popleft()
+                pending.body = body
+                pending.done = True
+            else:
+                logger.warning(f"unexpected WebSocket channel message 0x{message_type:02x}")
+
+    def _receive_until(self, condition: Callable[[], bool]) -> None:
+        """Read messages until condition is met, or wait for another thread to read them."""
+        while True:
+            with self._received:
+                while self._reading and not condition():
+                    self._received.wait()
+                if condition():
+                    return
+                self._reading = True
+            try:
+                self._receive()
+            finally:
+                with self._received:
+                    self._reading = False
+                    self._received.notify_all()
+
+    def request(self, message_type: ChannelMessage, payload: bytes = b"") -> bytes:
+        pending = PendingRequest()
+        with self._received:
+            # Sent with the lock held, so that requests are queued in the order they are sent
+            self._pending[message_type].append(pending)
+            self.ws.send(bytes([message_type]) + payload)
+        self._receive_until(lambda: pending.done)
+        if pending.error is not None:
+            if pending.error == "timeout":
+                raise TimeoutError()
+            raise ClientException(f"WebSocket channel request failed: {pending.error}")
+        return pending.body
+
+    def next_event(self) -> dict:
+        while True:
+            self._receive_until(lambda: bool(self.events))
+            with self._received:
+                # Unless another thread took it first
+                if self.events:
+                    return self.events.popleft()
+
+
 class Api:
     def __init__(self, api_url: str) -> None:
         self.api_url = api_url
         self.timeout = 2000
         self.session = requests.Session()
         self.stream: Response | None = None
+        self.channel: Channel | None = None
+        # Sequence number of the next event to look at in wait_for_event(), None until synced with the server
+        self.event_seq: int | None = None
+
+    def open_channel(self) -> None:
+        """
+        Send APDUs, buttons and finger actions and receive the text events
+        through a single WebSocket instead of one HTTP request per action.
+        """
+        if self.channel is not None:
+            raise AssertionError("Channel is already open")
+        self.channel = Channel(websocket.connect(f"ws{self.api_url.removeprefix('http')}/ws"))
+
+    def close_channel(self) -> None:
+        if self.channel:
+            self.channel.close()
+        self.channel = None
 
     def open_stream(self) -> None:
         if self.stream is not None:
@@ -103,6 +228,8 @@ class Api:
         https://html.spec.whatwg.org/multipage/server-sent-events.html#parsing-an-event-stream
         """
         if self.stream is None:
+            if self.channel is not None:
+                return self.channel.next_event()
             raise AssertionError("Stream is not open")
         data = b""
         while True:
@@ -119,9 +246,73 @@ class Api:
 
         return event
 
+    def get_events(
+        self,
+        since: int | None = 0,
+        text: str | None = None,
+        regexp: str | None = None,
+        region: tuple[int, int, int, int] | None = None,
+        wait: float | None = None,
+    ) -> tuple[list[dict], int]:
+        """
+        Return the events whose sequence number is at least since (the next
+        event to be received if None) and which match the filters, and the
+        sequence number to resume from. If wait is set and no event matches
+        yet, wait up to wait seconds for one.
+        """
+
+        params: dict = {} if since is None else {"since": since}
+        if text is not None:
+            params["text"] = text
+        if regexp is not None:
+            params["regexp"] = regexp
+        if region is not None:
+            params["region"] = ",".join(str(v) for v in region)
+        if wait is not None:
+            params["wait"] = wait
+        with self.session.get(f"{self.api_url}/events", params=params) as response:
+            check_status_code(response, "/events")
+            result = response.json()
+        return result["events"], result["next"]
+
+    def sync_events(self) -> None:
+        """Make wait_for_event() ignore the events which have already been received by the server."""
+        # The server returns the sequence number of the next event, without waiting for one
+        _, self.event_seq = self.get_events(None, wait=0)
+
+    def wait_for_event(
+        self,
+        text: str | None = None,
+        regexp: str | None = None,
+        region: tuple[int, int, int, int] | None = None,
+        timeout: float | None = None,
+    ) -> dict:
+        """
+        Wait until the server received an event matching the filters, after the
+        last one returned by this method, or after sync_events() (called when
+        the client is started, or by the first call).
+        """
+
+        if self.event_seq is None:
+            self.sync_events()
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while True:
+            wait = 30.0 if deadline is None else max(deadline - time.monotonic(), 0)
+            events, _ = self.get_events(self.event_seq, text, regexp, region, wait)
+            if events:
+                event = events[0]
+                self.event_seq = event.pop("seq") + 1
+                return event
+            if deadline is not None and time.monotonic() >= deadline:
+                raise TimeoutError()
+
     def wait_for_text_event(self, text: str) -> dict:
         """Wait until an event containing the specified text is received."""
 
+        if self.stream is None and self.channel is None:
+            # Let the server do the filtering instead of streaming every event
+            return self.wait_for_event(regexp=re.escape(text))
+
         while True:
             event = self.get_next_event()
             if text in event["text"]:
@@ -131,6 +322,10 @@ class Api:
     def press_and_release(self, button: str) -> None:
         if button not in ["left", "right", "both"]:
             raise ValueError(f"Invalid button: {button}")
+        if self.channel is not None:
+            mask = {"left": 1, "right": 2, "both": 3}[button]
+            self.channel.request(ChannelMessage.BUTTON, BUTTON_PAYLOAD.pack(mask, ChannelAction.PRESS_AND_RELEASE, 100))
+            return
         data = {"action": "press-and-release"}
         with self.session.post(f"{self.api_url}/button/{button}", json=data) as response:
             check_status_code(response, f"/button/{button}")
@@ -143,6 +338,9 @@ class Api:
         y2: int | None = None,
         delay: float = 0.5,
     ) -> None:
+        if self.channel is not None:
+            self._channel_finger(x, y, x if x2 is None else x2, y if y2 is None else y2, delay)
+            return
         data = {"action": "press-and-release", "x": x, "y": y, "delay": delay}
         if x2 is not None:
             data["x2"] = x2
@@ -161,6 +359,9 @@ class Api:
             x2 -= 10
         elif direction == "right":
             x2 += 10
+        if self.channel is not None:
+            self._channel_finger(x, y, x2, y2, delay)
+            return
         data = {
             "action": "press-and-release",
             "x": x,
@@ -172,6 +373,12 @@ class Api:
         with self.session.post(f"{self.api_url}/finger", json=data) as response:
             check_status_code(response, "/finger")
 
+    def _channel_finger(self, x: int, y: int, x2: int, y2: int, delay: float) -> None:
+        if self.channel is None:
+            raise AssertionError("Channel is not open")
+        payload = FINGER_PAYLOAD.pack(x, y, ChannelAction.PRESS_AND_RELEASE, int(delay * 1000), x2, y2)
+        self.channel.request(ChannelMessage.FINGER, payload)
+
     def ticker_ctl(self, action: str) -> None:
         data = {"action": action}
         with self.session.post(f"{self.api_url}/ticker", json=data) as response:
@@ -182,7 +389,78 @@ class Api:
             check_status_code(response, "/screenshot")
             return response.content
 
+    def wait_for_screen(self, hash_: str | None = None, not_hash: str | None = None, timeout: float = 10.0) -> dict:
+        """
+        Wait until the content hash of the screen is hash_ (if set) and differs
+        from not_hash (if set), and return the sequence number and hash of the
+        current frame. Without condition, return them immediately.
+        """
+
+        params: dict = {"timeout": timeout}
+        if hash_ is not None:
+            params["hash"] = hash_
+        if not_hash is not None:
+            params["not_hash"] = not_hash
+        with self.session.get(f"{self.api_url}/screen/wait", params=params) as response:
+            if response.status_code == 408:
+                raise TimeoutError()
+            check_status_code(response, "/screen/wait")
+            return response.json()
+
+    def register_frame_observer(self) -> dict:
+        """
+        Register as a frame observer: the app is then held after each refresh
+        until the frame is acknowledged with ack_frame(). The observer is
+        unregistered if a frame isn't acknowledged within 5 seconds. Return
+        the "id" of the observer and the "seq" of the current frame.
+        """
+
+        with self.session.post(f"{self.api_url}/screen/observers") as response:
+            check_status_code(response, "/screen/observers")
+            return response.json()
+
+    def ack_frame(self, observer: int, seq: int) -> None:
+        with self.session.put(f"{self.api_url}/screen/observers/{observer}", json={"seq": seq}) as response:
+            check_status_code(response, "/screen/observers")
+
+    def unregister_frame_observer(self, observer: int) -> None:
+        with self.session.delete(f"{self.api_url}/screen/observers/{observer}") as response:
+            check_status_code(response, "/screen/observers")
+
+    def compare_screen(
+        self,
+        golden: bytes,
+        masks: list[tuple[int, int, int, int]] | None = None,
+        diff: bool = False,
+    ) -> dict:
+        """
+        Compare the screen with a golden PNG image on the server, ignoring the
+        masked (x, y, w, h) rectangles. The image is only uploaded if the
+        server doesn't know it yet. Return a dict with "match", the "bbox" of
+        the differences and, if diff is set and the images differ, the
+        base64-encoded PNG of the "diff".
+        """
+
+        payload: dict = {"hash": hashlib.sha256(golden).hexdigest(), "diff": diff}
+        if masks:
+            payload["masks"] = [list(mask) for mask in masks]
+        with self.session.post(f"{self.api_url}/screen/compare", json=payload) as response:
+            if response.status_code != 404:
+                check_status_code(response, "/screen/compare")
+                return response.json()
+
+        del payload["hash"]
+        payload["image"] = base64.b64encode(golden).decode()
+        with self.session.post(f"{self.api_url}/screen/compare", json=payload) as response:
+            check_status_code(response, "/screen/compare")
+            return response.json()
+
     def _apdu_exchange(self, data: bytes, tick_timeout: int = 5 * 60 * 10) -> bytes:
+        if self.channel is not None:
+            response, status = split_apdu(self.channel.request(ChannelMessage.APDU, APDU_HEADER.pack(tick_timeout) + data))
+            if status != 0x9000:
+                raise ApduException(status, response)
+            return response
         try:
             data_payload = {"data": data.hex(), "tick_timeout": tick_timeout}
             with self.session.post(f"{self.api_url}/apdu", json=data_payload) as response:
@@ -193,6 +471,34 @@ class Api:
         except requests.exceptions.ChunkedEncodingError:
             raise TimeoutError() from None
 
+    def apdu_batch_exchange(
+        self,
+        apdus: list[bytes],
+        expected_sw: list[int] | None = None,
+        stop_on_error: bool = True,
+        tick_timeout: int = 5 * 60 * 10,
+    ) -> Generator[dict, None, None]:
+        """Send the APDUs back to back and yield the result of each one as soon as it is received."""
+
+        payload: dict = {
+            "apdus": [{"data": apdu.hex()} for apdu in apdus],
+            "stop_on_error": stop_on_error,
+            "tick_timeout": tick_timeout,
+        }
+        if expected_sw is not None:
+            payload["expected_sw"] = [f"{sw:04x}" for sw in expected_sw]
+        with self.session.post(f"{self.api_url}/apdus", json=payload, stream=True) as response:
+            check_status_code(response, "/apdus")
+            for line in response.iter_lines():
+                if not line:
+                    continue
+                result = json.loads(line)
+                if result.get("done"):
+                    break
+                if "data" in result:
+                    result["data"] = bytes.fromhex(result["data"])
+                yield result
+
     def _apdu_exchange_nowait(self, data: bytes) -> requests.Response:
         return self.session.post(f"{self.api_url}/apdu", json={"data": data.hex()}, stream=True)
 
@@ -271,11 +577,13 @@ class SpeculosClient(Api, SpeculosInstance):
         using `start` and `stop` methods.
         """
         SpeculosInstance.start(self)
+        self.sync_events()
         self.open_stream()
 
     def stop(self) -> None:
         """Terminate speculos instance started with `start` method."""
         self.close_stream()
+        self.close_channel()
         SpeculosInstance.stop(self)
 
     def __enter__(self) -> "SpeculosClient":
@@ -314,3 +622,60 @@ class SpeculosClient(Api, SpeculosInstance):
         finally:
             if response:
                 response.close()
+
+
+class SpeculosLease(SpeculosClient):
+    """
+    Same as SpeculosClient, but the instance is leased from a `speculos pool`
+    daemon instead of being started, and released on `stop`.
+    """
+
+    def __init__(
+        self,
+        app: str,
+        pool_url: str = "http://127.0.0.1:7000",
+        model: str | None = None,
+        seed: str | None = None,
+        timeout: float = 60.0,
+        ttl: float | None = None,
+    ) -> None:
+        super().__init__(app)
+        self.pool_url = pool_url
+        self.model = model
+        self.seed = seed
+        self.lease_timeout = timeout
+        self.ttl = ttl
+        self.lease: dict | None = None
+        self.apdu_port: int | None = None
+
+    def start(self) -> None:
+        # The pool daemon runs on the same host, but maybe not in the same directory
+        payload = {"app": os.path.abspath(self.app), "model": self.model, "seed": self.seed, "timeout": self.lease_timeout}
+        if self.ttl is not None:
+            payload["ttl"] = self.ttl
+        with self.session.post(f"{self.pool_url}/leases", json=payload) as response:
+            check_status_code(response, "/leases")
+            self.lease = response.json()
+        self.port = self.lease["api_port"]
+        self.apdu_port = self.lease["apdu_port"]
+        self.api_url = f"http://127.0.0.1:{self.port}"
+        logger.info(f"leased {self.app} on port {self.port}")
+        self.sync_events()
+        self.open_stream()
+
+    def renew(self) -> None:
+        """Extend the lease, which is released by the pool when it expires."""
+        if self.lease is None:
+            raise ClientException("No lease")
+        payload = {} if self.ttl is None else {"ttl": self.ttl}
+        with self.session.put(f"{self.pool_url}/leases/{self.lease['id']}", json=payload) as response:
+            check_status_code(response, "/leases")
+
+    def stop(self) -> None:
+        """Release the instance, which is restarted by the pool before being leased again."""
+        self.close_stream()
+        self.close_channel()
+        if self.lease is not None:
+            with self.session.delete(f"{self.pool_url}/leases/{self.lease['id']}") as response:
+                check_status_code(response, "/leases")
+            self.lease = None
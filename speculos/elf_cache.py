@@ -0,0 +1,104 @@
+"""
+Persistent cache of the metadata extracted from ELF files at startup.
+
+Entries are keyed by the SHA-256 of the ELF file content, so that they never go stale. The cache holds:
+
+- the parsed ElfInfo of apps and shared libs (JSON), to avoid parsing them again with pyelftools,
+- the offsets of the SVC instructions of apps (binary, written and read by the launcher), to avoid scanning the whole
+  text segment for them. The scan depends on the API level, which is part of the key.
+"""
+
+import hashlib
+import json
+import logging
+import os
+from pathlib import Path
+from typing import Any
+
+# Bump when the format or the content of the cached entries change
+CACHE_VERSION = 1
+
+logger = logging.getLogger("elf_cache")
+
+
+def get_default_cache_dir() -> Path:
+    if "SPECULOS_CACHE_DIR" in os.environ:
+        return Path(os.environ["SPECULOS_CACHE_DIR"])
+    xdg_cache_home = os.environ.get("XDG_CACHE_HOME")
+    base = Path(xdg_cache_home) if xdg_cache_home else Path.home() / ".cache"
+    return base / "speculos"
+
+
+class ElfCache:
+    def __init__(self, directory: Path | None = None):
+        """
+        :param directory: Cache directory, created if needed. Defaults to $SPECULOS_CACHE_DIR, or speculos/ in
+                          $XDG_CACHE_HOME (~/.cache). If it can't be created, caching is disabled.
+        """
+        self.directory: Path | None = directory or get_default_cache_dir()
+        try:
+            self.directory.mkdir(parents=True, exist_ok=True)
+        except OSError as e:
+            logger.warning(f"caching disabled, failed to create {self.directory}: {e}")
+            self.directory = None
+        self._digests: dict[str, str] = {}
+
+    @property
+    def enabled(self) -> bool:
+        return self.directory is not None
+
+    def digest(self, path: str) -> str:
+        """SHA-256 of a file content, computed once per run"""
+        if path not in self._digests:
+            h = hashlib.sha256()
+            with open(path, "rb") as fp:
+                for chunk in iter(lambda: fp.read(1 << 20), b""):
+                    h.update(chunk)
+            self._digests[path] = h.hexdigest()
+        return self._digests[path]
+
+    def _entry_path(self, path: str, suffix: str) -> Path:
+        if self.directory is None:
+            raise ValueError("cache is disabled")
+        return self.directory / f"{self.digest(path)}{suffix}"
+
+    @staticmethod
+    def _params_key(kind: str, params: dict[str, Any]) -> str:
+        return json.dumps({"version": CACHE_VERSION, "kind": kind, **params}, sort_keys=True)
+
+    def load(self, path: str, kind: str, params: dict[str, Any]) -> dict[str, Any] | None:
+        """
+        Return the entry of kind cached for this ELF file and these parsing parameters, or None.
+        """
+        if not self.enabled:
+            return None
+        try:
+            entries = json.loads(self._entry_path(path, ".json").read_text())
+        except (OSError, ValueError):
+            return None
+        entry = entries.get(self._params_key(kind, params))
+        return entry if isinstance(entry, dict) else None
+
+    def store(self, path: str, kind: str, params: dict[str, Any], entry: dict[str, Any]) -> None:
+        if not self.enabled:
+            return
+        entry_path = self._entry_path(path, ".json")
+        try:
+            entries = json.loads(entry_path.read_text())
+        except (OSError, ValueError):
+            entries = {}
+        entries[self._params_key(kind, params)] = entry
+
+        # Written to a temporary file first, so that concurrent emulators never read a partial file
+        tmp_path = entry_path.with_name(f"{entry_path.name}.{os.getpid()}")
+        try:
+            tmp_path.write_text(json.dumps(entries))
+            tmp_path.replace(entry_path)
+        except OSError as e:
+            logger.warning(f"failed to cache ELF infos to {entry_path}: {e}")
+
+    def svc_sites_path(self, path: str, api_level: int | str) -> Path | None:
+        """File caching the SVC instructions offsets of an app at an API level, managed by the launcher"""
+        if not self.enabled:
+            return None
+        return self._entry_path(path, f".api{int(api_level)}.svc")
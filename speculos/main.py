@@ -7,29 +7,33 @@ Emulate the target app along the SE Proxy Hal server.
 import argparse
 import binascii
 import ctypes
+import functools
 import logging
 import os
 import signal
 import socket
 import sys
 import threading
-from dataclasses import dataclass
+from collections.abc import Callable
+from dataclasses import asdict, dataclass
+from typing import TYPE_CHECKING
 
 from elftools.elf.elffile import ELFFile
 from ledgered.binary import LedgerBinaryApp
-from mnemonic import mnemonic
 
-from .api import ApiRunner, EventsBroadcaster
+from .elf_cache import ElfCache
 from .mcu import apdu as apdu_server
-from .mcu import automation, display, seproxyhal
-from .mcu.automation_server import AutomationClient, AutomationServer
-from .mcu.button_tcp import FakeButton
-from .mcu.finger_tcp import FakeFinger
+from .mcu import display, seproxyhal
 from .mcu.struct import DisplayArgs, ServerArgs
 from .mcu.transport import TransportType
-from .mcu.vnc import VNC
 from .observer import BroadcastInterface
 from .resources_importer import resources
+from .startup_profile import profile as startup_profile
+
+# Optional subsystems (REST API, VNC, automation...) are only imported when enabled, to keep startup fast
+if TYPE_CHECKING:
+    from .api import ApiRunner
+    from .mcu import automation
 
 
 @dataclass
@@ -52,6 +56,17 @@ class ElfInfo:
     pic_init_addr: int = 0
     derivation_path: bytes = b""
 
+    def to_dict(self) -> dict:
+        d = asdict(self)
+        d["derivation_path"] = self.derivation_path.hex()
+        return d
+
+    @classmethod
+    def from_dict(cls, d: dict) -> "ElfInfo":
+        d = dict(d)
+        d["derivation_path"] = bytes.fromhex(d["derivation_path"])
+        return cls(**d)
+
 
 BOLOS_TAG_DERIVEPATH = 0x04
 
@@ -73,6 +88,30 @@ def set_pdeath(sig):
     libc.prctl(PR_SET_PDEATHSIG, sig)
 
 
+@functools.cache
+def get_binary(path: str) -> LedgerBinaryApp:
+    """Parse the metadata of a binary once, however many times it is needed during startup"""
+    return LedgerBinaryApp(path)
+
+
+def get_cached_elf_infos(
+    elf_cache: ElfCache | None, path: str, kind: str, params: dict, parse: Callable[[], ElfInfo]
+) -> ElfInfo:
+    """Return the ElfInfo of an ELF file from the cache, or parse it and cache it"""
+    if elf_cache is not None:
+        entry = elf_cache.load(path, kind, params)
+        if entry is not None:
+            try:
+                return ElfInfo.from_dict(entry)
+            except (TypeError, ValueError):
+                logger.warning(f"ignoring invalid cached ELF infos of {path}")
+
+    ei = parse()
+    if elf_cache is not None:
+        elf_cache.store(path, kind, params, ei.to_dict())
+    return ei
+
+
 def get_elf_infos(app_path, use_bagl, args):
     ei = ElfInfo()
     with open(app_path, "rb") as fp:
@@ -224,7 +263,7 @@ def get_sharedlib_infos(app_path, apiLevel):
     return ei
 
 
-def run_qemu(s1: socket.socket, s2: socket.socket, args: argparse.Namespace) -> int:
+def run_qemu(s1: socket.socket, s2: socket.socket, args: argparse.Namespace, elf_cache: ElfCache | None = None) -> int:
     argv = ["qemu-arm-static"]
 
     if args.debug:
@@ -252,7 +291,13 @@ def run_qemu(s1: socket.socket, s2: socket.socket, args: argparse.Namespace) ->
         sharedlib_filepath = f"sharedlib/{args.model}-api-level-shared-{args.apiLevel}.elf"
     sharedlib = str(resources.files(__package__) / sharedlib_filepath)
     if os.path.exists(sharedlib):
-        sharedlib_ei = get_sharedlib_infos(sharedlib, args.apiLevel)
+        sharedlib_ei = get_cached_elf_infos(
+            elf_cache,
+            sharedlib,
+            "sharedlib",
+            {"api_level": args.apiLevel},
+            lambda: get_sharedlib_infos(sharedlib, args.apiLevel),
+        )
         sharedlib_args = f"{sharedlib}:{sharedlib_ei.text_offset:#x}"
         sharedlib_args += f":{sharedlib_ei.text_size:#x}"
         sharedlib_args += f":{sharedlib_ei.text_addr:#x}"
@@ -278,11 +323,17 @@ def run_qemu(s1: socket.socket, s2: socket.socket, args: argparse.Namespace) ->
     app_path = getattr(args, "app.elf")
     for lib in [f"main:{app_path}", *args.library]:
         name, lib_path = lib.split(":")
-        binary = LedgerBinaryApp(lib_path)
+        binary = get_binary(lib_path)
         use_bagl = binary.sections.sdk_graphics == "bagl"
         if not use_bagl:
             only_bagl = False
-        ei = get_elf_infos(lib_path, use_bagl, args)
+        ei = get_cached_elf_infos(
+            elf_cache,
+            lib_path,
+            "app",
+            {"use_bagl": use_bagl, "load_nvram": args.load_nvram, "save_nvram": args.save_nvram},
+            functools.partial(get_elf_infos, lib_path, use_bagl, args),
+        )
 
         # If the application has been linked with 'C_bagl_fonts' symbol,
         # then use the fonts in the .ELF file (except for touch devices).
@@ -317,6 +368,10 @@ def run_qemu(s1: socket.socket, s2: socket.socket, args: argparse.Namespace) ->
             lib_arg += ":0"
         argv.append(lib_arg)
 
+        # The launcher caches the SVC instructions offsets of apps which don't export SVC_Call
+        if elf_cache is not None and ei.svc_call_addr == 0 and ei.svc_cx_call_addr == 0:
+            argv += ["-S", f"{name}:{elf_cache.svc_sites_path(lib_path, args.apiLevel)}"]
+
     # for NBGL apps, fonts binary file is mandatory before API Level 23
     if not only_bagl and int(args.apiLevel) < 23:
         fonts_filepath = f"fonts/{args.model}-fonts-{args.apiLevel}.bin"
@@ -327,7 +382,7 @@ def run_qemu(s1: socket.socket, s2: socket.socket, args: argparse.Namespace) ->
             logger.error(f"Fonts {fonts_filepath} not found")
             sys.exit(1)
     # retrieve app_flags from a dedicated section in app.elf
-    binary = LedgerBinaryApp(app_path)
+    binary = get_binary(app_path)
     app_flags = binary.sections.app_flags
     if app_flags is None:
         # if not found in app.elf, everything is allowed (old binaries)
@@ -352,6 +407,8 @@ def run_qemu(s1: socket.socket, s2: socket.socket, args: argparse.Namespace) ->
     if args.seed.startswith("hex:"):
         seed = bytes.fromhex(args.seed[4:])
     else:
+        from mnemonic import mnemonic
+
         seed = mnemonic.Mnemonic.to_seed(args.seed)
 
     os.environ["SPECULOS_SEED"] = binascii.hexlify(seed).decode("ascii")
@@ -394,6 +451,10 @@ def setup_logging(args):
 
 
 def main(prog=None) -> int:
+    if sys.argv[1:2] == ["pool"]:
+        from .pool import main as pool_main
+
+        return pool_main(sys.argv[2:], prog=f"{prog or 'speculos'} pool")
 
     parser = argparse.ArgumentParser(description="Emulate Ledger Nano S+, X, Stax, Flex, Apex+ apps.")
     parser.add_argument("app.elf", type=str, help="application path")
@@ -534,6 +595,26 @@ def main(prog=None) -> int:
     )
     group.add_argument("--save-nvram", action="store_true", help="Save app NVRAM data to file")
 
+    parser.add_argument(
+        "--no-cache",
+        action="store_true",
+        help="Don't cache ELF metadata (by default in $SPECULOS_CACHE_DIR or $XDG_CACHE_HOME/speculos)",
+    )
+
+    group = parser.add_argument_group("profiling arguments")
+    group.add_argument(
+        "--startup-profile",
+        nargs="?",
+        const="-",
+        metavar="FILE",
+        help="Report startup milestones (time to first APDU) as JSON to FILE, or to stderr if FILE is omitted",
+    )
+    group.add_argument(
+        "--seph-capture",
+        metavar="FILE",
+        help="Record the display packets sent by the app to FILE, to replay them with tools/render-bench.py",
+    )
+
     if prog:
         parser.prog = prog
     args = parser.parse_args()
@@ -544,9 +625,12 @@ def main(prog=None) -> int:
     # Initialize root logging level and handlers and module specific level if requested in command line
     setup_logging(args)
 
+    if args.startup_profile:
+        startup_profile.enable(args.startup_profile)
+
     # Init model and api_level if not specified from app elf metadata
     app_path = getattr(args, "app.elf")
-    binary = LedgerBinaryApp(app_path)
+    binary = get_binary(app_path)
     if not args.model:
         if binary.sections.target is None:
             logger.error("Device model not detected from elf. Then it must be specified")
@@ -580,7 +664,7 @@ def main(prog=None) -> int:
             lib_name = None
             lib_path = lib_arg
 
-        elf_lib_name = LedgerBinaryApp(lib_path).sections.app_name
+        elf_lib_name = get_binary(lib_path).sections.app_name
 
         if lib_name is None:
             if elf_lib_name is None:
@@ -599,7 +683,7 @@ def main(prog=None) -> int:
 
     # Check model and api_level against all lib elf metadata
     for path in [app_path] + [x.split(":")[1] for x in args.library]:
-        binary = LedgerBinaryApp(path)
+        binary = get_binary(path)
 
         elf_model = ("nanosp" if binary.sections.target == "nanos2" else binary.sections.target) or args.model
         if args.model != elf_model:
@@ -655,7 +739,9 @@ def main(prog=None) -> int:
     if args.automation:
         # TODO: remove this condition and all associated code in next major version
         logger.warning("--automation is deprecated, please use the REST API instead")
-        automation_path = automation.Automation(args.automation)
+        from .mcu.automation import Automation
+
+        automation_path = Automation(args.automation)
 
     automation_server: BroadcastInterface | None = None
     if args.automation_port:
@@ -664,17 +750,23 @@ def main(prog=None) -> int:
         if api_enabled:
             logger.warning("--automation-port is incompatible with the API server, disabling the latter")
             api_enabled = False
+        from .mcu.automation_server import AutomationClient, AutomationServer
+
         automation_server = AutomationServer(("0.0.0.0", args.automation_port), AutomationClient)  # noqa: S104
         automation_thread = threading.Thread(target=automation_server.serve_forever, daemon=True)
         automation_thread.start()
 
     if api_enabled:
+        from .api import EventsBroadcaster
+
         automation_server = EventsBroadcaster()
 
     s1, s2 = socket.socketpair()
 
-    qemu_pid = run_qemu(s1, s2, args)
+    elf_cache = None if args.no_cache else ElfCache()
+    qemu_pid = run_qemu(s1, s2, args, elf_cache)
     s1.close()
+    startup_profile.mark("qemu_spawned")
 
     # The `--transport` argument takes precedence over `--usb`
     if args.transport is not None:
@@ -682,7 +774,6 @@ def main(prog=None) -> int:
     else:
         transport_type = TransportType[args.usb.upper()]
 
-    apdu = apdu_server.ApduServer(host="0.0.0.0", port=args.apdu_port)  # noqa: S104
     seph = seproxyhal.SeProxyHal(
         s2,
         args.model,
@@ -692,19 +783,32 @@ def main(prog=None) -> int:
         args.verbose,
         args.sound,
     )
+    apdu = apdu_server.ApduServer(host="0.0.0.0", port=args.apdu_port, arbiter=seph.apdu_arbiter)  # noqa: S104
+    if startup_profile.enabled:
+        seph.apdu_callbacks.append(lambda _: startup_profile.mark("first_apdu"))
+    if args.seph_capture:
+        from .mcu.seph_capture import SephCapture
+
+        seph.capture = SephCapture(args.seph_capture, args.model)
 
     button = None
     if args.button_port:
         logger.warning("--button-port is deprecated, please use the REST API instead")
+        from .mcu.button_tcp import FakeButton
+
         button = FakeButton(args.button_port)
 
     finger = None
     if args.finger_port:
         logger.warning("--finger-port is deprecated, please use the REST API instead")
+        from .mcu.finger_tcp import FakeFinger
+
         finger = FakeFinger(args.finger_port)
 
     vnc = None
     if args.vnc_port:
+        from .mcu.vnc import VNC
+
         screen_size = display.MODELS[args.model].screen_size
         vnc = VNC(args.vnc_port, screen_size, args.vnc_password)
 
@@ -719,6 +823,8 @@ def main(prog=None) -> int:
 
     apirun: ApiRunner | None = None
     if api_enabled:
+        from .api import ApiRunner
+
         apirun = ApiRunner(args.api_port)
 
     display_args = DisplayArgs(args.color, args.model, args.ontop, rendering, args.keymap, zoom, x, y)
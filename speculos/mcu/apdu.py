@@ -3,8 +3,13 @@ from __future__ import annotations
 import errno
 import logging
 import socket
+import threading
+from collections import deque
+from collections.abc import Callable, Iterator
+from contextlib import contextmanager
+from typing import Any
 
-from .display import DisplayNotifier, IODevice
+from .display import Display, DisplayNotifier, IODevice
 
 """
 Forward packets between an external application and the emulated device.
@@ -14,12 +19,76 @@ communicate.
 """
 
 
+class ApduArbiter:
+    """
+    Give the app to one APDU transport at a time: the TCP server, and the
+    /apdu, /apdus and /ws endpoints of the REST API. The app answers the APDUs
+    one by one, and nothing in a response tells which transport sent the
+    command. The transports get the app in turn, in the order they asked for it.
+    """
+
+    def __init__(self) -> None:
+        self._lock = threading.Lock()
+        self._owner: Callable[[], None] | None = None
+        self._waiting: deque[Callable[[], None]] = deque()
+
+    def acquire(self, granted: Callable[[], None]) -> bool:
+        """
+        Return True if the app was free. Otherwise, granted is called once the
+        app is given to the caller, from the thread which released it.
+        """
+        with self._lock:
+            if self._owner is None and not self._waiting:
+                self._owner = granted
+                return True
+            self._waiting.append(granted)
+            return False
+
+    def release(self) -> None:
+        with self._lock:
+            self._owner = self._waiting.popleft() if self._waiting else None
+            granted = self._owner
+        if granted is not None:
+            granted()
+
+    @contextmanager
+    def exclusive(self) -> Iterator[None]:
+        """Wait for the app, which is held until the end of the block."""
+        event = threading.Event()
+        if not self.acquire(event.set):
+            event.wait()
+        try:
+            yield
+        finally:
+            self.release()
+
+
 class ApduServer(IODevice):
-    def __init__(self, host: str = "127.0.0.1", port: int = 9999):
+    """
+    Accept several clients at once. The APDUs of each client are queued, and
+    the queues are served in a round-robin fashion, one APDU at a time, so
+    that each response is routed back to the client which sent the command.
+    Clients may send several APDUs without waiting for the responses
+    (pipelining): they are answered in order.
+
+    The app is shared with the REST API through the arbiter: queued APDUs
+    wait until the exchanges of the API are done.
+    """
+
+    def __init__(self, host: str = "127.0.0.1", port: int = 9999, arbiter: ApduArbiter | None = None):
         self.socket = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
         self.socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
         self.logger = logging.getLogger("apdu")
-        self.client: ApduClient | None = None
+        self.arbiter = arbiter if arbiter is not None else ApduArbiter()
+        # The queues are filled by the MCU thread, and may be served by an API thread releasing the app
+        self._lock = threading.Lock()
+        self.clients: list[ApduClient] = []
+        # Client whose APDU is being processed by the app
+        self.pending_client: ApduClient | None = None
+        # Whether the app was requested from the arbiter, while another transport uses it
+        self._waiting_for_app = False
+        self._next_client = 0
+        self._display: Display | None = None
 
         try:
             self.socket.bind((host, port))  # lgtm [py/bind-socket-all-network-interfaces]
@@ -40,18 +109,92 @@ class ApduServer(IODevice):
         return self.socket
 
     def can_read(self, screen: DisplayNotifier):
-        c, _ = self.file.accept()
-        self.client = ApduClient(c)
-        screen.add_notifier(self.client)
+        c, address = self.file.accept()
+        self._display = screen.display
+        client = ApduClient(c, self, address)
+        with self._lock:
+            self.clients.append(client)
+        self.logger.debug(f"new client {client.name} ({len(self.clients)} connected)")
+        screen.add_notifier(client)
+
+    def remove_client(self, client: ApduClient) -> None:
+        with self._lock:
+            self.clients.remove(client)
+            # The response to its pending APDU, if any, will be dropped
+            client.queue.clear()
+        self.logger.debug(f"client {client.name} disconnected ({len(self.clients)} connected)")
+
+    def queue_apdu(self, client: ApduClient, packet: bytes) -> None:
+        with self._lock:
+            client.queue.append(packet)
+        self._send_next()
+
+    def _pop_next(self) -> bytes | None:
+        # Must be called with _lock held. Round-robin over the clients with queued APDUs.
+        for i in range(len(self.clients)):
+            index = (self._next_client + i) % len(self.clients)
+            client = self.clients[index]
+            if client.queue:
+                self._next_client = index + 1
+                self.pending_client = client
+                return client.queue.popleft()
+        return None
+
+    def _forward_to_app(self, packet: bytes) -> None:
+        if self._display is None:
+            raise AssertionError("APDU queued before any client connected")
+        self.logger.info(f"> {packet.hex()}")
+        self._display.forward_to_app(packet)
+
+    def _send_next(self) -> None:
+        """Send the next queued APDU to the app, if none is being processed."""
+
+        with self._lock:
+            if self.pending_client is not None or self._waiting_for_app:
+                return
+            if not any(client.queue for client in self.clients):
+                return
+            if not self.arbiter.acquire(self._app_granted):
+                self._waiting_for_app = True
+                return
+            packet = self._pop_next()
+        if packet is not None:
+            self._forward_to_app(packet)
+
+    def _app_granted(self) -> None:
+        """Called by the arbiter once the app is released by another transport."""
+
+        with self._lock:
+            self._waiting_for_app = False
+            packet = self._pop_next()
+        if packet is None:
+            # The clients disconnected meanwhile
+            self.arbiter.release()
+        else:
+            self._forward_to_app(packet)
 
     def forward_to_client(self, packet: bytes):
-        if self.client is not None:
-            self.client.forward_to_client(packet)
+        with self._lock:
+            client = self.pending_client
+            if client is None:
+                # Response to an APDU which didn't come from this server
+                return
+            self.pending_client = None
+            connected = client in self.clients
+
+        if connected:
+            client.forward_to_client(packet)
+        self.arbiter.release()
+        self._send_next()
 
 
 class ApduClient(IODevice):
-    def __init__(self, sock: socket.socket):
+    def __init__(self, sock: socket.socket, server: ApduServer | None = None, address: Any = None):
         self._socket = sock
+        self._server = server
+        self.name = f"{address[0]}:{address[1]}" if isinstance(address, tuple) else str(address)
+        # APDUs received from this client, not sent to the app yet
+        self.queue: deque[bytes] = deque()
         self.logger = logging.getLogger("apdu")
 
     @property
@@ -90,10 +233,15 @@ class ApduClient(IODevice):
         if packet is None:
             screen.remove_notifier(self.fileno)
             self.file.close()
+            if self._server is not None:
+                self._server.remove_client(self)
             return
 
-        self.logger.info(f"> {packet.hex()}")
-        screen.display.forward_to_app(packet)
+        if self._server is not None:
+            self._server.queue_apdu(self, packet)
+        else:
+            self.logger.info(f"> {packet.hex()}")
+            screen.display.forward_to_app(packet)
 
     def forward_to_client(self, packet):
         """Encode and forward APDU to the client."""
@@ -1,6 +1,8 @@
+import heapq
 import json
 import logging
 import re
+from dataclasses import dataclass
 from pathlib import Path
 
 import jsonschema
@@ -8,10 +10,36 @@ import jsonschema
 from speculos.resources_importer import get_resources_path
 
 
+@dataclass
+class CompiledRule:
+    index: int
+    actions: list | None
+    regexp: re.Pattern | None = None
+    x: int | None = None
+    y: int | None = None
+    # The rule applies if (variables & conditions_mask) == conditions_value
+    conditions_mask: int = 0
+    conditions_value: int = 0
+    # Conflicting conditions on the same variable, the rule never applies
+    never: bool = False
+
+
 class Automation:
+    """
+    The rules are compiled once, when they are loaded:
+
+    - rules with a "text" key are indexed by their text,
+    - the regular expressions of the rules with a "regexp" key only are
+      combined into a single one, which discards most of the texts at once,
+    - conditions are bitmasks over the variables.
+
+    The first rule (in the document order) matching a text event still wins.
+    """
+
     def __init__(self, document):
         self.logger = logging.getLogger("automation")
-        self.variables = {}
+        self.variables = 0
+        self.variable_bits: dict[str, int] = {}
 
         if document.startswith("file:"):
             path = Path(document[5:]).resolve()
@@ -22,6 +50,7 @@ class Automation:
         else:
             self.json = json.loads(document)
         self.validate()
+        self.compile()
 
     def validate(self):
         path = get_resources_path("mcu", "automation.schema")
@@ -29,34 +58,83 @@ class Automation:
             schema = json.load(fp)
         jsonschema.validate(instance=self.json, schema=schema)
 
+    def _variable_bit(self, key: str) -> int:
+        if key not in self.variable_bits:
+            self.variable_bits[key] = 1 << len(self.variable_bits)
+        return self.variable_bits[key]
+
+    def compile(self):
+        """Build the lookup tables, raise re.error if a regexp is invalid."""
+
+        self.text_rules: dict[str, list[CompiledRule]] = {}
+        self.regexp_rules: list[CompiledRule] = []
+        self.other_rules: list[CompiledRule] = []
+
+        combinable = []
+        for index, rule in enumerate(self.json["rules"]):
+            compiled = CompiledRule(index, rule.get("actions"), x=rule.get("x"), y=rule.get("y"))
+            if "regexp" in rule:
+                compiled.regexp = re.compile(rule["regexp"])
+            for key, value in rule.get("conditions", []):
+                bit = self._variable_bit(key)
+                if compiled.conditions_mask & bit and bool(compiled.conditions_value & bit) != value:
+                    compiled.never = True
+                compiled.conditions_mask |= bit
+                if value:
+                    compiled.conditions_value |= bit
+
+            if "text" in rule:
+                self.text_rules.setdefault(rule["text"], []).append(compiled)
+            elif compiled.regexp is not None:
+                self.regexp_rules.append(compiled)
+                combinable.append(rule["regexp"])
+            else:
+                self.other_rules.append(compiled)
+
+        # Patterns with groups (which may be referenced by number) or global
+        # flags can't be combined, skip the prefilter in that case
+        self.regexp_filter: re.Pattern | None = None
+        if combinable:
+            try:
+                regexp_filter = re.compile("|".join(f"(?:{pattern})" for pattern in combinable))
+            except re.error:
+                pass
+            else:
+                if not any(rule.regexp.groups for rule in self.regexp_rules):  # type: ignore[union-attr]
+                    self.regexp_filter = regexp_filter
+
     def set_bool(self, key, value):
-        self.variables[key] = value
+        bit = self._variable_bit(key)
+        if value:
+            self.variables |= bit
+        else:
+            self.variables &= ~bit
+
+    def _candidates(self, text):
+        """Rules whose text criteria match, ordered by their index."""
+
+        candidates = [self.text_rules.get(text, []), self.other_rules]
+        if self.regexp_rules and (self.regexp_filter is None or self.regexp_filter.match(text)):
+            candidates.append(self.regexp_rules)
+        return heapq.merge(*candidates, key=lambda rule: rule.index)
 
     def get_actions(self, text, x, y):
         self.logger.debug(f'getting actions for "{text}" ({x}, {y})')
 
-        for rule in self.json["rules"]:
-            if "text" in rule and rule["text"] != text:
+        for rule in self._candidates(text):
+            if rule.regexp is not None and not rule.regexp.match(text):
                 continue
-            if "regexp" in rule and not re.match(rule["regexp"], text):
+            if rule.x is not None and rule.x != x:
                 continue
-            if "x" in rule and rule["x"] != x:
+            if rule.y is not None and rule.y != y:
                 continue
-            if "y" in rule and rule["y"] != y:
+            if rule.never or self.variables & rule.conditions_mask != rule.conditions_value:
                 continue
-            if "conditions" in rule:
-                condition = True
-                for key, value in rule["conditions"]:
-                    if self.variables.get(key, False) != value:
-                        condition = False
-                        break
-                if not condition:
-                    continue
-
-            if "actions" not in rule:
-                self.logger.warning(f'missing "actions" key for rule {rule}')
+
+            if rule.actions is None:
+                self.logger.warning(f'missing "actions" key for rule {self.json["rules"][rule.index]}')
                 continue
 
-            return rule["actions"]
+            return rule.actions
 
         return []
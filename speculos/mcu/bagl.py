@@ -110,7 +110,7 @@ class Bagl(GraphicLibrary):
         height: int,
         colors: list[int],
         bpp: int,
-        bitmap: list[int],
+        bitmap: bytes | list[int],
         restore: tuple[int, int] | None = None,
     ) -> None:
         if bpp == 3 or bpp > 4:
@@ -130,9 +130,11 @@ class Bagl(GraphicLibrary):
         requested_yh = height + y
         xx, yy = restore if restore else (x, y)
 
-        bitmap = list(bitmap)
-        while bitmap or yy < requested_yh:
-            ch = bitmap.pop(0) if bitmap else 0  # 0 = transparent pixel optimized out
+        bitmap_length = len(bitmap)
+        index = 0
+        while index < bitmap_length or yy < requested_yh:
+            ch = bitmap[index] if index < bitmap_length else 0  # 0 = transparent pixel optimized out
+            index += 1
             xx, yy, done = self._draw_bitmap_byte(ch, xx, yy, x, requested_xw, requested_yh, bpp, pixel_mask, colors)
             if done:
                 self.draw_state = DrawState(x, y, width, height, colors, bpp, xx, yy)
@@ -755,7 +757,7 @@ class Bagl(GraphicLibrary):
                 colors.append(color)
             bitmap = data[14 + color_size :]
 
-            self.hal_draw_bitmap_within_rect(x, y, w, h, colors, bpp, list(bitmap))
+            self.hal_draw_bitmap_within_rect(x, y, w, h, colors, bpp, bitmap)
 
         else:
             bitmap = data[1:]
@@ -768,4 +770,4 @@ class Bagl(GraphicLibrary):
             bpp = self.draw_state.bpp
             restore = (self.draw_state.xx, self.draw_state.yy)
 
-            self.hal_draw_bitmap_within_rect(x, y, w, h, colors, bpp, list(bitmap), restore)
+            self.hal_draw_bitmap_within_rect(x, y, w, h, colors, bpp, bitmap, restore)
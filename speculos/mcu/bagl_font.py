@@ -1,4 +1,15 @@
+"""
+BAGL fonts, used to render text on Nano devices and to find characters back from their bitmaps.
+
+Fonts are stored in a binary font pack (speculos/fonts/bagl-fonts.bin, built by tools/bagl-font-pack.py) which is
+only mapped in memory the first time a font is needed. Bitmaps are views of this mapping: they are shared by every
+emulator running on the host instead of being materialized as Python objects by each of them.
+"""
+
+import mmap
+import struct
 from collections import namedtuple
+from pathlib import Path
 
 BAGL_FONT_ID_MASK = 0x0FFF
 
@@ -49,46294 +60,62 @@ Font = namedtuple(
 )
 FontCharacter = namedtuple("FontCharacter", "char_width bitmap_byte_count bitmap_offset")
 
-bitmapLUCIDA_CONSOLE_6PT_8H = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x84,
-    0x10,
-    0x02,
-    0x08,
-    0x00,
-    0x4A,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x7E,
-    0xF5,
-    0x0B,
-    0x00,
-    0xC4,
-    0x19,
-    0xC2,
-    0x1C,
-    0x01,
-    0xB2,
-    0x3A,
-    0x57,
-    0x13,
-    0x00,
-    0x44,
-    0x99,
-    0x9A,
-    0x2C,
-    0x00,
-    0x84,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x98,
-    0x08,
-    0x21,
-    0x08,
-    0x06,
-    0x83,
-    0x20,
-    0x84,
-    0xC8,
-    0x00,
-    0x44,
-    0x11,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE2,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x08,
-    0x11,
-    0x00,
-    0x00,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x08,
-    0x00,
-    0x10,
-    0x21,
-    0x42,
-    0x84,
-    0x00,
-    0x4C,
-    0x4A,
-    0x29,
-    0x19,
-    0x00,
-    0xC4,
-    0x10,
-    0x42,
-    0x1C,
-    0x00,
-    0x06,
-    0x21,
-    0x22,
-    0x1C,
-    0x00,
-    0x06,
-    0x19,
-    0x84,
-    0x0C,
-    0x00,
-    0x88,
-    0x29,
-    0x8F,
-    0x10,
-    0x00,
-    0x4E,
-    0x18,
-    0x84,
-    0x0C,
-    0x00,
-    0x4C,
-    0x38,
-    0x29,
-    0x19,
-    0x00,
-    0x1E,
-    0x22,
-    0x42,
-    0x08,
-    0x00,
-    0x4C,
-    0x32,
-    0x29,
-    0x19,
-    0x00,
-    0x4C,
-    0x4A,
-    0x0E,
-    0x19,
-    0x00,
-    0x00,
-    0x10,
-    0x00,
-    0x08,
-    0x00,
-    0x00,
-    0x10,
-    0x00,
-    0x08,
-    0x11,
-    0x00,
-    0x22,
-    0x83,
-    0x20,
-    0x00,
-    0x00,
-    0x78,
-    0xE0,
-    0x01,
-    0x00,
-    0x40,
-    0x10,
-    0x4C,
-    0x04,
-    0x00,
-    0x0E,
-    0x22,
-    0x02,
-    0x08,
-    0x00,
-    0x4C,
-    0xE6,
-    0xDA,
-    0x83,
-    0x07,
-    0x80,
-    0x28,
-    0xF5,
-    0x23,
-    0x00,
-    0xC0,
-    0x29,
-    0xA3,
-    0x1C,
-    0x00,
-    0x80,
-    0x0B,
-    0x21,
-    0x38,
-    0x00,
-    0xC0,
-    0x49,
-    0x29,
-    0x1D,
-    0x00,
-    0xC0,
-    0x09,
-    0x27,
-    0x1C,
-    0x00,
-    0xC0,
-    0x09,
-    0x27,
-    0x04,
-    0x00,
-    0x80,
-    0x0B,
-    0x2D,
-    0x39,
-    0x00,
-    0x40,
-    0x4A,
-    0x2F,
-    0x25,
-    0x00,
-    0xC0,
-    0x11,
-    0x42,
-    0x1C,
-    0x00,
-    0xC0,
-    0x21,
-    0x84,
-    0x0C,
-    0x00,
-    0x40,
-    0x2A,
-    0xA3,
-    0x24,
-    0x00,
-    0x40,
-    0x08,
-    0x21,
-    0x3C,
-    0x00,
-    0x20,
-    0xEE,
-    0x5A,
-    0x23,
-    0x00,
-    0x40,
-    0x5A,
-    0x2D,
-    0x25,
-    0x00,
-    0xC0,
-    0xC5,
-    0x18,
-    0x1D,
-    0x00,
-    0xC0,
-    0x49,
-    0x27,
-    0x04,
-    0x00,
-    0xC0,
-    0xC5,
-    0x18,
-    0x1D,
-    0x82,
-    0xC0,
-    0x28,
-    0xA3,
-    0x24,
-    0x00,
-    0x80,
-    0x09,
-    0x82,
-    0x0C,
-    0x00,
-    0xE0,
-    0x13,
-    0x42,
-    0x08,
-    0x00,
-    0x40,
-    0x4A,
-    0x29,
-    0x19,
-    0x00,
-    0x40,
-    0x4A,
-    0xC9,
-    0x18,
-    0x00,
-    0x20,
-    0xD6,
-    0xAA,
-    0x14,
-    0x00,
-    0x20,
-    0x2A,
-    0xA2,
-    0x22,
-    0x00,
-    0x20,
-    0x2A,
-    0x42,
-    0x08,
-    0x00,
-    0xC0,
-    0x43,
-    0x26,
-    0x3C,
-    0x00,
-    0x8C,
-    0x10,
-    0x42,
-    0x08,
-    0x03,
-    0x41,
-    0x08,
-    0x42,
-    0x10,
-    0x02,
-    0x86,
-    0x10,
-    0x42,
-    0x88,
-    0x01,
-    0x44,
-    0xA9,
-    0x18,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x07,
-    0x82,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x18,
-    0xE4,
-    0x3C,
-    0x00,
-    0x42,
-    0x38,
-    0x29,
-    0x1D,
-    0x00,
-    0x00,
-    0x30,
-    0x21,
-    0x18,
-    0x00,
-    0x08,
-    0xB9,
-    0x94,
-    0x1C,
-    0x00,
-    0x00,
-    0x10,
-    0x27,
-    0x18,
-    0x00,
-    0x98,
-    0x78,
-    0x42,
-    0x08,
-    0x00,
-    0x00,
-    0x70,
-    0xE9,
-    0xA1,
-    0x03,
-    0x42,
-    0x28,
-    0x2B,
-    0x25,
-    0x00,
-    0x04,
-    0x18,
-    0x42,
-    0x08,
-    0x00,
-    0x08,
-    0x38,
-    0x84,
-    0x90,
-    0x01,
-    0x42,
-    0x28,
-    0xA3,
-    0x24,
-    0x00,
-    0x86,
-    0x10,
-    0x42,
-    0x08,
-    0x00,
-    0x00,
-    0xD4,
-    0x5F,
-    0x2B,
-    0x00,
-    0x00,
-    0x28,
-    0x2B,
-    0x25,
-    0x00,
-    0x00,
-    0x30,
-    0x29,
-    0x19,
-    0x00,
-    0x00,
-    0x38,
-    0x29,
-    0x9D,
-    0x00,
-    0x00,
-    0xB8,
-    0x94,
-    0x1C,
-    0x02,
-    0x00,
-    0x28,
-    0x23,
-    0x04,
-    0x00,
-    0x00,
-    0x30,
-    0x83,
-    0x0C,
-    0x00,
-    0x80,
-    0x78,
-    0x42,
-    0x10,
-    0x00,
-    0x00,
-    0x48,
-    0xA9,
-    0x29,
-    0x00,
-    0x00,
-    0x48,
-    0xC9,
-    0x18,
-    0x00,
-    0x00,
-    0xD4,
-    0xEA,
-    0x14,
-    0x00,
-    0x00,
-    0x48,
-    0xC6,
-    0x24,
-    0x00,
-    0x00,
-    0x48,
-    0xC9,
-    0xD8,
-    0x01,
-    0x00,
-    0x38,
-    0x26,
-    0x1C,
-    0x00,
-    0x88,
-    0x10,
-    0x41,
-    0x08,
-    0x02,
-    0x84,
-    0x10,
-    0x42,
-    0x08,
-    0x01,
-    0x82,
-    0x10,
-    0x44,
-    0x88,
-    0x00,
-    0x00,
-    0x00,
-    0x9B,
-    0x00,
-    0x00,
-    0xC0,
-    0x29,
-    0xA5,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x40,
-    0x08,
-    0x01,
-    0x80,
-    0x38,
-    0xE1,
-    0x08,
-    0x00,
-    0x80,
-    0x08,
-    0x33,
-    0x1C,
-    0x00,
-    0x20,
-    0x3A,
-    0xE5,
-    0x22,
-    0x00,
-    0x20,
-    0x2A,
-    0xE2,
-    0x08,
-    0x00,
-    0x84,
-    0x10,
-    0x00,
-    0x08,
-    0x21,
-    0x4C,
-    0x10,
-    0x45,
-    0x90,
-    0x01,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2E,
-    0xF6,
-    0xDA,
-    0xA3,
-    0x03,
-    0x06,
-    0x39,
-    0xE5,
-    0x00,
-    0x00,
-    0x80,
-    0xAA,
-    0xA2,
-    0x28,
-    0x00,
-    0x00,
-    0x00,
-    0x87,
-    0x10,
-    0x00,
-    0x00,
-    0x00,
-    0x07,
-    0x00,
-    0x00,
-    0xAE,
-    0xF7,
-    0xDA,
-    0x1D,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x4C,
-    0x4A,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x47,
-    0x1C,
-    0x00,
-    0x06,
-    0x11,
-    0xE1,
-    0x00,
-    0x00,
-    0x06,
-    0x19,
-    0x64,
-    0x00,
-    0x00,
-    0x88,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x48,
-    0xA9,
-    0xAD,
-    0x00,
-    0x6E,
-    0x2D,
-    0xA5,
-    0x94,
-    0x02,
-    0x00,
-    0x00,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x11,
-    0x86,
-    0x10,
-    0xE2,
-    0x00,
-    0x00,
-    0x44,
-    0x29,
-    0x45,
-    0x00,
-    0x00,
-    0xA0,
-    0x28,
-    0xAA,
-    0x0A,
-    0x00,
-    0x53,
-    0x29,
-    0xAA,
-    0x23,
-    0x00,
-    0x53,
-    0x79,
-    0xAA,
-    0x32,
-    0x00,
-    0x73,
-    0xA9,
-    0xAB,
-    0x23,
-    0x00,
-    0x80,
-    0x00,
-    0x42,
-    0x90,
-    0x01,
-    0x82,
-    0x28,
-    0xF5,
-    0x23,
-    0x00,
-    0x88,
-    0x28,
-    0xF5,
-    0x23,
-    0x00,
-    0x4C,
-    0x12,
-    0xF5,
-    0x23,
-    0x00,
-    0x36,
-    0x11,
-    0xF5,
-    0x23,
-    0x00,
-    0x8A,
-    0x28,
-    0xF5,
-    0x23,
-    0x00,
-    0x44,
-    0x11,
-    0xF5,
-    0x23,
-    0x00,
-    0x80,
-    0x2B,
-    0xFD,
-    0x32,
-    0x00,
-    0x80,
-    0x0B,
-    0x21,
-    0x38,
-    0x22,
-    0xC1,
-    0x09,
-    0x27,
-    0x1C,
-    0x00,
-    0xD0,
-    0x09,
-    0x27,
-    0x1C,
-    0x00,
-    0xCE,
-    0x09,
-    0x27,
-    0x1C,
-    0x00,
-    0xD1,
-    0x09,
-    0x27,
-    0x1C,
-    0x00,
-    0xC1,
-    0x11,
-    0x42,
-    0x1C,
-    0x00,
-    0xD0,
-    0x11,
-    0x42,
-    0x1C,
-    0x00,
-    0xCE,
-    0x11,
-    0x42,
-    0x1C,
-    0x00,
-    0xD1,
-    0x11,
-    0x42,
-    0x1C,
-    0x00,
-    0xC0,
-    0xC9,
-    0x2B,
-    0x1D,
-    0x00,
-    0x5F,
-    0x5A,
-    0x2D,
-    0x25,
-    0x00,
-    0xC1,
-    0xC5,
-    0x18,
-    0x1D,
-    0x00,
-    0xD0,
-    0xC5,
-    0x18,
-    0x1D,
-    0x00,
-    0xCE,
-    0xC5,
-    0x18,
-    0x1D,
-    0x00,
-    0xCF,
-    0xC5,
-    0x18,
-    0x1D,
-    0x00,
-    0xD1,
-    0xC5,
-    0x18,
-    0x1D,
-    0x00,
-    0x00,
-    0x48,
-    0xC6,
-    0x24,
-    0x00,
-    0xD0,
-    0xE5,
-    0x3A,
-    0x5D,
-    0x00,
-    0x41,
-    0x4A,
-    0x29,
-    0x19,
-    0x00,
-    0x30,
-    0xA5,
-    0x94,
-    0x0C,
-    0x00,
-    0x5E,
-    0x4A,
-    0x29,
-    0x19,
-    0x00,
-    0x49,
-    0x4A,
-    0x29,
-    0x19,
-    0x00,
-    0xA8,
-    0x2A,
-    0x42,
-    0x08,
-    0x00,
-    0x40,
-    0x38,
-    0xE9,
-    0x04,
-    0x00,
-    0x44,
-    0x29,
-    0x25,
-    0x15,
-    0x00,
-    0x41,
-    0x18,
-    0xE4,
-    0x3C,
-    0x00,
-    0x10,
-    0x19,
-    0xE4,
-    0x3C,
-    0x00,
-    0x4C,
-    0x1A,
-    0xE4,
-    0x3C,
-    0x00,
-    0x36,
-    0x19,
-    0xE4,
-    0x3C,
-    0x00,
-    0x0A,
-    0x18,
-    0xE4,
-    0x3C,
-    0x00,
-    0x44,
-    0x19,
-    0xE4,
-    0x3C,
-    0x00,
-    0x00,
-    0x2C,
-    0x7E,
-    0x32,
-    0x00,
-    0x00,
-    0x30,
-    0x21,
-    0x18,
-    0x22,
-    0x41,
-    0x10,
-    0x27,
-    0x18,
-    0x00,
-    0x10,
-    0x11,
-    0x27,
-    0x18,
-    0x00,
-    0x4C,
-    0x12,
-    0x27,
-    0x18,
-    0x00,
-    0x0A,
-    0x10,
-    0x27,
-    0x18,
-    0x00,
-    0x41,
-    0x18,
-    0x42,
-    0x08,
-    0x00,
-    0x10,
-    0x19,
-    0x42,
-    0x08,
-    0x00,
-    0x4C,
-    0x1A,
-    0x42,
-    0x08,
-    0x00,
-    0x0A,
-    0x18,
-    0x42,
-    0x08,
-    0x00,
-    0x8F,
-    0xB8,
-    0x94,
-    0x0C,
-    0x00,
-    0x1E,
-    0x28,
-    0x2B,
-    0x25,
-    0x00,
-    0x41,
-    0x30,
-    0x29,
-    0x19,
-    0x00,
-    0x10,
-    0x31,
-    0x29,
-    0x19,
-    0x00,
-    0x26,
-    0x31,
-    0x29,
-    0x19,
-    0x00,
-    0x36,
-    0x31,
-    0x29,
-    0x19,
-    0x00,
-    0x12,
-    0x30,
-    0x29,
-    0x19,
-    0x00,
-    0x80,
-    0x00,
-    0x07,
-    0x08,
-    0x00,
-    0x00,
-    0x32,
-    0x6D,
-    0x99,
-    0x00,
-    0x82,
-    0x48,
-    0xA9,
-    0x29,
-    0x00,
-    0x10,
-    0x49,
-    0xA9,
-    0x29,
-    0x00,
-    0x26,
-    0x49,
-    0xA9,
-    0x29,
-    0x00,
-    0x12,
-    0x48,
-    0xA9,
-    0x29,
-    0x00,
-    0x10,
-    0x49,
-    0xC9,
-    0xD8,
-    0x00,
-    0x42,
-    0x38,
-    0x29,
-    0x9D,
-    0x00,
-    0x12,
-    0x48,
-    0xC9,
-    0xD8,
-    0x01,
-]
-
-charactersLUCIDA_CONSOLE_6PT_8H = [
-    FontCharacter(5, 5, 0),
-    FontCharacter(5, 5, 5),
-    FontCharacter(5, 5, 10),
-    FontCharacter(5, 5, 15),
-    FontCharacter(5, 5, 20),
-    FontCharacter(5, 5, 25),
-    FontCharacter(5, 5, 30),
-    FontCharacter(5, 5, 35),
-    FontCharacter(5, 5, 40),
-    FontCharacter(5, 5, 45),
-    FontCharacter(5, 5, 50),
-    FontCharacter(5, 5, 55),
-    FontCharacter(5, 5, 60),
-    FontCharacter(5, 5, 65),
-    FontCharacter(5, 5, 70),
-    FontCharacter(5, 5, 75),
-    FontCharacter(5, 5, 80),
-    FontCharacter(5, 5, 85),
-    FontCharacter(5, 5, 90),
-    FontCharacter(5, 5, 95),
-    FontCharacter(5, 5, 100),
-    FontCharacter(5, 5, 105),
-    FontCharacter(5, 5, 110),
-    FontCharacter(5, 5, 115),
-    FontCharacter(5, 5, 120),
-    FontCharacter(5, 5, 125),
-    FontCharacter(5, 5, 130),
-    FontCharacter(5, 5, 135),
-    FontCharacter(5, 5, 140),
-    FontCharacter(5, 5, 145),
-    FontCharacter(5, 5, 150),
-    FontCharacter(5, 5, 155),
-    FontCharacter(5, 5, 160),
-    FontCharacter(5, 5, 165),
-    FontCharacter(5, 5, 170),
-    FontCharacter(5, 5, 175),
-    FontCharacter(5, 5, 180),
-    FontCharacter(5, 5, 185),
-    FontCharacter(5, 5, 190),
-    FontCharacter(5, 5, 195),
-    FontCharacter(5, 5, 200),
-    FontCharacter(5, 5, 205),
-    FontCharacter(5, 5, 210),
-    FontCharacter(5, 5, 215),
-    FontCharacter(5, 5, 220),
-    FontCharacter(5, 5, 225),
-    FontCharacter(5, 5, 230),
-    FontCharacter(5, 5, 235),
-    FontCharacter(5, 5, 240),
-    FontCharacter(5, 5, 245),
-    FontCharacter(5, 5, 250),
-    FontCharacter(5, 5, 255),
-    FontCharacter(5, 5, 260),
-    FontCharacter(5, 5, 265),
-    FontCharacter(5, 5, 270),
-    FontCharacter(5, 5, 275),
-    FontCharacter(5, 5, 280),
-    FontCharacter(5, 5, 285),
-    FontCharacter(5, 5, 290),
-    FontCharacter(5, 5, 295),
-    FontCharacter(5, 5, 300),
-    FontCharacter(5, 5, 305),
-    FontCharacter(5, 5, 310),
-    FontCharacter(5, 5, 315),
-    FontCharacter(5, 5, 320),
-    FontCharacter(5, 5, 325),
-    FontCharacter(5, 5, 330),
-    FontCharacter(5, 5, 335),
-    FontCharacter(5, 5, 340),
-    FontCharacter(5, 5, 345),
-    FontCharacter(5, 5, 350),
-    FontCharacter(5, 5, 355),
-    FontCharacter(5, 5, 360),
-    FontCharacter(5, 5, 365),
-    FontCharacter(5, 5, 370),
-    FontCharacter(5, 5, 375),
-    FontCharacter(5, 5, 380),
-    FontCharacter(5, 5, 385),
-    FontCharacter(5, 5, 390),
-    FontCharacter(5, 5, 395),
-    FontCharacter(5, 5, 400),
-    FontCharacter(5, 5, 405),
-    FontCharacter(5, 5, 410),
-    FontCharacter(5, 5, 415),
-    FontCharacter(5, 5, 420),
-    FontCharacter(5, 5, 425),
-    FontCharacter(5, 5, 430),
-    FontCharacter(5, 5, 435),
-    FontCharacter(5, 5, 440),
-    FontCharacter(5, 5, 445),
-    FontCharacter(5, 5, 450),
-    FontCharacter(5, 5, 455),
-    FontCharacter(5, 5, 460),
-    FontCharacter(5, 5, 465),
-    FontCharacter(5, 5, 470),
-    FontCharacter(5, 5, 475),
-    FontCharacter(5, 5, 480),
-    FontCharacter(5, 5, 485),
-    FontCharacter(5, 5, 490),
-    FontCharacter(5, 5, 495),
-    FontCharacter(5, 5, 500),
-    FontCharacter(5, 5, 505),
-    FontCharacter(5, 5, 510),
-    FontCharacter(5, 5, 515),
-    FontCharacter(5, 5, 520),
-    FontCharacter(5, 5, 525),
-    FontCharacter(5, 5, 530),
-    FontCharacter(5, 5, 535),
-    FontCharacter(5, 5, 540),
-    FontCharacter(5, 5, 545),
-    FontCharacter(5, 5, 550),
-    FontCharacter(5, 5, 555),
-    FontCharacter(5, 5, 560),
-    FontCharacter(5, 5, 565),
-    FontCharacter(5, 5, 570),
-    FontCharacter(5, 5, 575),
-    FontCharacter(5, 5, 580),
-    FontCharacter(5, 5, 585),
-    FontCharacter(5, 5, 590),
-    FontCharacter(5, 5, 595),
-    FontCharacter(5, 5, 600),
-    FontCharacter(5, 5, 605),
-    FontCharacter(5, 5, 610),
-    FontCharacter(5, 5, 615),
-    FontCharacter(5, 5, 620),
-    FontCharacter(5, 5, 625),
-    FontCharacter(5, 5, 630),
-    FontCharacter(5, 5, 635),
-    FontCharacter(5, 5, 640),
-    FontCharacter(5, 5, 645),
-    FontCharacter(5, 5, 650),
-    FontCharacter(5, 5, 655),
-    FontCharacter(5, 5, 660),
-    FontCharacter(5, 5, 665),
-    FontCharacter(5, 5, 670),
-    FontCharacter(5, 5, 675),
-    FontCharacter(5, 5, 680),
-    FontCharacter(5, 5, 685),
-    FontCharacter(5, 5, 690),
-    FontCharacter(5, 5, 695),
-    FontCharacter(5, 5, 700),
-    FontCharacter(5, 5, 705),
-    FontCharacter(5, 5, 710),
-    FontCharacter(5, 5, 715),
-    FontCharacter(5, 5, 720),
-    FontCharacter(5, 5, 725),
-    FontCharacter(5, 5, 730),
-    FontCharacter(5, 5, 735),
-    FontCharacter(5, 5, 740),
-    FontCharacter(5, 5, 745),
-    FontCharacter(5, 5, 750),
-    FontCharacter(5, 5, 755),
-    FontCharacter(5, 5, 760),
-    FontCharacter(5, 5, 765),
-    FontCharacter(5, 5, 770),
-    FontCharacter(5, 5, 775),
-    FontCharacter(5, 5, 780),
-    FontCharacter(5, 5, 785),
-    FontCharacter(5, 5, 790),
-    FontCharacter(5, 5, 795),
-    FontCharacter(5, 5, 800),
-    FontCharacter(5, 5, 805),
-    FontCharacter(5, 5, 810),
-    FontCharacter(5, 5, 815),
-    FontCharacter(5, 5, 820),
-    FontCharacter(5, 5, 825),
-    FontCharacter(5, 5, 830),
-    FontCharacter(5, 5, 835),
-    FontCharacter(5, 5, 840),
-    FontCharacter(5, 5, 845),
-    FontCharacter(5, 5, 850),
-    FontCharacter(5, 5, 855),
-    FontCharacter(5, 5, 860),
-    FontCharacter(5, 5, 865),
-    FontCharacter(5, 5, 870),
-    FontCharacter(5, 5, 875),
-    FontCharacter(5, 5, 880),
-    FontCharacter(5, 5, 885),
-    FontCharacter(5, 5, 890),
-    FontCharacter(5, 5, 895),
-    FontCharacter(5, 5, 900),
-    FontCharacter(5, 5, 905),
-    FontCharacter(5, 5, 910),
-    FontCharacter(5, 5, 915),
-    FontCharacter(5, 5, 920),
-    FontCharacter(5, 5, 925),
-    FontCharacter(5, 5, 930),
-    FontCharacter(5, 5, 935),
-    FontCharacter(5, 5, 940),
-    FontCharacter(5, 5, 945),
-    FontCharacter(5, 5, 950),
-    FontCharacter(5, 5, 955),
-]
-
-bitmapOPEN_SANS_LIGHT_16_22PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x10,
-    0x1F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x0B,
-    0x00,
-    0xB0,
-    0x00,
-    0x00,
-    0x0B,
-    0x00,
-    0xB0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x3F,
-    0x00,
-    0xF3,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x8A,
-    0x80,
-    0x0A,
-    0x90,
-    0x07,
-    0x97,
-    0x00,
-    0x68,
-    0x50,
-    0x08,
-    0x70,
-    0x05,
-    0x75,
-    0x00,
-    0x35,
-    0x30,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x07,
-    0x00,
-    0x3A,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x04,
-    0x00,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x01,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x00,
-    0x20,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0xA2,
-    0x00,
-    0x60,
-    0x07,
-    0x00,
-    0x60,
-    0xDD,
-    0xEE,
-    0xDD,
-    0xFD,
-    0xDD,
-    0x4D,
-    0x00,
-    0x00,
-    0x49,
-    0x00,
-    0xC0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0C,
-    0x00,
-    0xC1,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0C,
-    0x00,
-    0x85,
-    0x00,
-    0x00,
-    0xD4,
-    0xED,
-    0xDE,
-    0xDD,
-    0xEF,
-    0xDD,
-    0x08,
-    0x00,
-    0x80,
-    0x05,
-    0x00,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x02,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x20,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x00,
-    0x40,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0xA3,
-    0x00,
-    0x80,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xFB,
-    0xEE,
-    0x6B,
-    0x00,
-    0x00,
-    0xD6,
-    0x73,
-    0x05,
-    0x53,
-    0x00,
-    0x00,
-    0x3E,
-    0x70,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x70,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x4E,
-    0x70,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0xE5,
-    0x86,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xFA,
-    0x4B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xCA,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x05,
-    0xD7,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x05,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x70,
-    0x05,
-    0xF1,
-    0x00,
-    0x40,
-    0x27,
-    0x70,
-    0x35,
-    0x8D,
-    0x00,
-    0x10,
-    0xC8,
-    0xEE,
-    0xBE,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xEE,
-    0x09,
-    0x00,
-    0x00,
-    0xC1,
-    0x00,
-    0x00,
-    0x40,
-    0x0C,
-    0xA0,
-    0x07,
-    0x00,
-    0xA0,
-    0x04,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0xD2,
-    0x00,
-    0x30,
-    0x0B,
-    0x00,
-    0x00,
-    0xC0,
-    0x02,
-    0x00,
-    0x0F,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0xF0,
-    0x01,
-    0xA4,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x02,
-    0x00,
-    0x0F,
-    0xC0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0xD2,
-    0x60,
-    0x08,
-    0xD9,
-    0x6D,
-    0x00,
-    0x30,
-    0x0C,
-    0xA0,
-    0x07,
-    0x0D,
-    0x97,
-    0x00,
-    0x3C,
-    0x00,
-    0x60,
-    0xED,
-    0x09,
-    0x68,
-    0xD0,
-    0x02,
-    0x60,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0xC1,
-    0x00,
-    0x0F,
-    0x00,
-    0xC3,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x04,
-    0xF1,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x30,
-    0x0B,
-    0x00,
-    0x0F,
-    0x00,
-    0xC3,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0xD0,
-    0x02,
-    0x60,
-    0x09,
-    0x00,
-    0x00,
-    0xA4,
-    0x00,
-    0x00,
-    0xA7,
-    0x10,
-    0x3D,
-    0x00,
-    0x00,
-    0xC0,
-    0x01,
-    0x00,
-    0x00,
-    0xF9,
-    0x6E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0xEE,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x08,
-    0x20,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0E,
-    0x00,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0xB4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2E,
-    0x00,
-    0xB0,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x1D,
-    0xA0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xDD,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xAD,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x0A,
-    0x60,
-    0x2E,
-    0x00,
-    0x20,
-    0x0C,
-    0x50,
-    0x0B,
-    0x00,
-    0x60,
-    0x2E,
-    0x00,
-    0x68,
-    0x00,
-    0x6A,
-    0x00,
-    0x00,
-    0x60,
-    0x2E,
-    0xE1,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x60,
-    0xCE,
-    0x05,
-    0x00,
-    0xA7,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x2F,
-    0x00,
-    0x00,
-    0x8D,
-    0x01,
-    0x00,
-    0xD5,
-    0x58,
-    0x2D,
-    0x00,
-    0x00,
-    0xD8,
-    0xEE,
-    0x9D,
-    0x02,
-    0x40,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x70,
-    0x08,
-    0x70,
-    0x07,
-    0x50,
-    0x06,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x98,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x50,
-    0x0B,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0xE0,
-    0x03,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0xE0,
-    0x02,
-    0x00,
-    0xB0,
-    0x06,
-    0x00,
-    0x60,
-    0x0B,
-    0x00,
-    0x10,
-    0x2F,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0xE0,
-    0x03,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x89,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x60,
-    0x0A,
-    0x00,
-    0x30,
-    0x0E,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x20,
-    0x0E,
-    0x00,
-    0x60,
-    0x0B,
-    0x00,
-    0xB0,
-    0x06,
-    0x00,
-    0xF2,
-    0x01,
-    0x00,
-    0x99,
-    0x00,
-    0x30,
-    0x0E,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x90,
-    0x59,
-    0x71,
-    0x25,
-    0xA6,
-    0x09,
-    0x60,
-    0x98,
-    0xEB,
-    0xBD,
-    0x89,
-    0x05,
-    0x00,
-    0x00,
-    0xB3,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x3E,
-    0xD5,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0xC0,
-    0x0A,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x40,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0xB0,
-    0xDD,
-    0xED,
-    0xDE,
-    0xDD,
-    0x0B,
-    0x00,
-    0x00,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5F,
-    0x00,
-    0xF4,
-    0x00,
-    0x70,
-    0x0A,
-    0x00,
-    0x3C,
-    0x00,
-    0xB0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xDD,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x3F,
-    0x00,
-    0xF3,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x87,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x78,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x40,
-    0x0B,
-    0x00,
-    0x00,
-    0x6A,
-    0x00,
-    0x00,
-    0xE0,
-    0x00,
-    0x00,
-    0x50,
-    0x0A,
-    0x00,
-    0x00,
-    0x4B,
-    0x00,
-    0x00,
-    0xE1,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0xD2,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xEB,
-    0xBE,
-    0x03,
-    0x00,
-    0x00,
-    0xE5,
-    0x03,
-    0x30,
-    0x4D,
-    0x00,
-    0x00,
-    0x3E,
-    0x00,
-    0x00,
-    0xE3,
-    0x00,
-    0x50,
-    0x0C,
-    0x00,
-    0x00,
-    0xC0,
-    0x04,
-    0x80,
-    0x08,
-    0x00,
-    0x00,
-    0x80,
-    0x08,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x50,
-    0x0B,
-    0xB0,
-    0x04,
-    0x00,
-    0x00,
-    0x40,
-    0x0C,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0xB0,
-    0x04,
-    0x00,
-    0x00,
-    0x50,
-    0x0C,
-    0xA0,
-    0x05,
-    0x00,
-    0x00,
-    0x60,
-    0x0B,
-    0x80,
-    0x08,
-    0x00,
-    0x00,
-    0x80,
-    0x08,
-    0x40,
-    0x0C,
-    0x00,
-    0x00,
-    0xC0,
-    0x05,
-    0x00,
-    0x3E,
-    0x00,
-    0x00,
-    0xE3,
-    0x00,
-    0x00,
-    0xD4,
-    0x03,
-    0x30,
-    0x5E,
-    0x00,
-    0x00,
-    0x30,
-    0xEB,
-    0xBE,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x7B,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0x04,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x26,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0xED,
-    0xBE,
-    0x02,
-    0x00,
-    0x30,
-    0x6D,
-    0x00,
-    0x60,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD2,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x96,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA4,
-    0xDD,
-    0xBE,
-    0x04,
-    0x00,
-    0x90,
-    0x4B,
-    0x00,
-    0x40,
-    0x5E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA2,
-    0x0A,
-    0x00,
-    0x00,
-    0xB0,
-    0xFF,
-    0x9F,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x51,
-    0x8D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0x02,
-    0x90,
-    0x03,
-    0x00,
-    0x40,
-    0x7D,
-    0x00,
-    0x50,
-    0xEA,
-    0xEE,
-    0xAD,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC2,
-    0x1B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2D,
-    0x1B,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x06,
-    0x1B,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xC0,
-    0x04,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x88,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x30,
-    0x0C,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0xF8,
-    0xDD,
-    0xDD,
-    0xDD,
-    0xDF,
-    0xAD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x00,
-    0x00,
-    0x69,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xCF,
-    0xDD,
-    0xBE,
-    0x05,
-    0x00,
-    0x00,
-    0x02,
-    0x00,
-    0x30,
-    0xAC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0x02,
-    0x50,
-    0x16,
-    0x00,
-    0x40,
-    0x6D,
-    0x00,
-    0x20,
-    0xD9,
-    0xDE,
-    0xAE,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0xDD,
-    0x9D,
-    0x00,
-    0x00,
-    0x40,
-    0x5D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE2,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x17,
-    0xD9,
-    0xDD,
-    0x19,
-    0x00,
-    0x90,
-    0xB8,
-    0x03,
-    0x00,
-    0xD6,
-    0x01,
-    0x90,
-    0x0E,
-    0x00,
-    0x00,
-    0x80,
-    0x08,
-    0x90,
-    0x08,
-    0x00,
-    0x00,
-    0x30,
-    0x0C,
-    0x70,
-    0x08,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x30,
-    0x0C,
-    0x00,
-    0x00,
-    0x40,
-    0x0B,
-    0x00,
-    0x4D,
-    0x00,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0xE2,
-    0x06,
-    0x00,
-    0xB9,
-    0x00,
-    0x00,
-    0x20,
-    0xEA,
-    0xDD,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x97,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x4E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xEC,
-    0xCE,
-    0x06,
-    0x00,
-    0x00,
-    0xB8,
-    0x02,
-    0x20,
-    0x7C,
-    0x00,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0xE1,
-    0x00,
-    0x30,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x20,
-    0x0D,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x8B,
-    0x00,
-    0x00,
-    0x97,
-    0x00,
-    0x00,
-    0xA0,
-    0x3B,
-    0xA2,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0xEB,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0x05,
-    0x81,
-    0x5E,
-    0x00,
-    0x30,
-    0x1D,
-    0x00,
-    0x00,
-    0xE1,
-    0x03,
-    0xA0,
-    0x06,
-    0x00,
-    0x00,
-    0x60,
-    0x09,
-    0xB0,
-    0x04,
-    0x00,
-    0x00,
-    0x50,
-    0x0B,
-    0x80,
-    0x08,
-    0x00,
-    0x00,
-    0xA0,
-    0x07,
-    0x10,
-    0x7D,
-    0x00,
-    0x10,
-    0xD9,
-    0x00,
-    0x00,
-    0x91,
-    0xED,
-    0xCE,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xED,
-    0xAE,
-    0x02,
-    0x00,
-    0x00,
-    0x9A,
-    0x01,
-    0x50,
-    0x2E,
-    0x00,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xC3,
-    0x00,
-    0xA0,
-    0x04,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0xC0,
-    0x03,
-    0x00,
-    0x00,
-    0x80,
-    0x09,
-    0x90,
-    0x08,
-    0x00,
-    0x00,
-    0xE1,
-    0x09,
-    0x10,
-    0x6D,
-    0x00,
-    0x30,
-    0x8B,
-    0x09,
-    0x00,
-    0x91,
-    0xDD,
-    0x9C,
-    0x71,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE5,
-    0x04,
-    0x00,
-    0x00,
-    0xDC,
-    0xDD,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x2F,
-    0x00,
-    0xF3,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x3F,
-    0x00,
-    0xF3,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x2F,
-    0x00,
-    0xF3,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x1F,
-    0x00,
-    0xC5,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x1C,
-    0x00,
-    0xA0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xAC,
-    0x02,
-    0x00,
-    0x00,
-    0x30,
-    0xAB,
-    0x02,
-    0x00,
-    0x00,
-    0x30,
-    0xAB,
-    0x02,
-    0x00,
-    0x00,
-    0x20,
-    0xAA,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA3,
-    0x5C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x81,
-    0x7D,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x9D,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xDD,
-    0xDD,
-    0xDD,
-    0xDD,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xDD,
-    0xDD,
-    0xDD,
-    0xDD,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xCA,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xBA,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xBA,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xBA,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0x3A,
-    0x00,
-    0x00,
-    0x10,
-    0xD7,
-    0x19,
-    0x00,
-    0x00,
-    0x20,
-    0xD9,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xC7,
-    0xDD,
-    0x7C,
-    0x00,
-    0x61,
-    0x00,
-    0x10,
-    0x9A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0xA7,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0x00,
-    0x9A,
-    0x00,
-    0x00,
-    0x00,
-    0x97,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x03,
-    0x00,
-    0x00,
-    0x20,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xD9,
-    0xDE,
-    0xBE,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC2,
-    0x39,
-    0x00,
-    0x00,
-    0x93,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x2E,
-    0x00,
-    0x00,
-    0xD1,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x0C,
-    0x00,
-    0xA0,
-    0x04,
-    0x00,
-    0xB3,
-    0xDD,
-    0xAD,
-    0x00,
-    0xB0,
-    0x03,
-    0x20,
-    0x0C,
-    0x00,
-    0xC4,
-    0x02,
-    0x00,
-    0x0F,
-    0x00,
-    0x85,
-    0x00,
-    0x77,
-    0x00,
-    0xE0,
-    0x02,
-    0x00,
-    0xF0,
-    0x00,
-    0x20,
-    0x0B,
-    0xA0,
-    0x04,
-    0x40,
-    0x0C,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xB1,
-    0x00,
-    0x1B,
-    0x00,
-    0x96,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x10,
-    0x0B,
-    0xB0,
-    0x01,
-    0x60,
-    0x09,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x93,
-    0x00,
-    0x3B,
-    0x00,
-    0xC4,
-    0x00,
-    0x00,
-    0xD8,
-    0x00,
-    0x80,
-    0x05,
-    0x80,
-    0x06,
-    0x00,
-    0x5D,
-    0x00,
-    0xA4,
-    0x3B,
-    0x30,
-    0x0C,
-    0x00,
-    0xB3,
-    0x00,
-    0x20,
-    0xDB,
-    0x9D,
-    0x20,
-    0xDC,
-    0x1B,
-    0x00,
-    0x00,
-    0x4C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x9D,
-    0x03,
-    0x00,
-    0x30,
-    0x28,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB6,
-    0xEE,
-    0xDE,
-    0x6A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6C,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0xC0,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x07,
-    0xB6,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0xA0,
-    0x08,
-    0x00,
-    0x00,
-    0xD0,
-    0x04,
-    0x00,
-    0xE4,
-    0x00,
-    0x00,
-    0x40,
-    0x0E,
-    0x00,
-    0x00,
-    0x5D,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0B,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x00,
-    0xF1,
-    0x02,
-    0x80,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x8A,
-    0x00,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0E,
-    0xC5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0xC6,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xDD,
-    0xED,
-    0xBE,
-    0x06,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xC4,
-    0x0A,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xE0,
-    0x03,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x2E,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x40,
-    0x6B,
-    0x00,
-    0x00,
-    0xDD,
-    0xDD,
-    0xFD,
-    0x5D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x20,
-    0xC9,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x40,
-    0x0C,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xA0,
-    0x08,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x92,
-    0x0D,
-    0x00,
-    0xD0,
-    0xDD,
-    0xDD,
-    0xCE,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC7,
-    0xFE,
-    0xCE,
-    0x17,
-    0x00,
-    0x30,
-    0x9E,
-    0x02,
-    0x00,
-    0x83,
-    0x00,
-    0x20,
-    0x4E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x79,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x79,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x8E,
-    0x02,
-    0x00,
-    0x32,
-    0x00,
-    0x00,
-    0x10,
-    0xD9,
-    0xFF,
-    0xCE,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xDE,
-    0xED,
-    0xCE,
-    0x17,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x93,
-    0x5E,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x30,
-    0x4E,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x03,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7A,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x97,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x09,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x02,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0C,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x50,
-    0x2E,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0xA4,
-    0x3D,
-    0x00,
-    0x00,
-    0xD0,
-    0xDE,
-    0xED,
-    0xAD,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0B,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x03,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x05,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA5,
-    0xFE,
-    0xDF,
-    0x5A,
-    0x00,
-    0x00,
-    0x10,
-    0xAC,
-    0x03,
-    0x00,
-    0x51,
-    0x0A,
-    0x00,
-    0x10,
-    0x6E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x8A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE2,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x79,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x10,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x00,
-    0x79,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x5D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0x40,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x50,
-    0x8E,
-    0x03,
-    0x00,
-    0x30,
-    0x5D,
-    0x00,
-    0x00,
-    0x10,
-    0xC7,
-    0xEE,
-    0xDE,
-    0x5A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0xFD,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x10,
-    0x0E,
-    0x00,
-    0xB1,
-    0x08,
-    0xFD,
-    0x8E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x10,
-    0x5D,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x06,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x6B,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x8A,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x90,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0xF8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xAD,
-    0x99,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x8D,
-    0x00,
-    0x5D,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0xE3,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xE1,
-    0x03,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xED,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0xCD,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xDC,
-    0x00,
-    0x00,
-    0x7D,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0xD7,
-    0x00,
-    0x00,
-    0x2D,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0xD2,
-    0x00,
-    0x00,
-    0x1D,
-    0x88,
-    0x00,
-    0x00,
-    0x00,
-    0x87,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0xE2,
-    0x00,
-    0x00,
-    0x00,
-    0x2D,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0xB0,
-    0x04,
-    0x00,
-    0x40,
-    0x0B,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x50,
-    0x0B,
-    0x00,
-    0xA0,
-    0x05,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x1E,
-    0x00,
-    0xE1,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x88,
-    0x00,
-    0x87,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0xE1,
-    0x00,
-    0x2D,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0xB0,
-    0x44,
-    0x0B,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x40,
-    0xAB,
-    0x04,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xDE,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x88,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0xED,
-    0x02,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0xC5,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x0D,
-    0x6B,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x11,
-    0x2E,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x60,
-    0x0C,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0xB0,
-    0x06,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0xE1,
-    0x01,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xB6,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x6C,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x20,
-    0x1E,
-    0xD1,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x60,
-    0x1A,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xC0,
-    0xD6,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0xE2,
-    0x0D,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xD7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0xFD,
-    0xDF,
-    0x29,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x7E,
-    0x02,
-    0x20,
-    0xE7,
-    0x06,
-    0x00,
-    0x00,
-    0xE4,
-    0x02,
-    0x00,
-    0x00,
-    0x20,
-    0x4E,
-    0x00,
-    0x00,
-    0x5D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0x00,
-    0x00,
-    0xE4,
-    0x02,
-    0x00,
-    0x00,
-    0x20,
-    0x4E,
-    0x00,
-    0x00,
-    0x60,
-    0x7E,
-    0x01,
-    0x10,
-    0xE6,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x92,
-    0xFD,
-    0xDF,
-    0x29,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFD,
-    0xFF,
-    0xCF,
-    0x08,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x20,
-    0xD9,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xA0,
-    0x08,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x40,
-    0x0C,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x50,
-    0x0C,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xB0,
-    0x06,
-    0x00,
-    0x1D,
-    0x00,
-    0x40,
-    0xAB,
-    0x00,
-    0x00,
-    0xDD,
-    0xDD,
-    0xAD,
-    0x04,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0xFD,
-    0xDF,
-    0x29,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x7E,
-    0x02,
-    0x20,
-    0xE7,
-    0x06,
-    0x00,
-    0x00,
-    0xE4,
-    0x02,
-    0x00,
-    0x00,
-    0x20,
-    0x4E,
-    0x00,
-    0x00,
-    0x5D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0x00,
-    0x00,
-    0xE4,
-    0x02,
-    0x00,
-    0x00,
-    0x20,
-    0x4E,
-    0x00,
-    0x00,
-    0x60,
-    0x7E,
-    0x01,
-    0x10,
-    0xE6,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x92,
-    0xFD,
-    0xFF,
-    0x29,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xAD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFF,
-    0xFF,
-    0xCE,
-    0x07,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x20,
-    0xBA,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xC0,
-    0x06,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x70,
-    0x0A,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x50,
-    0x0B,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x80,
-    0x09,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x1F,
-    0x00,
-    0x40,
-    0x8C,
-    0x00,
-    0x00,
-    0xDF,
-    0xDD,
-    0xEE,
-    0x03,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0xE0,
-    0x03,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x60,
-    0x0C,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x6C,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xE3,
-    0x01,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD8,
-    0xEE,
-    0x9D,
-    0x02,
-    0x00,
-    0x8D,
-    0x01,
-    0x10,
-    0x36,
-    0x00,
-    0x97,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x9E,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xD7,
-    0x5C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xCB,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x0B,
-    0x60,
-    0x03,
-    0x00,
-    0x82,
-    0x2E,
-    0x00,
-    0xC7,
-    0xFE,
-    0xDF,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xDF,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x4C,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x0C,
-    0x00,
-    0x50,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x5C,
-    0x00,
-    0x00,
-    0xA0,
-    0x4C,
-    0x00,
-    0x30,
-    0x9C,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xEB,
-    0xED,
-    0x4B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x4C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0xA6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0xE1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1E,
-    0xA0,
-    0x05,
-    0x00,
-    0x00,
-    0x60,
-    0x0A,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0xE1,
-    0x00,
-    0x00,
-    0x79,
-    0x00,
-    0x00,
-    0x97,
-    0x00,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x70,
-    0x09,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0x10,
-    0x0E,
-    0xE0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x4B,
-    0xB4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x95,
-    0x59,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x0C,
-    0x00,
-    0x00,
-    0x30,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0x4B,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0xC8,
-    0x07,
-    0x00,
-    0x00,
-    0xE0,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0xD0,
-    0xB5,
-    0x00,
-    0x00,
-    0x40,
-    0x0B,
-    0x70,
-    0x09,
-    0x00,
-    0x10,
-    0x0D,
-    0x0E,
-    0x00,
-    0x00,
-    0x78,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x96,
-    0x90,
-    0x05,
-    0x00,
-    0xC0,
-    0x03,
-    0x00,
-    0x2E,
-    0x00,
-    0xA0,
-    0x04,
-    0x95,
-    0x00,
-    0x10,
-    0x0E,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0x0E,
-    0x00,
-    0x0E,
-    0x00,
-    0x95,
-    0x00,
-    0x00,
-    0xB5,
-    0x00,
-    0xB3,
-    0x00,
-    0xB0,
-    0x03,
-    0x90,
-    0x05,
-    0x00,
-    0x10,
-    0x0E,
-    0x80,
-    0x07,
-    0x00,
-    0x77,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0x2D,
-    0x00,
-    0x20,
-    0x0C,
-    0xC2,
-    0x00,
-    0x00,
-    0x00,
-    0x88,
-    0xD1,
-    0x00,
-    0x00,
-    0xD0,
-    0x71,
-    0x08,
-    0x00,
-    0x00,
-    0x30,
-    0x5C,
-    0x09,
-    0x00,
-    0x00,
-    0x59,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x4A,
-    0x00,
-    0x00,
-    0x40,
-    0xEA,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xEA,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x6B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x4C,
-    0x90,
-    0x08,
-    0x00,
-    0x00,
-    0xA6,
-    0x00,
-    0xE0,
-    0x02,
-    0x00,
-    0xD1,
-    0x01,
-    0x00,
-    0xB5,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0x00,
-    0x5B,
-    0x30,
-    0x0C,
-    0x00,
-    0x00,
-    0x20,
-    0x1E,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x8D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF4,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xD6,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x08,
-    0x88,
-    0x00,
-    0x00,
-    0x20,
-    0x0D,
-    0x00,
-    0x2D,
-    0x00,
-    0x00,
-    0x5C,
-    0x00,
-    0x50,
-    0x0C,
-    0x00,
-    0xB6,
-    0x00,
-    0x00,
-    0xB0,
-    0x06,
-    0xE1,
-    0x01,
-    0x00,
-    0x00,
-    0xE1,
-    0xA1,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xA7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0xE2,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x02,
-    0x7A,
-    0x00,
-    0x00,
-    0x60,
-    0x0A,
-    0x10,
-    0x1E,
-    0x00,
-    0x00,
-    0x1E,
-    0x00,
-    0x90,
-    0x08,
-    0x00,
-    0x87,
-    0x00,
-    0x00,
-    0xE1,
-    0x01,
-    0xE1,
-    0x01,
-    0x00,
-    0x00,
-    0x97,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x4E,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x6F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xFF,
-    0x7F,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0xFF,
-    0xFF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0xD2,
-    0x00,
-    0x00,
-    0x00,
-    0x2D,
-    0x00,
-    0x00,
-    0x70,
-    0x08,
-    0x00,
-    0x00,
-    0xE1,
-    0x00,
-    0x00,
-    0x00,
-    0x4B,
-    0x00,
-    0x00,
-    0x50,
-    0x0A,
-    0x00,
-    0x00,
-    0xE0,
-    0x00,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0x40,
-    0x0B,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x00,
-    0x78,
-    0x00,
-    0x00,
-    0x20,
-    0x0D,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0x00,
-    0x00,
-    0x87,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0xF7,
-    0xFF,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x2C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x49,
-    0xA4,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0C,
-    0xC0,
-    0x02,
-    0x00,
-    0x00,
-    0xA0,
-    0x04,
-    0x30,
-    0x0B,
-    0x00,
-    0x00,
-    0xB3,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0xC3,
-    0x00,
-    0x40,
-    0x0A,
-    0x00,
-    0x00,
-    0xA0,
-    0x04,
-    0xC0,
-    0x02,
-    0x00,
-    0x00,
-    0x20,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0xDD,
-    0xDD,
-    0xDD,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBA,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x87,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA4,
-    0xDD,
-    0x9D,
-    0x00,
-    0x00,
-    0x60,
-    0x04,
-    0x00,
-    0xA8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x39,
-    0x00,
-    0x10,
-    0xB7,
-    0xDD,
-    0xFD,
-    0x03,
-    0x20,
-    0x7D,
-    0x02,
-    0x00,
-    0x3B,
-    0x00,
-    0x5C,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x3E,
-    0x00,
-    0x2E,
-    0x00,
-    0x00,
-    0xF5,
-    0x03,
-    0x80,
-    0x1B,
-    0x00,
-    0xC6,
-    0x3B,
-    0x00,
-    0x80,
-    0xEE,
-    0x8D,
-    0x80,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0xD7,
-    0xEE,
-    0x4B,
-    0x00,
-    0x10,
-    0xAD,
-    0x08,
-    0x00,
-    0xD3,
-    0x06,
-    0x10,
-    0x9F,
-    0x00,
-    0x00,
-    0x10,
-    0x1E,
-    0x10,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x96,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x96,
-    0x10,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x10,
-    0x9F,
-    0x00,
-    0x00,
-    0x20,
-    0x0E,
-    0x10,
-    0xAC,
-    0x07,
-    0x00,
-    0xD3,
-    0x05,
-    0x10,
-    0x0A,
-    0xC6,
-    0xED,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xEA,
-    0xED,
-    0x1B,
-    0x00,
-    0xD4,
-    0x05,
-    0x00,
-    0x03,
-    0x00,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD5,
-    0x04,
-    0x00,
-    0x03,
-    0x00,
-    0x30,
-    0xEB,
-    0xED,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x40,
-    0xEB,
-    0xDE,
-    0x07,
-    0x0F,
-    0x00,
-    0xD5,
-    0x03,
-    0x00,
-    0xA8,
-    0x0D,
-    0x00,
-    0x2E,
-    0x00,
-    0x00,
-    0x90,
-    0x0F,
-    0x60,
-    0x0A,
-    0x00,
-    0x00,
-    0x30,
-    0x0F,
-    0x90,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0xA0,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x30,
-    0x0F,
-    0x10,
-    0x1E,
-    0x00,
-    0x00,
-    0x90,
-    0x0F,
-    0x00,
-    0xD6,
-    0x03,
-    0x00,
-    0xA7,
-    0x0C,
-    0x00,
-    0x40,
-    0xEB,
-    0xDD,
-    0x06,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xEA,
-    0xDD,
-    0x07,
-    0x00,
-    0x00,
-    0xD3,
-    0x04,
-    0x10,
-    0x9A,
-    0x00,
-    0x00,
-    0x2D,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x50,
-    0x0A,
-    0x00,
-    0x00,
-    0x70,
-    0x08,
-    0x90,
-    0x06,
-    0x00,
-    0x00,
-    0x50,
-    0x0B,
-    0xB0,
-    0xDE,
-    0xDD,
-    0xDD,
-    0xDD,
-    0x0A,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE4,
-    0x06,
-    0x00,
-    0x50,
-    0x01,
-    0x00,
-    0x20,
-    0xE9,
-    0xED,
-    0x8C,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xDE,
-    0x2E,
-    0x00,
-    0xB6,
-    0x00,
-    0x00,
-    0x00,
-    0x4A,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0xC7,
-    0xEF,
-    0xAD,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA1,
-    0xCD,
-    0xFE,
-    0xBD,
-    0x07,
-    0xD1,
-    0x04,
-    0x00,
-    0xA9,
-    0x00,
-    0x70,
-    0x08,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x70,
-    0x08,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0xE1,
-    0x04,
-    0x00,
-    0x89,
-    0x00,
-    0x00,
-    0xD2,
-    0xCD,
-    0x6C,
-    0x00,
-    0x00,
-    0x60,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF6,
-    0xFF,
-    0xEF,
-    0x2B,
-    0x00,
-    0x89,
-    0x01,
-    0x00,
-    0x61,
-    0x0E,
-    0xB4,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x75,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x5A,
-    0xA6,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x6D,
-    0x00,
-    0x00,
-    0xC3,
-    0x07,
-    0x10,
-    0xD9,
-    0xDD,
-    0xAD,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0xD8,
-    0xEE,
-    0x09,
-    0x00,
-    0x30,
-    0xBC,
-    0x05,
-    0x00,
-    0xA9,
-    0x00,
-    0x30,
-    0x6F,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x30,
-    0x0F,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0xE0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x60,
-    0x0B,
-    0xFC,
-    0x2C,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x10,
-    0x3D,
-    0x10,
-    0x0D,
-    0x00,
-    0xC0,
-    0x05,
-    0x10,
-    0x0D,
-    0x00,
-    0x7A,
-    0x00,
-    0x10,
-    0x0D,
-    0x70,
-    0x0A,
-    0x00,
-    0x10,
-    0x0D,
-    0xC4,
-    0x00,
-    0x00,
-    0x10,
-    0x2D,
-    0x9E,
-    0x00,
-    0x00,
-    0x10,
-    0xCC,
-    0xE3,
-    0x03,
-    0x00,
-    0x10,
-    0x2E,
-    0x40,
-    0x0D,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x99,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xD0,
-    0x04,
-    0x10,
-    0x0D,
-    0x00,
-    0x30,
-    0x0D,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xA8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0C,
-    0xE8,
-    0xDE,
-    0x07,
-    0x80,
-    0xEE,
-    0x8E,
-    0x00,
-    0x00,
-    0xE1,
-    0x5A,
-    0x00,
-    0xB1,
-    0xB7,
-    0x06,
-    0x00,
-    0x9A,
-    0x00,
-    0x10,
-    0x6F,
-    0x00,
-    0x00,
-    0xF2,
-    0x08,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x00,
-    0x3F,
-    0x00,
-    0x00,
-    0xC0,
-    0x02,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0B,
-    0xD8,
-    0xEE,
-    0x09,
-    0x00,
-    0x30,
-    0xBD,
-    0x05,
-    0x00,
-    0xA9,
-    0x00,
-    0x30,
-    0x6F,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x30,
-    0x0F,
-    0x00,
-    0x00,
-    0xB0,
-    0x03,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xEB,
-    0xCE,
-    0x04,
-    0x00,
-    0x00,
-    0xD6,
-    0x02,
-    0x30,
-    0x6D,
-    0x00,
-    0x10,
-    0x1E,
-    0x00,
-    0x00,
-    0xE1,
-    0x01,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0xA0,
-    0x05,
-    0x00,
-    0x00,
-    0x50,
-    0x0A,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x30,
-    0x0B,
-    0xB0,
-    0x03,
-    0x00,
-    0x00,
-    0x30,
-    0x0B,
-    0xA0,
-    0x05,
-    0x00,
-    0x00,
-    0x50,
-    0x0A,
-    0x70,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x10,
-    0x1E,
-    0x00,
-    0x00,
-    0xE1,
-    0x01,
-    0x00,
-    0xD6,
-    0x03,
-    0x30,
-    0x6D,
-    0x00,
-    0x00,
-    0x40,
-    0xEB,
-    0xBE,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0xC6,
-    0xEE,
-    0x4B,
-    0x00,
-    0x10,
-    0x9F,
-    0x18,
-    0x00,
-    0xD3,
-    0x06,
-    0x10,
-    0x9F,
-    0x00,
-    0x00,
-    0x10,
-    0x1E,
-    0x10,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x96,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x96,
-    0x10,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x10,
-    0x9F,
-    0x00,
-    0x00,
-    0x20,
-    0x0E,
-    0x10,
-    0xAD,
-    0x08,
-    0x00,
-    0xD3,
-    0x05,
-    0x10,
-    0x0E,
-    0xC6,
-    0xEE,
-    0x3B,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xEB,
-    0xCE,
-    0x06,
-    0x0D,
-    0x00,
-    0xE5,
-    0x03,
-    0x00,
-    0xA8,
-    0x0F,
-    0x00,
-    0x2E,
-    0x00,
-    0x00,
-    0x90,
-    0x0F,
-    0x50,
-    0x0A,
-    0x00,
-    0x00,
-    0x30,
-    0x0F,
-    0x90,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x90,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x60,
-    0x09,
-    0x00,
-    0x00,
-    0x30,
-    0x0F,
-    0x10,
-    0x1E,
-    0x00,
-    0x00,
-    0x90,
-    0x0F,
-    0x00,
-    0xD6,
-    0x03,
-    0x00,
-    0xA8,
-    0x0D,
-    0x00,
-    0x40,
-    0xEB,
-    0xCE,
-    0x06,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0B,
-    0xE8,
-    0x7F,
-    0x10,
-    0x9B,
-    0x06,
-    0x00,
-    0x10,
-    0x8E,
-    0x00,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0xEE,
-    0xBE,
-    0x04,
-    0x70,
-    0x2B,
-    0x00,
-    0x40,
-    0x03,
-    0xC0,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x5E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA2,
-    0x8E,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x71,
-    0x9E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0D,
-    0x71,
-    0x02,
-    0x00,
-    0xC3,
-    0x06,
-    0x80,
-    0xFC,
-    0xEF,
-    0x5B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x00,
-    0x00,
-    0x00,
-    0x0B,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0xD7,
-    0xDF,
-    0xDD,
-    0x03,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0x00,
-    0x20,
-    0xEC,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x30,
-    0x0B,
-    0x00,
-    0x00,
-    0xF0,
-    0x03,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0xF5,
-    0x03,
-    0x00,
-    0x9A,
-    0x00,
-    0x50,
-    0xDD,
-    0x03,
-    0x00,
-    0x90,
-    0xEE,
-    0x9E,
-    0xB1,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0x96,
-    0x00,
-    0x00,
-    0x00,
-    0x69,
-    0xE0,
-    0x00,
-    0x00,
-    0x00,
-    0x0E,
-    0xA0,
-    0x04,
-    0x00,
-    0x50,
-    0x0A,
-    0x40,
-    0x0A,
-    0x00,
-    0xA0,
-    0x04,
-    0x00,
-    0x0E,
-    0x00,
-    0xE1,
-    0x00,
-    0x00,
-    0x68,
-    0x00,
-    0x86,
-    0x00,
-    0x00,
-    0xC2,
-    0x00,
-    0x2C,
-    0x00,
-    0x00,
-    0xC0,
-    0x22,
-    0x0C,
-    0x00,
-    0x00,
-    0x60,
-    0x77,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0xCC,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xAA,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x88,
-    0x00,
-    0x00,
-    0xF0,
-    0x03,
-    0x00,
-    0x70,
-    0x48,
-    0x0C,
-    0x00,
-    0x40,
-    0x7E,
-    0x00,
-    0x00,
-    0x4B,
-    0xF0,
-    0x00,
-    0x00,
-    0x79,
-    0x0C,
-    0x00,
-    0xE0,
-    0x00,
-    0x4C,
-    0x00,
-    0xE0,
-    0xD0,
-    0x01,
-    0x20,
-    0x0C,
-    0x70,
-    0x08,
-    0x30,
-    0x0B,
-    0x69,
-    0x00,
-    0x86,
-    0x00,
-    0xC3,
-    0x00,
-    0x68,
-    0x40,
-    0x0A,
-    0xA0,
-    0x04,
-    0x00,
-    0x0E,
-    0xD0,
-    0x01,
-    0xE0,
-    0x00,
-    0x0E,
-    0x00,
-    0xB0,
-    0x24,
-    0x0D,
-    0x00,
-    0x4B,
-    0xC2,
-    0x00,
-    0x00,
-    0x77,
-    0x76,
-    0x00,
-    0x60,
-    0x58,
-    0x08,
-    0x00,
-    0x30,
-    0xAA,
-    0x03,
-    0x00,
-    0xD1,
-    0x48,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xDC,
-    0x00,
-    0x00,
-    0x00,
-    0x9A,
-    0x00,
-    0x00,
-    0x70,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x02,
-    0x00,
-    0x30,
-    0x0D,
-    0x50,
-    0x0C,
-    0x00,
-    0xC0,
-    0x03,
-    0x00,
-    0x6B,
-    0x00,
-    0x96,
-    0x00,
-    0x00,
-    0xD1,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x60,
-    0xA9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0xBC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x76,
-    0x09,
-    0x00,
-    0x00,
-    0xC3,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0xD3,
-    0x00,
-    0x70,
-    0x09,
-    0x00,
-    0x90,
-    0x07,
-    0xE2,
-    0x00,
-    0x00,
-    0x10,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0x96,
-    0x00,
-    0x00,
-    0x00,
-    0x69,
-    0xE1,
-    0x00,
-    0x00,
-    0x00,
-    0x0E,
-    0xA0,
-    0x04,
-    0x00,
-    0x40,
-    0x0A,
-    0x40,
-    0x0A,
-    0x00,
-    0xA0,
-    0x04,
-    0x00,
-    0x0D,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x69,
-    0x00,
-    0x86,
-    0x00,
-    0x00,
-    0xB3,
-    0x00,
-    0x2C,
-    0x00,
-    0x00,
-    0xD0,
-    0x11,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x77,
-    0x05,
-    0x00,
-    0x00,
-    0x10,
-    0xBC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xE4,
-    0x00,
-    0x00,
-    0x00,
-    0xFD,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xDD,
-    0xDD,
-    0xED,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xDD,
-    0xDD,
-    0xDD,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA1,
-    0x3E,
-    0x00,
-    0xC0,
-    0x07,
-    0x00,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x30,
-    0x0C,
-    0x00,
-    0x00,
-    0xB4,
-    0x00,
-    0x00,
-    0xB1,
-    0x05,
-    0x00,
-    0xE4,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x08,
-    0x00,
-    0x00,
-    0xB3,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x00,
-    0x6E,
-    0x00,
-    0x00,
-    0x30,
-    0xFB,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xAE,
-    0x01,
-    0x00,
-    0x00,
-    0xC7,
-    0x00,
-    0x00,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0xB0,
-    0x04,
-    0x00,
-    0x00,
-    0xB5,
-    0x01,
-    0x00,
-    0x00,
-    0xE9,
-    0x04,
-    0x00,
-    0x98,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x60,
-    0x0E,
-    0x00,
-    0xF3,
-    0x2B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xDC,
-    0x9D,
-    0x04,
-    0x10,
-    0x08,
-    0x80,
-    0x01,
-    0x40,
-    0xD9,
-    0xCD,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x00,
-    0x00,
-    0x3F,
-    0x11,
-    0x11,
-    0x31,
-    0x0F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x3F,
-    0x11,
-    0x11,
-    0x31,
-    0x0F,
-    0x00,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_LIGHT_16_22PX = [
-    FontCharacter(5, 55, 0),
-    FontCharacter(5, 55, 55),
-    FontCharacter(7, 77, 110),
-    FontCharacter(14, 154, 187),
-    FontCharacter(12, 132, 341),
-    FontCharacter(17, 187, 473),
-    FontCharacter(15, 165, 660),
-    FontCharacter(4, 44, 825),
-    FontCharacter(6, 66, 869),
-    FontCharacter(6, 66, 935),
-    FontCharacter(12, 132, 1001),
-    FontCharacter(12, 132, 1133),
-    FontCharacter(5, 55, 1265),
-    FontCharacter(7, 77, 1320),
-    FontCharacter(5, 55, 1397),
-    FontCharacter(7, 77, 1452),
-    FontCharacter(12, 132, 1529),
-    FontCharacter(12, 132, 1661),
-    FontCharacter(12, 132, 1793),
-    FontCharacter(12, 132, 1925),
-    FontCharacter(12, 132, 2057),
-    FontCharacter(12, 132, 2189),
-    FontCharacter(12, 132, 2321),
-    FontCharacter(12, 132, 2453),
-    FontCharacter(12, 132, 2585),
-    FontCharacter(12, 132, 2717),
-    FontCharacter(5, 55, 2849),
-    FontCharacter(5, 55, 2904),
-    FontCharacter(12, 132, 2959),
-    FontCharacter(12, 132, 3091),
-    FontCharacter(12, 132, 3223),
-    FontCharacter(9, 99, 3355),
-    FontCharacter(19, 209, 3454),
-    FontCharacter(13, 143, 3663),
-    FontCharacter(13, 143, 3806),
-    FontCharacter(13, 143, 3949),
-    FontCharacter(15, 165, 4092),
-    FontCharacter(12, 132, 4257),
-    FontCharacter(11, 121, 4389),
-    FontCharacter(15, 165, 4510),
-    FontCharacter(15, 165, 4675),
-    FontCharacter(5, 55, 4840),
-    FontCharacter(6, 66, 4895),
-    FontCharacter(12, 132, 4961),
-    FontCharacter(11, 121, 5093),
-    FontCharacter(18, 198, 5214),
-    FontCharacter(15, 165, 5412),
-    FontCharacter(16, 176, 5577),
-    FontCharacter(12, 132, 5753),
-    FontCharacter(16, 176, 5885),
-    FontCharacter(12, 132, 6061),
-    FontCharacter(11, 121, 6193),
-    FontCharacter(11, 121, 6314),
-    FontCharacter(15, 165, 6435),
-    FontCharacter(12, 132, 6600),
-    FontCharacter(19, 209, 6732),
-    FontCharacter(11, 121, 6941),
-    FontCharacter(11, 121, 7062),
-    FontCharacter(12, 132, 7183),
-    FontCharacter(7, 77, 7315),
-    FontCharacter(7, 77, 7392),
-    FontCharacter(7, 77, 7469),
-    FontCharacter(12, 132, 7546),
-    FontCharacter(9, 99, 7678),
-    FontCharacter(12, 132, 7777),
-    FontCharacter(11, 121, 7909),
-    FontCharacter(12, 132, 8030),
-    FontCharacter(10, 110, 8162),
-    FontCharacter(12, 132, 8272),
-    FontCharacter(12, 132, 8404),
-    FontCharacter(8, 88, 8536),
-    FontCharacter(11, 121, 8624),
-    FontCharacter(12, 132, 8745),
-    FontCharacter(5, 55, 8877),
-    FontCharacter(5, 55, 8932),
-    FontCharacter(10, 110, 8987),
-    FontCharacter(5, 55, 9097),
-    FontCharacter(19, 209, 9152),
-    FontCharacter(12, 132, 9361),
-    FontCharacter(12, 132, 9493),
-    FontCharacter(12, 132, 9625),
-    FontCharacter(12, 132, 9757),
-    FontCharacter(8, 88, 9889),
-    FontCharacter(10, 110, 9977),
-    FontCharacter(7, 77, 10087),
-    FontCharacter(12, 132, 10164),
-    FontCharacter(10, 110, 10296),
-    FontCharacter(15, 165, 10406),
-    FontCharacter(10, 110, 10571),
-    FontCharacter(10, 110, 10681),
-    FontCharacter(10, 110, 10791),
-    FontCharacter(7, 77, 10901),
-    FontCharacter(11, 121, 10978),
-    FontCharacter(7, 77, 11099),
-    FontCharacter(12, 132, 11176),
-    FontCharacter(13, 143, 11308),
-]
+FONT_PACK_PATH = Path(__file__).resolve().parent.parent / "fonts" / "bagl-fonts.bin"
 
-bitmapOPEN_SANS_REGULAR_8_11PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x0F,
-    0xE0,
-    0x00,
-    0x0B,
-    0xB0,
-    0x00,
-    0x08,
-    0x60,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x94,
-    0x49,
-    0x73,
-    0x37,
-    0x72,
-    0x27,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x46,
-    0xA0,
-    0x00,
-    0x90,
-    0x41,
-    0x06,
-    0xB4,
-    0xBE,
-    0xCE,
-    0x08,
-    0xB0,
-    0xA0,
-    0x00,
-    0x20,
-    0x09,
-    0x0B,
-    0x80,
-    0xDD,
-    0xEB,
-    0x4B,
-    0x70,
-    0x23,
-    0x08,
-    0x00,
-    0x0A,
-    0x55,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x90,
-    0xDD,
-    0x0B,
-    0xB2,
-    0x55,
-    0x00,
-    0xD1,
-    0x58,
-    0x00,
-    0x30,
-    0xDC,
-    0x05,
-    0x00,
-    0x75,
-    0x2C,
-    0x00,
-    0x55,
-    0x3B,
-    0xC3,
-    0xDD,
-    0x07,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x2B,
-    0x00,
-    0x0B,
-    0x50,
-    0x16,
-    0x09,
-    0x38,
-    0x00,
-    0x35,
-    0xB0,
-    0xA1,
-    0x00,
-    0x40,
-    0x16,
-    0x99,
-    0xB6,
-    0x0A,
-    0xB0,
-    0x5B,
-    0x99,
-    0x61,
-    0x04,
-    0x00,
-    0x1A,
-    0x0B,
-    0x53,
-    0x00,
-    0x83,
-    0x90,
-    0x61,
-    0x04,
-    0xA0,
-    0x00,
-    0xB2,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xBC,
-    0x0A,
-    0x00,
-    0x90,
-    0x04,
-    0x1C,
-    0x00,
-    0x60,
-    0x28,
-    0x0C,
-    0x00,
-    0x00,
-    0xDE,
-    0x01,
-    0x00,
-    0xC0,
-    0xA5,
-    0x06,
-    0x58,
-    0x85,
-    0x00,
-    0x7A,
-    0x0D,
-    0xB4,
-    0x00,
-    0xF2,
-    0x09,
-    0x90,
-    0xCC,
-    0x3B,
-    0x6A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x85,
-    0x74,
-    0x53,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x06,
-    0x0D,
-    0xA3,
-    0x70,
-    0x06,
-    0x59,
-    0x90,
-    0x05,
-    0x67,
-    0x40,
-    0x0A,
-    0xD0,
-    0x00,
-    0x66,
-    0x00,
-    0x00,
-    0x66,
-    0x00,
-    0x0D,
-    0xA0,
-    0x03,
-    0x76,
-    0x50,
-    0x09,
-    0x95,
-    0x60,
-    0x07,
-    0x4A,
-    0xD0,
-    0x50,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x67,
-    0x00,
-    0x22,
-    0x55,
-    0x12,
-    0x93,
-    0xCD,
-    0x39,
-    0x20,
-    0xBB,
-    0x01,
-    0x70,
-    0x54,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x11,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0xB7,
-    0xDD,
-    0x7B,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0xB4,
-    0x70,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD6,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA2,
-    0x00,
-    0x58,
-    0x00,
-    0x0D,
-    0x30,
-    0x09,
-    0x90,
-    0x03,
-    0xD0,
-    0x00,
-    0x85,
-    0x00,
-    0x2A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xCC,
-    0x05,
-    0xC1,
-    0x00,
-    0x1C,
-    0x85,
-    0x00,
-    0x58,
-    0x67,
-    0x00,
-    0x76,
-    0x67,
-    0x00,
-    0x76,
-    0x85,
-    0x00,
-    0x58,
-    0xC1,
-    0x00,
-    0x1C,
-    0x50,
-    0xCC,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBA,
-    0x00,
-    0xA0,
-    0xB4,
-    0x00,
-    0x00,
-    0xB1,
-    0x00,
-    0x00,
-    0xB1,
-    0x00,
-    0x00,
-    0xB1,
-    0x00,
-    0x00,
-    0xB1,
-    0x00,
-    0x00,
-    0xB1,
-    0x00,
-    0x00,
-    0xB1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA1,
-    0xCB,
-    0x06,
-    0x30,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0x1C,
-    0x00,
-    0x20,
-    0x0B,
-    0x00,
-    0xC1,
-    0x01,
-    0x00,
-    0x3B,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0xF7,
-    0xDD,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB2,
-    0xCB,
-    0x07,
-    0x10,
-    0x00,
-    0x1D,
-    0x00,
-    0x30,
-    0x0C,
-    0x40,
-    0xDB,
-    0x05,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x57,
-    0x00,
-    0x00,
-    0x2C,
-    0xC5,
-    0xCB,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x0B,
-    0x00,
-    0xA4,
-    0x0B,
-    0x00,
-    0x2B,
-    0x0B,
-    0xA0,
-    0x12,
-    0x0B,
-    0x65,
-    0x10,
-    0x0B,
-    0xDA,
-    0xDD,
-    0xAF,
-    0x00,
-    0x10,
-    0x0B,
-    0x00,
-    0x10,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xDD,
-    0x0B,
-    0xD0,
-    0x00,
-    0x00,
-    0xB0,
-    0x00,
-    0x00,
-    0xC0,
-    0xDB,
-    0x07,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x57,
-    0x00,
-    0x00,
-    0x2C,
-    0xC3,
-    0xCB,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xBA,
-    0x0A,
-    0xB0,
-    0x03,
-    0x00,
-    0xB2,
-    0x00,
-    0x00,
-    0xA5,
-    0xBA,
-    0x0A,
-    0xB5,
-    0x00,
-    0x59,
-    0x84,
-    0x00,
-    0x75,
-    0xC0,
-    0x00,
-    0x4A,
-    0x40,
-    0xCC,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD6,
-    0xDD,
-    0x7E,
-    0x00,
-    0x00,
-    0x2C,
-    0x00,
-    0x20,
-    0x0B,
-    0x00,
-    0x90,
-    0x04,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x67,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x40,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xCC,
-    0x09,
-    0xA2,
-    0x00,
-    0x2A,
-    0xC0,
-    0x23,
-    0x0B,
-    0x40,
-    0xEE,
-    0x03,
-    0xC1,
-    0x10,
-    0x1C,
-    0x67,
-    0x00,
-    0x66,
-    0x94,
-    0x00,
-    0x49,
-    0x90,
-    0xBC,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xCC,
-    0x05,
-    0xA3,
-    0x00,
-    0x1C,
-    0x77,
-    0x00,
-    0x57,
-    0x94,
-    0x00,
-    0x5A,
-    0x90,
-    0xAB,
-    0x5A,
-    0x00,
-    0x00,
-    0x2A,
-    0x00,
-    0x30,
-    0x0C,
-    0xA0,
-    0xAB,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x10,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0x00,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0D,
-    0x84,
-    0x80,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x66,
-    0x00,
-    0xB3,
-    0x06,
-    0xA1,
-    0x08,
-    0x00,
-    0xC4,
-    0x05,
-    0x00,
-    0x00,
-    0xC7,
-    0x05,
-    0x00,
-    0x00,
-    0x67,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB4,
-    0xBB,
-    0x4B,
-    0x00,
-    0x00,
-    0x00,
-    0xB4,
-    0xBB,
-    0x4B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x66,
-    0x00,
-    0x00,
-    0x60,
-    0x3C,
-    0x00,
-    0x00,
-    0x80,
-    0x1A,
-    0x00,
-    0x50,
-    0x4B,
-    0x50,
-    0x7C,
-    0x00,
-    0x76,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD7,
-    0xCC,
-    0x11,
-    0x00,
-    0x94,
-    0x00,
-    0x40,
-    0x09,
-    0x20,
-    0x1C,
-    0x10,
-    0x1C,
-    0x00,
-    0x55,
-    0x00,
-    0x30,
-    0x02,
-    0x00,
-    0x88,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x92,
-    0xBB,
-    0x6A,
-    0x00,
-    0x30,
-    0x1B,
-    0x00,
-    0x60,
-    0x07,
-    0xB0,
-    0x30,
-    0xAB,
-    0x0A,
-    0x0A,
-    0x82,
-    0xC0,
-    0x00,
-    0x0C,
-    0x46,
-    0x55,
-    0xB1,
-    0x00,
-    0x0C,
-    0x55,
-    0x64,
-    0xC0,
-    0x20,
-    0x0C,
-    0x19,
-    0xA1,
-    0x70,
-    0x9B,
-    0xA7,
-    0x07,
-    0x80,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0xBB,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x60,
-    0x7C,
-    0x00,
-    0x00,
-    0x2C,
-    0x0D,
-    0x00,
-    0xB3,
-    0xB0,
-    0x03,
-    0x90,
-    0x05,
-    0x95,
-    0x00,
-    0xDE,
-    0xDD,
-    0x0E,
-    0x96,
-    0x00,
-    0x90,
-    0xC6,
-    0x01,
-    0x00,
-    0xC2,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xCB,
-    0x7C,
-    0x00,
-    0x0F,
-    0x00,
-    0x1D,
-    0xF0,
-    0x00,
-    0xC2,
-    0x00,
-    0xBF,
-    0xDB,
-    0x05,
-    0xF0,
-    0x00,
-    0xC0,
-    0x02,
-    0x0F,
-    0x00,
-    0x59,
-    0xF0,
-    0x00,
-    0xC0,
-    0x03,
-    0xBF,
-    0xDB,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC7,
-    0xDD,
-    0x05,
-    0x99,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0x40,
-    0x0A,
-    0x00,
-    0x00,
-    0xA4,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0xA0,
-    0x08,
-    0x00,
-    0x00,
-    0x90,
-    0xDD,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xCB,
-    0x8D,
-    0x00,
-    0xD0,
-    0x00,
-    0x80,
-    0x0A,
-    0xD0,
-    0x00,
-    0x00,
-    0x1D,
-    0xD0,
-    0x00,
-    0x00,
-    0x4A,
-    0xD0,
-    0x00,
-    0x00,
-    0x4A,
-    0xD0,
-    0x00,
-    0x00,
-    0x1D,
-    0xD0,
-    0x00,
-    0x90,
-    0x09,
-    0xD0,
-    0xCB,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xDD,
-    0x4D,
-    0xF0,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0xF0,
-    0xDD,
-    0x1D,
-    0xF0,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0xF0,
-    0xDD,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xDD,
-    0xAD,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0xDD,
-    0x6D,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0xDD,
-    0x0B,
-    0x80,
-    0x09,
-    0x00,
-    0x01,
-    0xD1,
-    0x00,
-    0x00,
-    0x00,
-    0xA4,
-    0x00,
-    0x00,
-    0x00,
-    0xA4,
-    0x00,
-    0xD6,
-    0x3F,
-    0xD1,
-    0x00,
-    0x00,
-    0x3B,
-    0xA0,
-    0x08,
-    0x00,
-    0x3B,
-    0x00,
-    0xD8,
-    0xCC,
-    0x2C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0xF0,
-    0xDD,
-    0xDD,
-    0x0F,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0x0F,
-    0xF0,
-    0x00,
-    0xBE,
-    0x5D,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0xA0,
-    0x06,
-    0x0D,
-    0xA0,
-    0x06,
-    0xD0,
-    0x80,
-    0x08,
-    0x00,
-    0x8D,
-    0x0C,
-    0x00,
-    0xD0,
-    0xB7,
-    0x05,
-    0x00,
-    0x0D,
-    0xD1,
-    0x02,
-    0xD0,
-    0x00,
-    0xC3,
-    0x00,
-    0x0D,
-    0x00,
-    0x97,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0xD0,
-    0xDD,
-    0xAD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0A,
-    0x00,
-    0x90,
-    0x0D,
-    0xB0,
-    0x0D,
-    0x00,
-    0xC0,
-    0x0D,
-    0xB0,
-    0x67,
-    0x00,
-    0x66,
-    0x0D,
-    0xD0,
-    0xC1,
-    0x00,
-    0x0B,
-    0x0D,
-    0xD0,
-    0xB0,
-    0x22,
-    0x0A,
-    0x0D,
-    0xD0,
-    0x50,
-    0x88,
-    0x04,
-    0x0D,
-    0xD0,
-    0x00,
-    0xCD,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x79,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0x0D,
-    0xE0,
-    0x0D,
-    0x00,
-    0x0D,
-    0xD0,
-    0x96,
-    0x00,
-    0x0D,
-    0xD0,
-    0xC0,
-    0x02,
-    0x0D,
-    0xD0,
-    0x30,
-    0x0C,
-    0x0D,
-    0xD0,
-    0x00,
-    0x69,
-    0x0D,
-    0xD0,
-    0x00,
-    0xD0,
-    0x0E,
-    0xD0,
-    0x00,
-    0x50,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD8,
-    0xDD,
-    0x08,
-    0x00,
-    0x89,
-    0x00,
-    0x80,
-    0x09,
-    0xD1,
-    0x00,
-    0x00,
-    0xD0,
-    0x31,
-    0x0A,
-    0x00,
-    0x00,
-    0x3A,
-    0xA3,
-    0x00,
-    0x00,
-    0xA0,
-    0x13,
-    0x0D,
-    0x00,
-    0x00,
-    0x1D,
-    0x90,
-    0x08,
-    0x00,
-    0x98,
-    0x00,
-    0x80,
-    0xCD,
-    0x8D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xCC,
-    0x7D,
-    0x00,
-    0x1D,
-    0x00,
-    0x3C,
-    0xD0,
-    0x01,
-    0x80,
-    0x05,
-    0x1D,
-    0x30,
-    0x1D,
-    0xD0,
-    0xBC,
-    0x29,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD8,
-    0xDD,
-    0x08,
-    0x00,
-    0x89,
-    0x00,
-    0x80,
-    0x09,
-    0xD1,
-    0x00,
-    0x00,
-    0xD0,
-    0x31,
-    0x0A,
-    0x00,
-    0x00,
-    0x3A,
-    0xA3,
-    0x00,
-    0x00,
-    0xA0,
-    0x13,
-    0x0D,
-    0x00,
-    0x00,
-    0x1D,
-    0x90,
-    0x08,
-    0x00,
-    0x98,
-    0x00,
-    0x80,
-    0xCD,
-    0x8E,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xCB,
-    0x6C,
-    0x00,
-    0x0D,
-    0x00,
-    0x1E,
-    0xD0,
-    0x00,
-    0xB0,
-    0x03,
-    0x0D,
-    0x30,
-    0x0D,
-    0xD0,
-    0xCB,
-    0x1D,
-    0x00,
-    0x0D,
-    0xC0,
-    0x03,
-    0xD0,
-    0x00,
-    0xC2,
-    0x00,
-    0x0D,
-    0x00,
-    0x78,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xDD,
-    0x1C,
-    0xB3,
-    0x00,
-    0x00,
-    0xB3,
-    0x00,
-    0x00,
-    0x90,
-    0x5B,
-    0x00,
-    0x00,
-    0x92,
-    0x1C,
-    0x00,
-    0x00,
-    0x68,
-    0x01,
-    0x00,
-    0x5A,
-    0xD5,
-    0xCC,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDB,
-    0xEE,
-    0xBD,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x00,
-    0x0E,
-    0xA0,
-    0x05,
-    0x50,
-    0x0A,
-    0x10,
-    0xCA,
-    0xAC,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x30,
-    0x6C,
-    0x09,
-    0x00,
-    0x69,
-    0xE0,
-    0x00,
-    0xE0,
-    0x00,
-    0x5A,
-    0x50,
-    0x0A,
-    0x40,
-    0x0B,
-    0x4B,
-    0x00,
-    0xD0,
-    0xE3,
-    0x00,
-    0x00,
-    0xC8,
-    0x08,
-    0x00,
-    0x20,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0x9A,
-    0x00,
-    0xB3,
-    0x77,
-    0x00,
-    0xCC,
-    0x00,
-    0x77,
-    0xB3,
-    0x30,
-    0xA9,
-    0x02,
-    0x3B,
-    0xE0,
-    0x70,
-    0x65,
-    0x07,
-    0x0E,
-    0xB0,
-    0xC3,
-    0x10,
-    0x3B,
-    0x0A,
-    0x60,
-    0xC7,
-    0x00,
-    0x7C,
-    0x06,
-    0x20,
-    0x7D,
-    0x00,
-    0xD8,
-    0x02,
-    0x00,
-    0x3E,
-    0x00,
-    0xE3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x67,
-    0x00,
-    0x76,
-    0xC0,
-    0x01,
-    0x0C,
-    0x40,
-    0x99,
-    0x03,
-    0x00,
-    0xAA,
-    0x00,
-    0x00,
-    0xCC,
-    0x00,
-    0x70,
-    0x65,
-    0x07,
-    0xC1,
-    0x00,
-    0x1C,
-    0x3A,
-    0x00,
-    0xA4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x00,
-    0xB3,
-    0xB3,
-    0x00,
-    0x3B,
-    0xA0,
-    0x33,
-    0x0A,
-    0x20,
-    0xBB,
-    0x02,
-    0x00,
-    0xAA,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD6,
-    0xDD,
-    0x7F,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0xA0,
-    0x05,
-    0x00,
-    0xC4,
-    0x00,
-    0x00,
-    0x2D,
-    0x00,
-    0x70,
-    0x08,
-    0x00,
-    0xD1,
-    0x00,
-    0x00,
-    0xE9,
-    0xDD,
-    0x8D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x8B,
-    0xD0,
-    0x00,
-    0xD0,
-    0x00,
-    0xD0,
-    0x00,
-    0xD0,
-    0x00,
-    0xD0,
-    0x00,
-    0xD0,
-    0x00,
-    0xD0,
-    0x00,
-    0xD0,
-    0x00,
-    0xF0,
-    0x8B,
-    0x00,
-    0x00,
-    0x2A,
-    0x00,
-    0x84,
-    0x00,
-    0xD0,
-    0x00,
-    0x90,
-    0x03,
-    0x30,
-    0x09,
-    0x00,
-    0x0D,
-    0x00,
-    0x57,
-    0x00,
-    0xB2,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB8,
-    0x0F,
-    0x00,
-    0x0D,
-    0x00,
-    0x0D,
-    0x00,
-    0x0D,
-    0x00,
-    0x0D,
-    0x00,
-    0x0D,
-    0x00,
-    0x0D,
-    0x00,
-    0x0D,
-    0x00,
-    0x0D,
-    0xB8,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x10,
-    0xB9,
-    0x00,
-    0x80,
-    0x52,
-    0x06,
-    0xB0,
-    0x00,
-    0x0B,
-    0x47,
-    0x00,
-    0x65,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xBB,
-    0xBB,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xCB,
-    0x08,
-    0x00,
-    0x00,
-    0x1C,
-    0x80,
-    0xAB,
-    0x1E,
-    0x96,
-    0x00,
-    0x1B,
-    0x87,
-    0x10,
-    0x1F,
-    0xC1,
-    0x9B,
-    0x1A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0xE0,
-    0xB9,
-    0x5C,
-    0x00,
-    0x2F,
-    0x00,
-    0x1D,
-    0xD0,
-    0x00,
-    0x90,
-    0x05,
-    0x0E,
-    0x00,
-    0x59,
-    0xF0,
-    0x02,
-    0xD0,
-    0x01,
-    0x9B,
-    0xCB,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xCD,
-    0x16,
-    0x0C,
-    0x00,
-    0x85,
-    0x00,
-    0x50,
-    0x08,
-    0x00,
-    0xC2,
-    0x00,
-    0x00,
-    0xC6,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x50,
-    0xBC,
-    0xE9,
-    0x10,
-    0x0D,
-    0x20,
-    0x0F,
-    0x95,
-    0x00,
-    0xE0,
-    0x50,
-    0x09,
-    0x00,
-    0x0D,
-    0xD1,
-    0x00,
-    0xF2,
-    0x00,
-    0xC6,
-    0x9B,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xBB,
-    0x09,
-    0xA1,
-    0x00,
-    0x49,
-    0xD5,
-    0xBB,
-    0x5B,
-    0x95,
-    0x00,
-    0x00,
-    0xD1,
-    0x01,
-    0x00,
-    0x50,
-    0xBD,
-    0x2C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xBC,
-    0x01,
-    0x3A,
-    0x00,
-    0xE7,
-    0x8C,
-    0x00,
-    0x3B,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x3B,
-    0x00,
-    0xB0,
-    0x03,
-    0x00,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xCA,
-    0x7D,
-    0x93,
-    0x00,
-    0x0E,
-    0x94,
-    0x00,
-    0x0D,
-    0xB0,
-    0xAA,
-    0x05,
-    0xC0,
-    0x00,
-    0x00,
-    0xC0,
-    0xCB,
-    0x2D,
-    0x3A,
-    0x00,
-    0x94,
-    0x2B,
-    0x00,
-    0x86,
-    0xB3,
-    0xBB,
-    0x09,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0xB9,
-    0x6C,
-    0x00,
-    0x2F,
-    0x00,
-    0x0E,
-    0xD0,
-    0x00,
-    0xD0,
-    0x01,
-    0x0D,
-    0x00,
-    0x1D,
-    0xD0,
-    0x00,
-    0xD0,
-    0x01,
-    0x0D,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x0D,
-    0xD0,
-    0xC5,
-    0x07,
-    0xD0,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0xD0,
-    0x10,
-    0x3C,
-    0xD0,
-    0xC1,
-    0x03,
-    0xE0,
-    0x7D,
-    0x00,
-    0xE0,
-    0xC3,
-    0x00,
-    0xD0,
-    0x40,
-    0x0B,
-    0xD0,
-    0x00,
-    0x79,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x0D,
-    0xD0,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB1,
-    0xB9,
-    0x4B,
-    0xCB,
-    0x07,
-    0xF1,
-    0x01,
-    0xB7,
-    0x00,
-    0x0D,
-    0xD1,
-    0x00,
-    0x75,
-    0x00,
-    0x1B,
-    0xD1,
-    0x00,
-    0x75,
-    0x00,
-    0x1B,
-    0xD1,
-    0x00,
-    0x75,
-    0x00,
-    0x1B,
-    0xD1,
-    0x00,
-    0x75,
-    0x00,
-    0x1B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0xB9,
-    0x6C,
-    0x00,
-    0x2F,
-    0x00,
-    0x0E,
-    0xD0,
-    0x00,
-    0xD0,
-    0x01,
-    0x0D,
-    0x00,
-    0x1D,
-    0xD0,
-    0x00,
-    0xD0,
-    0x01,
-    0x0D,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xBC,
-    0x4C,
-    0x00,
-    0x0D,
-    0x10,
-    0x0D,
-    0x94,
-    0x00,
-    0x90,
-    0x44,
-    0x09,
-    0x00,
-    0x49,
-    0xD0,
-    0x01,
-    0xD1,
-    0x00,
-    0xB3,
-    0xBB,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0xB9,
-    0x5C,
-    0x00,
-    0x2F,
-    0x00,
-    0x1D,
-    0xD0,
-    0x00,
-    0x90,
-    0x05,
-    0x0E,
-    0x00,
-    0x59,
-    0xF0,
-    0x02,
-    0xD0,
-    0x01,
-    0x9D,
-    0xCB,
-    0x05,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xBC,
-    0xC9,
-    0x10,
-    0x0D,
-    0x20,
-    0x0F,
-    0x95,
-    0x00,
-    0xE0,
-    0x50,
-    0x09,
-    0x00,
-    0x0D,
-    0xD1,
-    0x00,
-    0xF2,
-    0x00,
-    0xC5,
-    0x9B,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA1,
-    0xAA,
-    0xE1,
-    0x02,
-    0xB1,
-    0x00,
-    0xB1,
-    0x00,
-    0xB1,
-    0x00,
-    0xB1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB1,
-    0xCB,
-    0x62,
-    0x06,
-    0x00,
-    0xC1,
-    0x18,
-    0x00,
-    0x50,
-    0x3C,
-    0x00,
-    0x60,
-    0x57,
-    0xBB,
-    0x1B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x00,
-    0xF7,
-    0x8B,
-    0xF0,
-    0x00,
-    0xF0,
-    0x00,
-    0xF0,
-    0x00,
-    0xE0,
-    0x00,
-    0x70,
-    0x8C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x00,
-    0xD0,
-    0x10,
-    0x0D,
-    0x00,
-    0x0D,
-    0xD1,
-    0x00,
-    0xD0,
-    0x10,
-    0x0D,
-    0x00,
-    0x0D,
-    0xE0,
-    0x00,
-    0xF2,
-    0x00,
-    0xD7,
-    0x9B,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0xC3,
-    0x96,
-    0x00,
-    0x69,
-    0xE0,
-    0x00,
-    0x0E,
-    0x80,
-    0x66,
-    0x08,
-    0x20,
-    0xBB,
-    0x02,
-    0x00,
-    0xCC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3B,
-    0x10,
-    0x2F,
-    0x30,
-    0x6B,
-    0x07,
-    0xA7,
-    0x07,
-    0x67,
-    0xB2,
-    0xC0,
-    0xC2,
-    0xB0,
-    0x02,
-    0x2D,
-    0x0B,
-    0x2B,
-    0x0D,
-    0x90,
-    0x5B,
-    0x60,
-    0x9B,
-    0x00,
-    0xF4,
-    0x00,
-    0xF1,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB4,
-    0x00,
-    0x4B,
-    0x80,
-    0x66,
-    0x08,
-    0x00,
-    0xCC,
-    0x00,
-    0x00,
-    0xCC,
-    0x00,
-    0xA0,
-    0x45,
-    0x0A,
-    0xA5,
-    0x00,
-    0x69,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0xC3,
-    0x96,
-    0x00,
-    0x69,
-    0xE0,
-    0x00,
-    0x0E,
-    0xA0,
-    0x56,
-    0x09,
-    0x40,
-    0xAB,
-    0x03,
-    0x00,
-    0xCD,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x10,
-    0x1E,
-    0x00,
-    0xC9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB4,
-    0xDB,
-    0x07,
-    0x00,
-    0x0C,
-    0x00,
-    0x4A,
-    0x00,
-    0xA4,
-    0x00,
-    0xD0,
-    0x00,
-    0x80,
-    0xBD,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x50,
-    0x08,
-    0x50,
-    0x07,
-    0x60,
-    0x07,
-    0xB4,
-    0x02,
-    0xB4,
-    0x02,
-    0x60,
-    0x07,
-    0x50,
-    0x07,
-    0x50,
-    0x08,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0xB7,
-    0x00,
-    0x80,
-    0x06,
-    0x70,
-    0x07,
-    0x70,
-    0x07,
-    0x20,
-    0x4B,
-    0x20,
-    0x4B,
-    0x70,
-    0x07,
-    0x70,
-    0x07,
-    0x80,
-    0x06,
-    0xB7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0x1B,
-    0x40,
-    0x04,
-    0xB1,
-    0x2C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x99,
-    0xC9,
-    0x00,
-    0x09,
-    0x00,
-    0x07,
-    0x90,
-    0x00,
-    0x70,
-    0x00,
-    0x09,
-    0x00,
-    0x07,
-    0x90,
-    0x00,
-    0x70,
-    0x00,
-    0x09,
-    0x00,
-    0x07,
-    0x90,
-    0x00,
-    0x70,
-    0x00,
-    0x9D,
-    0x99,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_REGULAR_8_11PX = [
-    FontCharacter(3, 17, 0),
-    FontCharacter(3, 17, 17),
-    FontCharacter(4, 22, 34),
-    FontCharacter(7, 39, 56),
-    FontCharacter(6, 33, 95),
-    FontCharacter(9, 50, 128),
-    FontCharacter(8, 44, 178),
-    FontCharacter(2, 11, 222),
-    FontCharacter(3, 17, 233),
-    FontCharacter(3, 17, 250),
-    FontCharacter(6, 33, 267),
-    FontCharacter(6, 33, 300),
-    FontCharacter(3, 17, 333),
-    FontCharacter(4, 22, 350),
-    FontCharacter(3, 17, 372),
-    FontCharacter(4, 22, 389),
-    FontCharacter(6, 33, 411),
-    FontCharacter(6, 33, 444),
-    FontCharacter(6, 33, 477),
-    FontCharacter(6, 33, 510),
-    FontCharacter(6, 33, 543),
-    FontCharacter(6, 33, 576),
-    FontCharacter(6, 33, 609),
-    FontCharacter(6, 33, 642),
-    FontCharacter(6, 33, 675),
-    FontCharacter(6, 33, 708),
-    FontCharacter(3, 17, 741),
-    FontCharacter(3, 17, 758),
-    FontCharacter(6, 33, 775),
-    FontCharacter(6, 33, 808),
-    FontCharacter(6, 33, 841),
-    FontCharacter(5, 28, 874),
-    FontCharacter(10, 55, 902),
-    FontCharacter(7, 39, 957),
-    FontCharacter(7, 39, 996),
-    FontCharacter(7, 39, 1035),
-    FontCharacter(8, 44, 1074),
-    FontCharacter(6, 33, 1118),
-    FontCharacter(6, 33, 1151),
-    FontCharacter(8, 44, 1184),
-    FontCharacter(8, 44, 1228),
-    FontCharacter(3, 17, 1272),
-    FontCharacter(3, 17, 1289),
-    FontCharacter(7, 39, 1306),
-    FontCharacter(6, 33, 1345),
-    FontCharacter(10, 55, 1378),
-    FontCharacter(8, 44, 1433),
-    FontCharacter(9, 50, 1477),
-    FontCharacter(7, 39, 1527),
-    FontCharacter(9, 50, 1566),
-    FontCharacter(7, 39, 1616),
-    FontCharacter(6, 33, 1655),
-    FontCharacter(6, 33, 1688),
-    FontCharacter(8, 44, 1721),
-    FontCharacter(7, 39, 1765),
-    FontCharacter(10, 55, 1804),
-    FontCharacter(6, 33, 1859),
-    FontCharacter(6, 33, 1892),
-    FontCharacter(6, 33, 1925),
-    FontCharacter(4, 22, 1958),
-    FontCharacter(4, 22, 1980),
-    FontCharacter(4, 22, 2002),
-    FontCharacter(6, 33, 2024),
-    FontCharacter(5, 28, 2057),
-    FontCharacter(6, 33, 2085),
-    FontCharacter(6, 33, 2118),
-    FontCharacter(7, 39, 2151),
-    FontCharacter(5, 28, 2190),
-    FontCharacter(7, 39, 2218),
-    FontCharacter(6, 33, 2257),
-    FontCharacter(5, 28, 2290),
-    FontCharacter(6, 33, 2318),
-    FontCharacter(7, 39, 2351),
-    FontCharacter(3, 17, 2390),
-    FontCharacter(3, 17, 2407),
-    FontCharacter(6, 33, 2424),
-    FontCharacter(3, 17, 2457),
-    FontCharacter(10, 55, 2474),
-    FontCharacter(7, 39, 2529),
-    FontCharacter(7, 39, 2568),
-    FontCharacter(7, 39, 2607),
-    FontCharacter(7, 39, 2646),
-    FontCharacter(4, 22, 2685),
-    FontCharacter(5, 28, 2707),
-    FontCharacter(4, 22, 2735),
-    FontCharacter(7, 39, 2757),
-    FontCharacter(6, 33, 2796),
-    FontCharacter(9, 50, 2829),
-    FontCharacter(6, 33, 2879),
-    FontCharacter(6, 33, 2912),
-    FontCharacter(5, 28, 2945),
-    FontCharacter(4, 22, 2973),
-    FontCharacter(6, 33, 2995),
-    FontCharacter(4, 22, 3028),
-    FontCharacter(6, 33, 3050),
-    FontCharacter(7, 39, 3083),
-]
+# Layout of the font pack (little endian):
+# - header: magic, version, number of fonts
+# - one index entry per font: font_id, bpp, char_height, baseline_height, char_kerning, first_char, last_char,
+#   number of characters, offset of the characters, offset and size of the bitmap
+# - characters (char_width, bitmap_byte_count, bitmap_offset) and bitmap of every font
+FONT_PACK_MAGIC = b"BAGLFONT"
+FONT_PACK_VERSION = 1
+FONT_PACK_HEADER = struct.Struct("<8sHH")
+FONT_PACK_ENTRY = struct.Struct("<HBBBBHHHIII")
+FONT_PACK_CHARACTER = struct.Struct("<BBH")
 
-bitmapOPEN_SANS_EXTRABOLD_11PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x6D,
-    0xC3,
-    0x06,
-    0x00,
-    0x80,
-    0x2D,
-    0x49,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x12,
-    0xC9,
-    0x4F,
-    0xF9,
-    0x4B,
-    0x24,
-    0x12,
-    0x00,
-    0x00,
-    0x00,
-    0x88,
-    0xB7,
-    0x2C,
-    0x0E,
-    0x87,
-    0xA6,
-    0x1F,
-    0x02,
-    0x00,
-    0x00,
-    0x38,
-    0xB1,
-    0xC6,
-    0x0A,
-    0xFB,
-    0xF9,
-    0x8D,
-    0x35,
-    0xD6,
-    0xC8,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0xD8,
-    0xB0,
-    0xC1,
-    0xC1,
-    0xDB,
-    0x3D,
-    0x7B,
-    0xBE,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x66,
-    0x33,
-    0x33,
-    0x66,
-    0x04,
-    0x20,
-    0x66,
-    0xCC,
-    0xCC,
-    0x66,
-    0x02,
-    0x00,
-    0xD3,
-    0xFE,
-    0x9E,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x30,
-    0x3F,
-    0xC3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x1A,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x06,
-    0x00,
-    0x00,
-    0x23,
-    0xC6,
-    0x8C,
-    0x11,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0x79,
-    0x18,
-    0x86,
-    0x61,
-    0x18,
-    0x00,
-    0x00,
-    0x00,
-    0x8E,
-    0x0D,
-    0x06,
-    0xC3,
-    0x70,
-    0x18,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x0C,
-    0xC6,
-    0x81,
-    0xC1,
-    0x60,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x38,
-    0x38,
-    0x34,
-    0x34,
-    0x7E,
-    0x30,
-    0x30,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x67,
-    0x18,
-    0x1E,
-    0x86,
-    0x61,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x38,
-    0x0C,
-    0x04,
-    0x3E,
-    0x66,
-    0x66,
-    0x66,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x0C,
-    0x06,
-    0xC3,
-    0x60,
-    0x30,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x66,
-    0x66,
-    0x3C,
-    0x66,
-    0x66,
-    0x66,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x66,
-    0x66,
-    0x66,
-    0x7C,
-    0x60,
-    0x30,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6C,
-    0xC0,
-    0x06,
-    0x00,
-    0x00,
-    0x6C,
-    0xC0,
-    0x1A,
-    0x00,
-    0x00,
-    0x60,
-    0x66,
-    0x86,
-    0x61,
-    0x18,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3F,
-    0xF0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0C,
-    0xC3,
-    0x30,
-    0x33,
-    0x03,
-    0x00,
-    0x00,
-    0xC0,
-    0x83,
-    0x61,
-    0x8E,
-    0x01,
-    0x18,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0xC3,
-    0x98,
-    0xDD,
-    0x5B,
-    0x2F,
-    0xBD,
-    0xF6,
-    0x7E,
-    0x06,
-    0xE0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x18,
-    0x3C,
-    0x3C,
-    0x7E,
-    0x66,
-    0x7E,
-    0xE7,
-    0xC3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9F,
-    0xCD,
-    0xE6,
-    0xB1,
-    0xD9,
-    0x6C,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9E,
-    0xC1,
-    0x60,
-    0x30,
-    0x18,
-    0x0C,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3E,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x67,
-    0x18,
-    0x9E,
-    0x61,
-    0x18,
-    0x1E,
-    0x00,
-    0x00,
-    0x80,
-    0x6F,
-    0x18,
-    0x9E,
-    0x61,
-    0x18,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x06,
-    0x06,
-    0x76,
-    0x66,
-    0x66,
-    0x66,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x66,
-    0x66,
-    0x66,
-    0x7E,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x66,
-    0x66,
-    0x66,
-    0x06,
-    0x00,
-    0x80,
-    0x31,
-    0xC6,
-    0x18,
-    0x63,
-    0x8C,
-    0xB1,
-    0x03,
-    0x00,
-    0xE6,
-    0x66,
-    0x36,
-    0x1E,
-    0x3E,
-    0x36,
-    0x66,
-    0xE6,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x61,
-    0x18,
-    0x86,
-    0x61,
-    0x18,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x9C,
-    0xE3,
-    0xBC,
-    0xE7,
-    0x3D,
-    0xEF,
-    0x59,
-    0xCD,
-    0x6E,
-    0x76,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9C,
-    0x39,
-    0xF3,
-    0xE6,
-    0xCD,
-    0x9E,
-    0x3D,
-    0x73,
-    0xE6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x18,
-    0x33,
-    0x66,
-    0xCC,
-    0x98,
-    0x31,
-    0x63,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9F,
-    0xCD,
-    0x66,
-    0xF3,
-    0x19,
-    0x0C,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x18,
-    0x33,
-    0x66,
-    0xCC,
-    0x98,
-    0x31,
-    0x63,
-    0x7C,
-    0xC0,
-    0x00,
-    0x03,
-    0x00,
-    0x00,
-    0x1E,
-    0x36,
-    0x36,
-    0x36,
-    0x1E,
-    0x36,
-    0x36,
-    0x66,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6F,
-    0x18,
-    0x0E,
-    0x87,
-    0xE7,
-    0x1E,
-    0x00,
-    0x00,
-    0xC0,
-    0xCF,
-    0x30,
-    0x0C,
-    0xC3,
-    0x30,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x66,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x3C,
-    0xCF,
-    0xB3,
-    0xE7,
-    0x79,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x98,
-    0xB3,
-    0xDD,
-    0xEC,
-    0x66,
-    0x35,
-    0xAB,
-    0x71,
-    0x87,
-    0x3B,
-    0xD8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0x66,
-    0x3C,
-    0x3C,
-    0x3C,
-    0x3C,
-    0x66,
-    0xC3,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xB1,
-    0xCD,
-    0xC6,
-    0xC1,
-    0x60,
-    0x30,
-    0x18,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x3F,
-    0x0C,
-    0x87,
-    0x61,
-    0x38,
-    0x0C,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x1B,
-    0x63,
-    0x8C,
-    0x31,
-    0xC6,
-    0x78,
-    0x00,
-    0x60,
-    0x08,
-    0x63,
-    0x18,
-    0x43,
-    0x18,
-    0x00,
-    0x00,
-    0xE0,
-    0x31,
-    0xC6,
-    0x18,
-    0x63,
-    0x8C,
-    0x3D,
-    0x00,
-    0x00,
-    0x06,
-    0xC3,
-    0x23,
-    0x99,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x03,
-    0x0C,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0xF3,
-    0xCD,
-    0x66,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x83,
-    0xC1,
-    0x67,
-    0xB3,
-    0xDB,
-    0x6D,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xC6,
-    0x71,
-    0x18,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x18,
-    0x8C,
-    0x67,
-    0xBB,
-    0xDD,
-    0x6C,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x67,
-    0xFE,
-    0x1F,
-    0x0C,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x67,
-    0x7C,
-    0x86,
-    0x61,
-    0x18,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x6F,
-    0xB3,
-    0x79,
-    0x0C,
-    0xBE,
-    0xF1,
-    0xD8,
-    0x07,
-    0x00,
-    0x83,
-    0xC1,
-    0x67,
-    0xB3,
-    0xD9,
-    0x6C,
-    0x36,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x60,
-    0x66,
-    0x66,
-    0x06,
-    0x00,
-    0x80,
-    0x01,
-    0xC6,
-    0x18,
-    0x63,
-    0x8C,
-    0x31,
-    0x03,
-    0x00,
-    0x83,
-    0xC1,
-    0xE6,
-    0xF3,
-    0x78,
-    0x6C,
-    0x76,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x66,
-    0x66,
-    0x66,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x76,
-    0xB6,
-    0xD9,
-    0x66,
-    0x9B,
-    0x6D,
-    0xB6,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x67,
-    0xB3,
-    0xD9,
-    0x6C,
-    0x36,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x63,
-    0xBB,
-    0xDF,
-    0x6D,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x67,
-    0xB3,
-    0xDB,
-    0x6D,
-    0x3E,
-    0x83,
-    0xC1,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x67,
-    0xBB,
-    0xDD,
-    0x6C,
-    0x3E,
-    0x18,
-    0x0C,
-    0x06,
-    0x00,
-    0x00,
-    0xED,
-    0x8D,
-    0x31,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x86,
-    0xC7,
-    0xC3,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x98,
-    0x6F,
-    0x8C,
-    0x31,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x66,
-    0xB3,
-    0xD9,
-    0x6C,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x6C,
-    0xB3,
-    0xD9,
-    0x38,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0xCC,
-    0xB6,
-    0xF9,
-    0xE7,
-    0x1F,
-    0x33,
-    0xCC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x6E,
-    0xE3,
-    0x70,
-    0x6C,
-    0x77,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x6C,
-    0xB3,
-    0xD1,
-    0x38,
-    0x1C,
-    0x06,
-    0xC3,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0x18,
-    0xC3,
-    0x18,
-    0x3F,
-    0x00,
-    0x00,
-    0x80,
-    0x33,
-    0xC6,
-    0xCE,
-    0x61,
-    0x8C,
-    0x71,
-    0x00,
-    0x00,
-    0xC3,
-    0x30,
-    0x0C,
-    0xC3,
-    0x30,
-    0x0C,
-    0xC3,
-    0x30,
-    0xE0,
-    0x18,
-    0x63,
-    0x38,
-    0x37,
-    0xC6,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6F,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x27,
-    0x49,
-    0x92,
-    0x24,
-    0x49,
-    0x1E,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_EXTRABOLD_11PX = [
-    FontCharacter(3, 5, 0),
-    FontCharacter(3, 5, 5),
-    FontCharacter(6, 9, 10),
-    FontCharacter(7, 11, 19),
-    FontCharacter(6, 9, 30),
-    FontCharacter(10, 15, 39),
-    FontCharacter(9, 14, 54),
-    FontCharacter(3, 5, 68),
-    FontCharacter(4, 6, 73),
-    FontCharacter(4, 6, 79),
-    FontCharacter(6, 9, 85),
-    FontCharacter(6, 9, 94),
-    FontCharacter(3, 5, 103),
-    FontCharacter(4, 6, 108),
-    FontCharacter(3, 5, 114),
-    FontCharacter(5, 8, 119),
-    FontCharacter(8, 12, 127),
-    FontCharacter(6, 9, 139),
-    FontCharacter(7, 11, 148),
-    FontCharacter(7, 11, 159),
-    FontCharacter(8, 12, 170),
-    FontCharacter(6, 9, 182),
-    FontCharacter(8, 12, 191),
-    FontCharacter(7, 11, 203),
-    FontCharacter(8, 12, 214),
-    FontCharacter(8, 12, 226),
-    FontCharacter(3, 5, 238),
-    FontCharacter(3, 5, 243),
-    FontCharacter(5, 8, 248),
-    FontCharacter(6, 9, 256),
-    FontCharacter(5, 8, 265),
-    FontCharacter(6, 9, 273),
-    FontCharacter(10, 15, 282),
-    FontCharacter(8, 12, 297),
-    FontCharacter(7, 11, 309),
-    FontCharacter(7, 11, 320),
-    FontCharacter(8, 12, 331),
-    FontCharacter(6, 9, 343),
-    FontCharacter(6, 9, 352),
-    FontCharacter(8, 12, 361),
-    FontCharacter(8, 12, 373),
-    FontCharacter(4, 6, 385),
-    FontCharacter(5, 8, 391),
-    FontCharacter(8, 12, 399),
-    FontCharacter(6, 9, 411),
-    FontCharacter(11, 17, 420),
-    FontCharacter(9, 14, 437),
-    FontCharacter(9, 14, 451),
-    FontCharacter(7, 11, 465),
-    FontCharacter(9, 14, 476),
-    FontCharacter(8, 12, 490),
-    FontCharacter(6, 9, 502),
-    FontCharacter(6, 9, 511),
-    FontCharacter(8, 12, 520),
-    FontCharacter(6, 9, 532),
-    FontCharacter(11, 17, 541),
-    FontCharacter(8, 12, 558),
-    FontCharacter(7, 11, 570),
-    FontCharacter(7, 11, 581),
-    FontCharacter(5, 8, 592),
-    FontCharacter(5, 8, 600),
-    FontCharacter(5, 8, 608),
-    FontCharacter(7, 11, 616),
-    FontCharacter(6, 9, 627),
-    FontCharacter(7, 11, 636),
-    FontCharacter(7, 11, 647),
-    FontCharacter(7, 11, 658),
-    FontCharacter(6, 9, 669),
-    FontCharacter(7, 11, 678),
-    FontCharacter(7, 11, 689),
-    FontCharacter(6, 9, 700),
-    FontCharacter(7, 11, 709),
-    FontCharacter(7, 11, 720),
-    FontCharacter(4, 6, 731),
-    FontCharacter(5, 8, 737),
-    FontCharacter(7, 11, 745),
-    FontCharacter(4, 6, 756),
-    FontCharacter(10, 15, 762),
-    FontCharacter(7, 11, 777),
-    FontCharacter(7, 11, 788),
-    FontCharacter(7, 11, 799),
-    FontCharacter(7, 11, 810),
-    FontCharacter(5, 8, 821),
-    FontCharacter(6, 9, 829),
-    FontCharacter(5, 8, 838),
-    FontCharacter(7, 11, 846),
-    FontCharacter(7, 11, 857),
-    FontCharacter(10, 15, 868),
-    FontCharacter(7, 11, 883),
-    FontCharacter(7, 11, 894),
-    FontCharacter(6, 9, 905),
-    FontCharacter(5, 8, 914),
-    FontCharacter(6, 9, 922),
-    FontCharacter(5, 8, 931),
-    FontCharacter(6, 9, 939),
-    FontCharacter(6, 9, 948),
-]
+_FONTS: list[Font] | None = None
 
-bitmapOPEN_SANS_REGULAR_11PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x24,
-    0x09,
-    0x02,
-    0x00,
-    0x60,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xC9,
-    0x4F,
-    0xA1,
-    0xFC,
-    0x24,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x29,
-    0x0A,
-    0x83,
-    0x61,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x8C,
-    0xA8,
-    0x50,
-    0xA1,
-    0xCD,
-    0x16,
-    0x2A,
-    0x54,
-    0xC4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1C,
-    0x12,
-    0x12,
-    0x0C,
-    0x4A,
-    0x52,
-    0x22,
-    0x5E,
-    0x00,
-    0x00,
-    0x00,
-    0x28,
-    0x00,
-    0x00,
-    0x90,
-    0x94,
-    0x24,
-    0x92,
-    0x00,
-    0x90,
-    0x44,
-    0x92,
-    0x92,
-    0x00,
-    0x00,
-    0x41,
-    0xFC,
-    0x8C,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC8,
-    0x8F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x52,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x02,
-    0x00,
-    0x80,
-    0x44,
-    0x24,
-    0x22,
-    0x01,
-    0x00,
-    0x00,
-    0x23,
-    0x49,
-    0x92,
-    0x24,
-    0x49,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0xA3,
-    0x20,
-    0x08,
-    0x82,
-    0x20,
-    0x08,
-    0x00,
-    0x00,
-    0x80,
-    0x03,
-    0x41,
-    0x10,
-    0x42,
-    0x08,
-    0x1E,
-    0x00,
-    0x00,
-    0x80,
-    0x03,
-    0x41,
-    0x0C,
-    0x04,
-    0x41,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x30,
-    0x28,
-    0x24,
-    0x24,
-    0x7E,
-    0x20,
-    0x20,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x27,
-    0x08,
-    0x1E,
-    0x04,
-    0x41,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x27,
-    0x08,
-    0x9E,
-    0x24,
-    0x49,
-    0x0C,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x41,
-    0x08,
-    0x42,
-    0x10,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x23,
-    0x49,
-    0x8C,
-    0x24,
-    0x49,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x23,
-    0x49,
-    0x92,
-    0x07,
-    0x41,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x00,
-    0x02,
-    0x00,
-    0x00,
-    0x04,
-    0x00,
-    0x52,
-    0x00,
-    0x00,
-    0x00,
-    0x21,
-    0x86,
-    0x81,
-    0x40,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1E,
-    0xE0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x10,
-    0x18,
-    0x46,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x41,
-    0x88,
-    0x08,
-    0x01,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x43,
-    0x90,
-    0x5C,
-    0x4A,
-    0x29,
-    0xA5,
-    0x94,
-    0x7E,
-    0x02,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x85,
-    0x42,
-    0x11,
-    0xF9,
-    0x44,
-    0x41,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9F,
-    0x48,
-    0xE4,
-    0x11,
-    0x89,
-    0x44,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9E,
-    0x41,
-    0x20,
-    0x10,
-    0x08,
-    0x0C,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3E,
-    0x42,
-    0x42,
-    0x42,
-    0x42,
-    0x42,
-    0x42,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x27,
-    0x08,
-    0x9E,
-    0x20,
-    0x08,
-    0x1E,
-    0x00,
-    0x00,
-    0x80,
-    0x2F,
-    0x08,
-    0x82,
-    0x2F,
-    0x08,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x02,
-    0x02,
-    0x02,
-    0x62,
-    0x42,
-    0x42,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x42,
-    0x42,
-    0x42,
-    0x7E,
-    0x42,
-    0x42,
-    0x42,
-    0x42,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x24,
-    0x49,
-    0x02,
-    0x00,
-    0x40,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x03,
-    0x00,
-    0x91,
-    0x44,
-    0x61,
-    0x50,
-    0x48,
-    0x44,
-    0x42,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x20,
-    0x08,
-    0x82,
-    0x20,
-    0x08,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x18,
-    0x66,
-    0x98,
-    0x61,
-    0x4A,
-    0x29,
-    0x25,
-    0x93,
-    0x4C,
-    0x32,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x42,
-    0x46,
-    0x4A,
-    0x4A,
-    0x52,
-    0x52,
-    0x62,
-    0x42,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x08,
-    0x12,
-    0x24,
-    0x48,
-    0x90,
-    0x20,
-    0x41,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x8F,
-    0x48,
-    0x24,
-    0xF2,
-    0x08,
-    0x04,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x08,
-    0x12,
-    0x24,
-    0x48,
-    0x90,
-    0x20,
-    0x41,
-    0x7C,
-    0x40,
-    0x00,
-    0x01,
-    0x00,
-    0x00,
-    0x8F,
-    0x48,
-    0x24,
-    0xF2,
-    0x48,
-    0x44,
-    0x22,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x27,
-    0x08,
-    0x06,
-    0x06,
-    0x41,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x02,
-    0x81,
-    0x40,
-    0x20,
-    0x10,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x42,
-    0x42,
-    0x42,
-    0x42,
-    0x42,
-    0x42,
-    0x42,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xA0,
-    0x48,
-    0x24,
-    0xA2,
-    0x50,
-    0x28,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0x28,
-    0x93,
-    0x4C,
-    0x4A,
-    0x29,
-    0xA5,
-    0x14,
-    0x21,
-    0x84,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x28,
-    0x31,
-    0x0C,
-    0x23,
-    0x49,
-    0x21,
-    0x00,
-    0x00,
-    0x40,
-    0x28,
-    0x49,
-    0x0C,
-    0x82,
-    0x20,
-    0x08,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x21,
-    0x08,
-    0x21,
-    0x08,
-    0x1E,
-    0x00,
-    0x00,
-    0xE0,
-    0x22,
-    0x22,
-    0x22,
-    0x22,
-    0x0E,
-    0x10,
-    0x22,
-    0x42,
-    0x44,
-    0x08,
-    0x00,
-    0x70,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x07,
-    0x00,
-    0xC3,
-    0x48,
-    0x52,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0x04,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x90,
-    0x27,
-    0x49,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x81,
-    0xC0,
-    0x23,
-    0x12,
-    0x89,
-    0x44,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2E,
-    0x84,
-    0x10,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x88,
-    0x27,
-    0x12,
-    0x89,
-    0x44,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x92,
-    0x27,
-    0x08,
-    0x1C,
-    0x00,
-    0x00,
-    0x80,
-    0x89,
-    0x27,
-    0x84,
-    0x10,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x92,
-    0xE4,
-    0x08,
-    0x5E,
-    0x18,
-    0x7A,
-    0x00,
-    0x81,
-    0xC0,
-    0x23,
-    0x12,
-    0x89,
-    0x44,
-    0x22,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x24,
-    0x49,
-    0x02,
-    0x00,
-    0x40,
-    0x40,
-    0x44,
-    0x44,
-    0x44,
-    0x74,
-    0x80,
-    0x20,
-    0x48,
-    0x8A,
-    0xA1,
-    0x48,
-    0x12,
-    0x00,
-    0x00,
-    0x90,
-    0x24,
-    0x49,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x77,
-    0x22,
-    0x89,
-    0x24,
-    0x92,
-    0x48,
-    0x22,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x23,
-    0x12,
-    0x89,
-    0x44,
-    0x22,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x23,
-    0x12,
-    0x89,
-    0x44,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x23,
-    0x12,
-    0x89,
-    0x44,
-    0x1E,
-    0x81,
-    0x40,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x27,
-    0x12,
-    0x89,
-    0x44,
-    0x3C,
-    0x10,
-    0x08,
-    0x04,
-    0x00,
-    0xE0,
-    0x22,
-    0x22,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x27,
-    0x0C,
-    0x82,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x22,
-    0x22,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x24,
-    0x12,
-    0x89,
-    0x44,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x84,
-    0x92,
-    0x24,
-    0x31,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x88,
-    0xA8,
-    0x4A,
-    0x95,
-    0x2A,
-    0x22,
-    0x44,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x48,
-    0x12,
-    0xC3,
-    0x48,
-    0x12,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x84,
-    0x92,
-    0x24,
-    0x31,
-    0x0C,
-    0x41,
-    0x0C,
-    0x00,
-    0x80,
-    0x8F,
-    0x08,
-    0x11,
-    0x1F,
-    0x00,
-    0x00,
-    0xC0,
-    0x44,
-    0x24,
-    0x42,
-    0x44,
-    0x0C,
-    0x00,
-    0x82,
-    0x20,
-    0x08,
-    0x82,
-    0x20,
-    0x08,
-    0x82,
-    0x20,
-    0x30,
-    0x22,
-    0x42,
-    0x24,
-    0x22,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9F,
-    0x48,
-    0x24,
-    0x12,
-    0x89,
-    0x44,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_REGULAR_11PX = [
-    FontCharacter(3, 5, 0),
-    FontCharacter(3, 5, 5),
-    FontCharacter(4, 6, 10),
-    FontCharacter(7, 11, 16),
-    FontCharacter(6, 9, 27),
-    FontCharacter(9, 14, 36),
-    FontCharacter(8, 12, 50),
-    FontCharacter(2, 3, 62),
-    FontCharacter(3, 5, 65),
-    FontCharacter(3, 5, 70),
-    FontCharacter(6, 9, 75),
-    FontCharacter(6, 9, 84),
-    FontCharacter(3, 5, 93),
-    FontCharacter(4, 6, 98),
-    FontCharacter(3, 5, 104),
-    FontCharacter(4, 6, 109),
-    FontCharacter(6, 9, 115),
-    FontCharacter(6, 9, 124),
-    FontCharacter(6, 9, 133),
-    FontCharacter(6, 9, 142),
-    FontCharacter(8, 12, 151),
-    FontCharacter(6, 9, 163),
-    FontCharacter(6, 9, 172),
-    FontCharacter(6, 9, 181),
-    FontCharacter(6, 9, 190),
-    FontCharacter(6, 9, 199),
-    FontCharacter(3, 5, 208),
-    FontCharacter(3, 5, 213),
-    FontCharacter(6, 9, 218),
-    FontCharacter(6, 9, 227),
-    FontCharacter(6, 9, 236),
-    FontCharacter(5, 8, 245),
-    FontCharacter(10, 15, 253),
-    FontCharacter(7, 11, 268),
-    FontCharacter(7, 11, 279),
-    FontCharacter(7, 11, 290),
-    FontCharacter(8, 12, 301),
-    FontCharacter(6, 9, 313),
-    FontCharacter(6, 9, 322),
-    FontCharacter(8, 12, 331),
-    FontCharacter(8, 12, 343),
-    FontCharacter(3, 5, 355),
-    FontCharacter(4, 6, 360),
-    FontCharacter(7, 11, 366),
-    FontCharacter(6, 9, 377),
-    FontCharacter(10, 15, 386),
-    FontCharacter(8, 12, 401),
-    FontCharacter(9, 14, 413),
-    FontCharacter(7, 11, 427),
-    FontCharacter(9, 14, 438),
-    FontCharacter(7, 11, 452),
-    FontCharacter(6, 9, 463),
-    FontCharacter(7, 11, 472),
-    FontCharacter(8, 12, 483),
-    FontCharacter(7, 11, 495),
-    FontCharacter(10, 15, 506),
-    FontCharacter(6, 9, 521),
-    FontCharacter(6, 9, 530),
-    FontCharacter(6, 9, 539),
-    FontCharacter(4, 6, 548),
-    FontCharacter(4, 6, 554),
-    FontCharacter(4, 6, 560),
-    FontCharacter(6, 9, 566),
-    FontCharacter(5, 8, 575),
-    FontCharacter(6, 9, 583),
-    FontCharacter(6, 9, 592),
-    FontCharacter(7, 11, 601),
-    FontCharacter(5, 8, 612),
-    FontCharacter(7, 11, 620),
-    FontCharacter(6, 9, 631),
-    FontCharacter(5, 8, 640),
-    FontCharacter(6, 9, 648),
-    FontCharacter(7, 11, 657),
-    FontCharacter(3, 5, 668),
-    FontCharacter(4, 6, 673),
-    FontCharacter(6, 9, 679),
-    FontCharacter(3, 5, 688),
-    FontCharacter(10, 15, 693),
-    FontCharacter(7, 11, 708),
-    FontCharacter(7, 11, 719),
-    FontCharacter(7, 11, 730),
-    FontCharacter(7, 11, 741),
-    FontCharacter(4, 6, 752),
-    FontCharacter(5, 8, 758),
-    FontCharacter(4, 6, 766),
-    FontCharacter(7, 11, 772),
-    FontCharacter(6, 9, 783),
-    FontCharacter(9, 14, 792),
-    FontCharacter(6, 9, 806),
-    FontCharacter(6, 9, 815),
-    FontCharacter(5, 8, 824),
-    FontCharacter(4, 6, 832),
-    FontCharacter(6, 9, 838),
-    FontCharacter(4, 6, 847),
-    FontCharacter(6, 9, 853),
-    FontCharacter(7, 11, 862),
-]
 
-bitmapOPEN_SANS_LIGHT_16PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x24,
-    0x49,
-    0x02,
-    0x24,
-    0x00,
-    0x00,
-    0x80,
-    0x24,
-    0x49,
-    0x12,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x02,
-    0x09,
-    0x22,
-    0x88,
-    0xF8,
-    0x8F,
-    0x04,
-    0x12,
-    0xFF,
-    0x11,
-    0x41,
-    0x04,
-    0x09,
-    0x24,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xE0,
-    0xA1,
-    0x20,
-    0x41,
-    0x02,
-    0x05,
-    0x1C,
-    0x70,
-    0x20,
-    0x41,
-    0x92,
-    0xC2,
-    0x03,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x41,
-    0x48,
-    0x04,
-    0x89,
-    0x20,
-    0x09,
-    0x24,
-    0x81,
-    0x94,
-    0x61,
-    0x4A,
-    0x20,
-    0x09,
-    0x24,
-    0x41,
-    0x24,
-    0x88,
-    0x84,
-    0x60,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x01,
-    0x11,
-    0x88,
-    0x40,
-    0x04,
-    0x14,
-    0x60,
-    0x80,
-    0x44,
-    0x42,
-    0x12,
-    0x94,
-    0x40,
-    0x0C,
-    0xC3,
-    0x27,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x24,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x24,
-    0x22,
-    0x22,
-    0x22,
-    0x22,
-    0x22,
-    0x44,
-    0x00,
-    0x20,
-    0x42,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x22,
-    0x00,
-    0x10,
-    0x20,
-    0x40,
-    0xF0,
-    0x87,
-    0x02,
-    0x05,
-    0x11,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x00,
-    0x01,
-    0x82,
-    0x3F,
-    0x08,
-    0x10,
-    0x20,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x24,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x22,
-    0x84,
-    0x08,
-    0x21,
-    0x44,
-    0x08,
-    0x11,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x10,
-    0x11,
-    0x24,
-    0x48,
-    0x90,
-    0x20,
-    0x41,
-    0x82,
-    0x04,
-    0x09,
-    0x22,
-    0x82,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x60,
-    0xA0,
-    0x00,
-    0x01,
-    0x02,
-    0x04,
-    0x08,
-    0x10,
-    0x20,
-    0x40,
-    0x80,
-    0x00,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x08,
-    0x01,
-    0x02,
-    0x04,
-    0x08,
-    0x10,
-    0x10,
-    0x10,
-    0x10,
-    0x10,
-    0x10,
-    0xE0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x08,
-    0x01,
-    0x04,
-    0x04,
-    0x0C,
-    0x0F,
-    0x20,
-    0x80,
-    0x00,
-    0x01,
-    0x02,
-    0xE2,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x30,
-    0x40,
-    0x01,
-    0x09,
-    0x48,
-    0x20,
-    0x82,
-    0x10,
-    0x84,
-    0xF0,
-    0x1F,
-    0x20,
-    0x00,
-    0x01,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x10,
-    0x20,
-    0x40,
-    0x40,
-    0x80,
-    0x0F,
-    0x60,
-    0x80,
-    0x00,
-    0x01,
-    0x12,
-    0xC2,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x30,
-    0x20,
-    0x20,
-    0x40,
-    0x80,
-    0x1E,
-    0x43,
-    0x82,
-    0x04,
-    0x09,
-    0x22,
-    0x84,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0x01,
-    0x02,
-    0x02,
-    0x04,
-    0x08,
-    0x08,
-    0x10,
-    0x10,
-    0x20,
-    0x40,
-    0x40,
-    0x80,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x10,
-    0x11,
-    0x24,
-    0x88,
-    0x08,
-    0x0E,
-    0x22,
-    0x82,
-    0x04,
-    0x09,
-    0x12,
-    0xC4,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x08,
-    0x11,
-    0x24,
-    0x48,
-    0x90,
-    0x30,
-    0x5E,
-    0x80,
-    0x00,
-    0x01,
-    0x01,
-    0xC3,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x66,
-    0x00,
-    0x00,
-    0x60,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x66,
-    0x00,
-    0x00,
-    0x20,
-    0x22,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x06,
-    0x83,
-    0x01,
-    0x0C,
-    0x60,
-    0x00,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x1F,
-    0x00,
-    0x00,
-    0xFE,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xC0,
-    0x00,
-    0x06,
-    0x30,
-    0x18,
-    0x0C,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x08,
-    0x04,
-    0x02,
-    0x41,
-    0x10,
-    0x04,
-    0x02,
-    0x80,
-    0x40,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x80,
-    0x41,
-    0x10,
-    0x20,
-    0xC4,
-    0x93,
-    0x88,
-    0x24,
-    0x21,
-    0x49,
-    0x48,
-    0x12,
-    0x92,
-    0xC4,
-    0x24,
-    0xEE,
-    0x08,
-    0x00,
-    0x04,
-    0x00,
-    0x02,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x00,
-    0x03,
-    0x0C,
-    0x48,
-    0x20,
-    0x81,
-    0x04,
-    0x21,
-    0xFC,
-    0x08,
-    0x24,
-    0x90,
-    0x40,
-    0x01,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x41,
-    0x08,
-    0x41,
-    0x04,
-    0x11,
-    0xC2,
-    0x07,
-    0x21,
-    0x04,
-    0x11,
-    0x44,
-    0x10,
-    0x21,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x87,
-    0x00,
-    0x01,
-    0x02,
-    0x08,
-    0x20,
-    0x80,
-    0x00,
-    0x02,
-    0x08,
-    0x40,
-    0x00,
-    0x02,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x03,
-    0x21,
-    0x08,
-    0x42,
-    0x20,
-    0x02,
-    0x11,
-    0x88,
-    0x40,
-    0x04,
-    0x22,
-    0x10,
-    0x41,
-    0x08,
-    0xC1,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x11,
-    0x20,
-    0x40,
-    0x80,
-    0x00,
-    0x3F,
-    0x02,
-    0x04,
-    0x08,
-    0x10,
-    0x20,
-    0xC0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0xFC,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3F,
-    0x08,
-    0x40,
-    0x00,
-    0x02,
-    0x20,
-    0x00,
-    0x02,
-    0x20,
-    0x7C,
-    0x02,
-    0x24,
-    0x40,
-    0x04,
-    0x84,
-    0x40,
-    0xF0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x20,
-    0x04,
-    0x42,
-    0x20,
-    0x04,
-    0x42,
-    0x20,
-    0xFC,
-    0x43,
-    0x20,
-    0x04,
-    0x42,
-    0x20,
-    0x04,
-    0x42,
-    0x20,
-    0x04,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x02,
-    0x81,
-    0x40,
-    0x20,
-    0x10,
-    0x08,
-    0x04,
-    0x02,
-    0x81,
-    0x40,
-    0x20,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x08,
-    0x12,
-    0x22,
-    0x42,
-    0x82,
-    0x02,
-    0x03,
-    0x0A,
-    0x24,
-    0x88,
-    0x10,
-    0x21,
-    0x44,
-    0x10,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0x04,
-    0xFC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x01,
-    0x42,
-    0xC0,
-    0x30,
-    0x30,
-    0x0C,
-    0x0C,
-    0x85,
-    0x42,
-    0xA1,
-    0x50,
-    0x28,
-    0x24,
-    0x09,
-    0x49,
-    0x42,
-    0x8C,
-    0x10,
-    0x23,
-    0x04,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x20,
-    0x0C,
-    0xC2,
-    0x20,
-    0x14,
-    0x42,
-    0x21,
-    0x24,
-    0x42,
-    0x24,
-    0x44,
-    0x42,
-    0x28,
-    0x04,
-    0x43,
-    0x30,
-    0x04,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x08,
-    0x41,
-    0x20,
-    0x02,
-    0x24,
-    0x40,
-    0x02,
-    0x24,
-    0x40,
-    0x02,
-    0x24,
-    0x40,
-    0x04,
-    0x82,
-    0x10,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x10,
-    0x22,
-    0x44,
-    0x88,
-    0x10,
-    0x21,
-    0x3E,
-    0x04,
-    0x08,
-    0x10,
-    0x20,
-    0x40,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x08,
-    0x41,
-    0x20,
-    0x02,
-    0x24,
-    0x40,
-    0x02,
-    0x24,
-    0x40,
-    0x02,
-    0x24,
-    0x40,
-    0x04,
-    0x82,
-    0x10,
-    0xF0,
-    0x00,
-    0x08,
-    0x00,
-    0x01,
-    0x30,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x41,
-    0x08,
-    0x41,
-    0x04,
-    0x11,
-    0x44,
-    0x08,
-    0x1F,
-    0x44,
-    0x10,
-    0x41,
-    0x08,
-    0x41,
-    0x04,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x08,
-    0x12,
-    0x20,
-    0x40,
-    0x00,
-    0x07,
-    0x30,
-    0x80,
-    0x00,
-    0x01,
-    0x02,
-    0xE4,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x3F,
-    0x02,
-    0x81,
-    0x40,
-    0x20,
-    0x10,
-    0x08,
-    0x04,
-    0x02,
-    0x81,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x20,
-    0x04,
-    0x42,
-    0x20,
-    0x04,
-    0x42,
-    0x20,
-    0x04,
-    0x42,
-    0x20,
-    0x04,
-    0x42,
-    0x20,
-    0x04,
-    0x82,
-    0x10,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x02,
-    0x06,
-    0x14,
-    0x24,
-    0x48,
-    0x10,
-    0x11,
-    0x22,
-    0x44,
-    0x50,
-    0xA0,
-    0x80,
-    0x00,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x30,
-    0x28,
-    0x0C,
-    0x09,
-    0x43,
-    0x22,
-    0x91,
-    0x48,
-    0x44,
-    0x92,
-    0x90,
-    0x24,
-    0x14,
-    0x0A,
-    0x85,
-    0x82,
-    0x61,
-    0x60,
-    0x18,
-    0x08,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x09,
-    0x22,
-    0x82,
-    0x04,
-    0x05,
-    0x04,
-    0x14,
-    0x28,
-    0x88,
-    0x10,
-    0x11,
-    0x14,
-    0x10,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x81,
-    0x42,
-    0x42,
-    0x24,
-    0x24,
-    0x18,
-    0x18,
-    0x10,
-    0x10,
-    0x10,
-    0x10,
-    0x10,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0x01,
-    0x02,
-    0x02,
-    0x04,
-    0x04,
-    0x04,
-    0x08,
-    0x08,
-    0x08,
-    0x10,
-    0x10,
-    0xE0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x0B,
-    0x21,
-    0x84,
-    0x10,
-    0x42,
-    0x08,
-    0x21,
-    0x84,
-    0xF0,
-    0x00,
-    0x00,
-    0x20,
-    0x08,
-    0x21,
-    0x08,
-    0x21,
-    0x04,
-    0x21,
-    0x04,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x21,
-    0x84,
-    0x10,
-    0x42,
-    0x08,
-    0x21,
-    0x84,
-    0x10,
-    0x7A,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xA0,
-    0x40,
-    0x41,
-    0x84,
-    0x88,
-    0x20,
-    0x41,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0x01,
-    0x00,
-    0x00,
-    0x08,
-    0x20,
-    0x80,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x40,
-    0x40,
-    0x40,
-    0x7C,
-    0x42,
-    0x42,
-    0x62,
-    0x5C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x02,
-    0x08,
-    0x20,
-    0x80,
-    0x00,
-    0x7A,
-    0x18,
-    0x22,
-    0x90,
-    0x40,
-    0x02,
-    0x09,
-    0x24,
-    0x90,
-    0x21,
-    0x7A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x04,
-    0x02,
-    0x02,
-    0x02,
-    0x02,
-    0x02,
-    0x04,
-    0x78,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x01,
-    0x04,
-    0x10,
-    0x40,
-    0x78,
-    0x11,
-    0x26,
-    0x90,
-    0x40,
-    0x02,
-    0x09,
-    0x24,
-    0x10,
-    0x61,
-    0x78,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x83,
-    0x88,
-    0x20,
-    0x41,
-    0xFE,
-    0x04,
-    0x08,
-    0x20,
-    0x84,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x38,
-    0x41,
-    0x10,
-    0x1F,
-    0x41,
-    0x10,
-    0x04,
-    0x41,
-    0x10,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0x22,
-    0x42,
-    0x42,
-    0x22,
-    0x3C,
-    0x04,
-    0x02,
-    0x7C,
-    0x42,
-    0x81,
-    0x43,
-    0x3E,
-    0x00,
-    0x02,
-    0x04,
-    0x08,
-    0x10,
-    0xA0,
-    0xC3,
-    0x88,
-    0x20,
-    0x41,
-    0x82,
-    0x04,
-    0x09,
-    0x12,
-    0x24,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x02,
-    0x20,
-    0x22,
-    0x22,
-    0x22,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x00,
-    0x08,
-    0x21,
-    0x84,
-    0x10,
-    0x42,
-    0x08,
-    0x21,
-    0x07,
-    0x00,
-    0x02,
-    0x02,
-    0x02,
-    0x02,
-    0x42,
-    0x22,
-    0x12,
-    0x0A,
-    0x0A,
-    0x16,
-    0x22,
-    0x42,
-    0x82,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x44,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3A,
-    0x87,
-    0x31,
-    0x22,
-    0x08,
-    0x09,
-    0x42,
-    0x82,
-    0x90,
-    0x20,
-    0x24,
-    0x08,
-    0x09,
-    0x42,
-    0x82,
-    0x10,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0xC3,
-    0x88,
-    0x20,
-    0x41,
-    0x82,
-    0x04,
-    0x09,
-    0x12,
-    0x24,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x83,
-    0x88,
-    0x20,
-    0x41,
-    0x82,
-    0x04,
-    0x09,
-    0x22,
-    0x82,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7A,
-    0x18,
-    0x22,
-    0x90,
-    0x40,
-    0x02,
-    0x09,
-    0x24,
-    0x90,
-    0x21,
-    0x7A,
-    0x08,
-    0x20,
-    0x80,
-    0x00,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x11,
-    0x26,
-    0x90,
-    0x40,
-    0x02,
-    0x09,
-    0x24,
-    0x10,
-    0x61,
-    0x78,
-    0x01,
-    0x04,
-    0x10,
-    0x40,
-    0x00,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBA,
-    0x21,
-    0x08,
-    0x82,
-    0x20,
-    0x08,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x13,
-    0x08,
-    0x0C,
-    0x18,
-    0x10,
-    0x08,
-    0xE4,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x84,
-    0x10,
-    0x42,
-    0x08,
-    0xC1,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x48,
-    0x90,
-    0x20,
-    0x41,
-    0x82,
-    0x04,
-    0x09,
-    0x22,
-    0xC6,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0C,
-    0x8A,
-    0x44,
-    0x22,
-    0x0A,
-    0x85,
-    0x82,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x61,
-    0x28,
-    0x46,
-    0x62,
-    0x24,
-    0x49,
-    0x92,
-    0x44,
-    0x29,
-    0x0C,
-    0x83,
-    0x10,
-    0x08,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x42,
-    0x42,
-    0x24,
-    0x18,
-    0x18,
-    0x18,
-    0x24,
-    0x42,
-    0x42,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0C,
-    0x8A,
-    0x44,
-    0x22,
-    0x0A,
-    0x85,
-    0x82,
-    0x40,
-    0x10,
-    0x08,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x03,
-    0x41,
-    0x20,
-    0x08,
-    0x02,
-    0x41,
-    0xE0,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x46,
-    0x10,
-    0x04,
-    0x41,
-    0x10,
-    0x03,
-    0x41,
-    0x10,
-    0x04,
-    0x41,
-    0x60,
-    0x00,
-    0x00,
-    0x10,
-    0x20,
-    0x40,
-    0x80,
-    0x00,
-    0x01,
-    0x02,
-    0x04,
-    0x08,
-    0x10,
-    0x20,
-    0x40,
-    0x80,
-    0x00,
-    0x01,
-    0x02,
-    0x04,
-    0x08,
-    0x10,
-    0x00,
-    0x00,
-    0x80,
-    0x41,
-    0x20,
-    0x08,
-    0x82,
-    0x20,
-    0x30,
-    0x82,
-    0x20,
-    0x08,
-    0x42,
-    0x18,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x03,
-    0x78,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x0F,
-    0x21,
-    0x84,
-    0x10,
-    0x42,
-    0x08,
-    0x21,
-    0x84,
-    0x10,
-    0x42,
-    0x08,
-    0x21,
-    0xFC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_LIGHT_16PX = [
-    FontCharacter(3, 7, 9),
-    FontCharacter(6, 14, 16),
-    FontCharacter(10, 23, 30),
-    FontCharacter(9, 21, 53),
-    FontCharacter(13, 30, 74),
-    FontCharacter(11, 25, 104),
-    FontCharacter(3, 7, 129),
-    FontCharacter(4, 9, 136),
-    FontCharacter(4, 9, 145),
-    FontCharacter(9, 21, 154),
-    FontCharacter(9, 21, 175),
-    FontCharacter(3, 7, 196),
-    FontCharacter(5, 12, 203),
-    FontCharacter(4, 9, 215),
-    FontCharacter(5, 12, 224),
-    FontCharacter(9, 21, 236),
-    FontCharacter(9, 21, 257),
-    FontCharacter(9, 21, 278),
-    FontCharacter(9, 21, 299),
-    FontCharacter(11, 25, 320),
-    FontCharacter(9, 21, 345),
-    FontCharacter(9, 21, 366),
-    FontCharacter(9, 21, 387),
-    FontCharacter(9, 21, 408),
-    FontCharacter(9, 21, 429),
-    FontCharacter(4, 9, 450),
-    FontCharacter(4, 9, 459),
-    FontCharacter(9, 21, 468),
-    FontCharacter(9, 21, 489),
-    FontCharacter(9, 21, 510),
-    FontCharacter(7, 16, 531),
-    FontCharacter(14, 32, 547),
-    FontCharacter(10, 23, 579),
-    FontCharacter(10, 23, 602),
-    FontCharacter(10, 23, 625),
-    FontCharacter(11, 25, 648),
-    FontCharacter(9, 21, 673),
-    FontCharacter(8, 18, 694),
-    FontCharacter(12, 27, 712),
-    FontCharacter(12, 27, 739),
-    FontCharacter(4, 9, 766),
-    FontCharacter(7, 16, 775),
-    FontCharacter(9, 21, 791),
-    FontCharacter(8, 18, 812),
-    FontCharacter(14, 32, 830),
-    FontCharacter(12, 27, 862),
-    FontCharacter(12, 27, 889),
-    FontCharacter(9, 21, 916),
-    FontCharacter(12, 27, 937),
-    FontCharacter(10, 23, 964),
-    FontCharacter(9, 21, 987),
-    FontCharacter(7, 16, 1008),
-    FontCharacter(12, 27, 1024),
-    FontCharacter(9, 21, 1051),
-    FontCharacter(14, 32, 1072),
-    FontCharacter(9, 21, 1104),
-    FontCharacter(8, 18, 1125),
-    FontCharacter(9, 21, 1143),
-    FontCharacter(5, 12, 1164),
-    FontCharacter(5, 12, 1176),
-    FontCharacter(5, 12, 1188),
-    FontCharacter(9, 21, 1200),
-    FontCharacter(7, 16, 1221),
-    FontCharacter(9, 21, 1237),
-    FontCharacter(8, 18, 1258),
-    FontCharacter(10, 23, 1276),
-    FontCharacter(8, 18, 1299),
-    FontCharacter(10, 23, 1317),
-    FontCharacter(9, 21, 1340),
-    FontCharacter(6, 14, 1361),
-    FontCharacter(8, 18, 1375),
-    FontCharacter(9, 21, 1393),
-    FontCharacter(4, 9, 1414),
-    FontCharacter(5, 12, 1423),
-    FontCharacter(8, 18, 1435),
-    FontCharacter(4, 9, 1453),
-    FontCharacter(14, 32, 1462),
-    FontCharacter(9, 21, 1494),
-    FontCharacter(9, 21, 1515),
-    FontCharacter(10, 23, 1536),
-    FontCharacter(10, 23, 1559),
-    FontCharacter(6, 14, 1582),
-    FontCharacter(7, 16, 1596),
-    FontCharacter(5, 12, 1612),
-    FontCharacter(9, 21, 1624),
-    FontCharacter(7, 16, 1645),
-    FontCharacter(12, 27, 1661),
-    FontCharacter(8, 18, 1688),
-    FontCharacter(7, 16, 1706),
-    FontCharacter(7, 16, 1722),
-    FontCharacter(6, 14, 1738),
-    FontCharacter(9, 21, 1752),
-    FontCharacter(6, 14, 1773),
-    FontCharacter(9, 21, 1787),
-    FontCharacter(10, 23, 1808),
-]
+def load_font_pack(path: Path) -> list[Font]:
+    with path.open("rb") as f:
+        data = memoryview(mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ))
 
-bitmapOPEN_SANS_REGULAR_10_13PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3F,
-    0xF0,
-    0x01,
-    0x1E,
-    0xD0,
-    0x00,
-    0x0C,
-    0xB0,
-    0x00,
-    0x00,
-    0xA0,
-    0x02,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x1F,
-    0xD0,
-    0xD0,
-    0x00,
-    0x0B,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC1,
-    0x60,
-    0x07,
-    0x00,
-    0x85,
-    0xA0,
-    0x03,
-    0xD3,
-    0xEE,
-    0xFD,
-    0xAD,
-    0x00,
-    0x2A,
-    0xC0,
-    0x00,
-    0x00,
-    0x0D,
-    0xA3,
-    0x00,
-    0xDA,
-    0xDF,
-    0xEE,
-    0x3D,
-    0x30,
-    0x0A,
-    0x48,
-    0x00,
-    0x50,
-    0x07,
-    0x2B,
-    0x00,
-    0x80,
-    0x05,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0xD4,
-    0xDF,
-    0x0A,
-    0xE0,
-    0xD2,
-    0x10,
-    0x10,
-    0x0F,
-    0x0D,
-    0x00,
-    0xB0,
-    0xEA,
-    0x00,
-    0x00,
-    0x70,
-    0xBF,
-    0x02,
-    0x00,
-    0xD0,
-    0xE6,
-    0x00,
-    0x00,
-    0x0D,
-    0x1D,
-    0x11,
-    0xD0,
-    0xE2,
-    0x20,
-    0xEC,
-    0xCF,
-    0x03,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC9,
-    0x0A,
-    0x00,
-    0x59,
-    0x00,
-    0xB1,
-    0x70,
-    0x05,
-    0xB3,
-    0x00,
-    0x40,
-    0x08,
-    0x74,
-    0xC0,
-    0x02,
-    0x00,
-    0x84,
-    0x40,
-    0x57,
-    0xB9,
-    0x7C,
-    0x10,
-    0x0B,
-    0x68,
-    0x6D,
-    0x07,
-    0x1B,
-    0x80,
-    0xBC,
-    0x59,
-    0x48,
-    0x80,
-    0x03,
-    0x00,
-    0xC2,
-    0x80,
-    0x04,
-    0x38,
-    0x00,
-    0xB0,
-    0x03,
-    0x75,
-    0xB0,
-    0x01,
-    0x50,
-    0x09,
-    0x00,
-    0xCB,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0xDD,
-    0x03,
-    0x00,
-    0x60,
-    0x0A,
-    0xB5,
-    0x00,
-    0x00,
-    0x96,
-    0x40,
-    0x0C,
-    0x00,
-    0x10,
-    0x4E,
-    0x4D,
-    0x00,
-    0x00,
-    0xB0,
-    0x6F,
-    0x00,
-    0x00,
-    0xC0,
-    0x58,
-    0x2D,
-    0xC0,
-    0x33,
-    0x0C,
-    0x30,
-    0x7D,
-    0x0C,
-    0xE2,
-    0x02,
-    0x80,
-    0x6F,
-    0x00,
-    0xE7,
-    0xDF,
-    0x29,
-    0x6C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0xE0,
-    0x00,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x70,
-    0x09,
-    0xE0,
-    0x02,
-    0xD3,
-    0x00,
-    0xB5,
-    0x00,
-    0x97,
-    0x00,
-    0xB5,
-    0x00,
-    0xD3,
-    0x00,
-    0xE0,
-    0x02,
-    0x70,
-    0x09,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0x00,
-    0x90,
-    0x07,
-    0x20,
-    0x0E,
-    0x00,
-    0x3D,
-    0x00,
-    0x5B,
-    0x00,
-    0x79,
-    0x00,
-    0x5B,
-    0x00,
-    0x3D,
-    0x20,
-    0x0E,
-    0x90,
-    0x08,
-    0xC3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0xE5,
-    0xD9,
-    0xE9,
-    0x05,
-    0x71,
-    0x7E,
-    0x01,
-    0x00,
-    0x3E,
-    0x0D,
-    0x00,
-    0x94,
-    0x90,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x60,
-    0xDD,
-    0xDF,
-    0x8D,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0x80,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x40,
-    0x0B,
-    0x57,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x02,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA6,
-    0x00,
-    0xD0,
-    0x03,
-    0x30,
-    0x0D,
-    0x00,
-    0x6A,
-    0x00,
-    0xE0,
-    0x00,
-    0x60,
-    0x0A,
-    0x00,
-    0x3D,
-    0x00,
-    0xD3,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC2,
-    0xCE,
-    0x02,
-    0xD0,
-    0x04,
-    0xC5,
-    0x20,
-    0x0D,
-    0x00,
-    0x2D,
-    0xB5,
-    0x00,
-    0xB0,
-    0x55,
-    0x0B,
-    0x00,
-    0x5B,
-    0xB5,
-    0x00,
-    0xB0,
-    0x25,
-    0x0D,
-    0x00,
-    0x2D,
-    0xC0,
-    0x04,
-    0xD5,
-    0x00,
-    0xC2,
-    0xCE,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x5E,
-    0x00,
-    0x30,
-    0xCD,
-    0x05,
-    0x00,
-    0x39,
-    0x5A,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD7,
-    0xCE,
-    0x02,
-    0x80,
-    0x00,
-    0xC6,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0xB4,
-    0x00,
-    0x00,
-    0xD1,
-    0x02,
-    0x00,
-    0xB0,
-    0x04,
-    0x00,
-    0xB0,
-    0x06,
-    0x00,
-    0xB0,
-    0x06,
-    0x00,
-    0x50,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE9,
-    0xCE,
-    0x03,
-    0x61,
-    0x00,
-    0xD5,
-    0x00,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0x10,
-    0x99,
-    0x00,
-    0xD1,
-    0xCE,
-    0x02,
-    0x00,
-    0x00,
-    0xE4,
-    0x01,
-    0x00,
-    0x00,
-    0x3D,
-    0x12,
-    0x00,
-    0xE4,
-    0x41,
-    0xEC,
-    0xCE,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0x90,
-    0x7C,
-    0x00,
-    0x40,
-    0x7A,
-    0x07,
-    0x00,
-    0x0D,
-    0x77,
-    0x00,
-    0x4A,
-    0x70,
-    0x07,
-    0xA5,
-    0x00,
-    0x77,
-    0xB0,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0x09,
-    0xC0,
-    0x02,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xE0,
-    0xED,
-    0x4C,
-    0x00,
-    0x00,
-    0x40,
-    0x0E,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0x00,
-    0x00,
-    0x3D,
-    0x21,
-    0x00,
-    0xD5,
-    0x10,
-    0xEC,
-    0xBE,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xDD,
-    0x0A,
-    0x60,
-    0x1B,
-    0x00,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0xD2,
-    0xD8,
-    0x6D,
-    0x30,
-    0x3F,
-    0x10,
-    0x2E,
-    0xC3,
-    0x00,
-    0xA0,
-    0x25,
-    0x0E,
-    0x00,
-    0x5A,
-    0xC0,
-    0x06,
-    0xE2,
-    0x01,
-    0xB1,
-    0xDE,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x60,
-    0x09,
-    0x00,
-    0x00,
-    0x2D,
-    0x00,
-    0x00,
-    0xB4,
-    0x00,
-    0x00,
-    0xB0,
-    0x04,
-    0x00,
-    0x20,
-    0x0D,
-    0x00,
-    0x00,
-    0x69,
-    0x00,
-    0x00,
-    0xE1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0xDD,
-    0x04,
-    0xE0,
-    0x02,
-    0xE2,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0x90,
-    0x19,
-    0x89,
-    0x00,
-    0xD1,
-    0xCF,
-    0x00,
-    0xC0,
-    0x05,
-    0xD7,
-    0x50,
-    0x0A,
-    0x00,
-    0x5B,
-    0xD3,
-    0x00,
-    0xE1,
-    0x03,
-    0xD7,
-    0xDD,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0xBE,
-    0x02,
-    0xE0,
-    0x03,
-    0xD5,
-    0x40,
-    0x0B,
-    0x00,
-    0x2D,
-    0xB5,
-    0x00,
-    0xB0,
-    0x15,
-    0x1E,
-    0x30,
-    0x5E,
-    0x60,
-    0xDD,
-    0xC9,
-    0x03,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-    0x7A,
-    0x00,
-    0xDA,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3F,
-    0xA0,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x02,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x3E,
-    0xA0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x50,
-    0x0B,
-    0x49,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x81,
-    0x04,
-    0x10,
-    0xB8,
-    0x04,
-    0x80,
-    0x3B,
-    0x00,
-    0x20,
-    0x8C,
-    0x01,
-    0x00,
-    0x00,
-    0xB4,
-    0x4A,
-    0x00,
-    0x00,
-    0x20,
-    0x49,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0xDD,
-    0xDD,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0xDD,
-    0xDD,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x84,
-    0x01,
-    0x00,
-    0x00,
-    0xC4,
-    0x18,
-    0x00,
-    0x00,
-    0x30,
-    0x8B,
-    0x00,
-    0x00,
-    0x81,
-    0x2C,
-    0x40,
-    0xBA,
-    0x04,
-    0x40,
-    0x29,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0xFF,
-    0x1A,
-    0x13,
-    0x00,
-    0x89,
-    0x00,
-    0x00,
-    0x87,
-    0x00,
-    0x60,
-    0x0B,
-    0x00,
-    0x79,
-    0x00,
-    0x00,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0A,
-    0x00,
-    0x30,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xCB,
-    0xDD,
-    0x19,
-    0x00,
-    0x00,
-    0x9A,
-    0x01,
-    0x00,
-    0xC4,
-    0x02,
-    0x60,
-    0x08,
-    0xC4,
-    0xCC,
-    0x32,
-    0x0B,
-    0xD0,
-    0x10,
-    0x0D,
-    0xB0,
-    0x03,
-    0x0C,
-    0xB2,
-    0x60,
-    0x08,
-    0xB0,
-    0x03,
-    0x39,
-    0xA3,
-    0x70,
-    0x07,
-    0xC0,
-    0x01,
-    0x2A,
-    0xC1,
-    0x40,
-    0x0A,
-    0xE2,
-    0x12,
-    0x0C,
-    0xC0,
-    0x02,
-    0xC9,
-    0x3B,
-    0xCC,
-    0x03,
-    0x30,
-    0x4D,
-    0x00,
-    0x00,
-    0x02,
-    0x00,
-    0x00,
-    0x92,
-    0xDD,
-    0xCD,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x0A,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x86,
-    0x68,
-    0x00,
-    0x00,
-    0x2C,
-    0xC1,
-    0x00,
-    0x30,
-    0x0B,
-    0xB0,
-    0x03,
-    0x90,
-    0xFF,
-    0xFF,
-    0x09,
-    0xE0,
-    0x00,
-    0x00,
-    0x0E,
-    0x96,
-    0x00,
-    0x00,
-    0x6A,
-    0x3C,
-    0x00,
-    0x00,
-    0xC4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xFF,
-    0xBF,
-    0x03,
-    0xB0,
-    0x03,
-    0x70,
-    0x0D,
-    0xB0,
-    0x03,
-    0x10,
-    0x0F,
-    0xB0,
-    0x03,
-    0x70,
-    0x0A,
-    0xB0,
-    0xDE,
-    0xDE,
-    0x02,
-    0xB0,
-    0x03,
-    0x30,
-    0x1E,
-    0xB0,
-    0x03,
-    0x00,
-    0x3D,
-    0xB0,
-    0x03,
-    0x40,
-    0x1F,
-    0xB0,
-    0xDE,
-    0xDE,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB3,
-    0xFF,
-    0x4D,
-    0x40,
-    0x5E,
-    0x00,
-    0x12,
-    0xD0,
-    0x05,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x05,
-    0x00,
-    0x00,
-    0x50,
-    0x4E,
-    0x00,
-    0x01,
-    0x00,
-    0xC5,
-    0xFF,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0x4B,
-    0x00,
-    0xB0,
-    0x03,
-    0x40,
-    0x5E,
-    0x00,
-    0x3B,
-    0x00,
-    0x40,
-    0x0E,
-    0xB0,
-    0x03,
-    0x00,
-    0xE0,
-    0x02,
-    0x3B,
-    0x00,
-    0x00,
-    0x3D,
-    0xB0,
-    0x03,
-    0x00,
-    0xF0,
-    0x02,
-    0x3B,
-    0x00,
-    0x40,
-    0x0D,
-    0xB0,
-    0x03,
-    0x50,
-    0x5E,
-    0x00,
-    0xFB,
-    0xEF,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0x3F,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0x0F,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0xBF,
-    0x90,
-    0x05,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0x90,
-    0x05,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0x7F,
-    0x90,
-    0x05,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0x90,
-    0x05,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xEB,
-    0xDF,
-    0x08,
-    0x40,
-    0x5E,
-    0x00,
-    0x41,
-    0x00,
-    0x5D,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0xFD,
-    0x1F,
-    0xF2,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x4E,
-    0x00,
-    0x00,
-    0x1F,
-    0x50,
-    0x4E,
-    0x00,
-    0xF0,
-    0x01,
-    0x40,
-    0xFC,
-    0xEF,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x05,
-    0x00,
-    0x50,
-    0x09,
-    0x90,
-    0x05,
-    0x00,
-    0x50,
-    0x09,
-    0x90,
-    0x05,
-    0x00,
-    0x50,
-    0x09,
-    0x90,
-    0x05,
-    0x00,
-    0x50,
-    0x09,
-    0x90,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x09,
-    0x90,
-    0x05,
-    0x00,
-    0x50,
-    0x09,
-    0x90,
-    0x05,
-    0x00,
-    0x50,
-    0x09,
-    0x90,
-    0x05,
-    0x00,
-    0x50,
-    0x09,
-    0x90,
-    0x05,
-    0x00,
-    0x50,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x1F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x1F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x1F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x1F,
-    0x00,
-    0xF2,
-    0x10,
-    0xEF,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x5D,
-    0xB0,
-    0x05,
-    0xB0,
-    0x06,
-    0xB0,
-    0x05,
-    0x6B,
-    0x00,
-    0xB0,
-    0xA5,
-    0x08,
-    0x00,
-    0xB0,
-    0xDE,
-    0x08,
-    0x00,
-    0xB0,
-    0x17,
-    0x5E,
-    0x00,
-    0xB0,
-    0x05,
-    0xE3,
-    0x01,
-    0xB0,
-    0x05,
-    0x60,
-    0x0C,
-    0xB0,
-    0x05,
-    0x00,
-    0x9A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0x90,
-    0x05,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0x90,
-    0x05,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0x90,
-    0x05,
-    0x00,
-    0x00,
-    0x59,
-    0x00,
-    0x00,
-    0x90,
-    0x05,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0xBF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0x0B,
-    0xB0,
-    0x8C,
-    0x00,
-    0x00,
-    0xC8,
-    0x0B,
-    0xB0,
-    0xE6,
-    0x00,
-    0x00,
-    0x6D,
-    0x0B,
-    0xB0,
-    0xB3,
-    0x05,
-    0x50,
-    0x5A,
-    0x0B,
-    0xB0,
-    0x53,
-    0x0C,
-    0xC0,
-    0x53,
-    0x0B,
-    0xB0,
-    0x03,
-    0x2E,
-    0xC2,
-    0x50,
-    0x0B,
-    0xB0,
-    0x03,
-    0x98,
-    0x69,
-    0x50,
-    0x0B,
-    0xB0,
-    0x03,
-    0xE1,
-    0x0E,
-    0x50,
-    0x0B,
-    0xB0,
-    0x03,
-    0xB0,
-    0x09,
-    0x50,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0C,
-    0x00,
-    0x50,
-    0x0B,
-    0xB0,
-    0x8E,
-    0x00,
-    0x50,
-    0x0B,
-    0xB0,
-    0xE5,
-    0x03,
-    0x50,
-    0x0B,
-    0xB0,
-    0x53,
-    0x0D,
-    0x50,
-    0x0B,
-    0xB0,
-    0x03,
-    0x9A,
-    0x50,
-    0x0B,
-    0xB0,
-    0x03,
-    0xD0,
-    0x44,
-    0x0B,
-    0xB0,
-    0x03,
-    0x30,
-    0x5E,
-    0x0B,
-    0xB0,
-    0x03,
-    0x00,
-    0xD8,
-    0x0B,
-    0xB0,
-    0x03,
-    0x00,
-    0xD0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0xFF,
-    0x4C,
-    0x00,
-    0x50,
-    0x4E,
-    0x00,
-    0xE3,
-    0x05,
-    0xD0,
-    0x04,
-    0x00,
-    0x40,
-    0x0D,
-    0xF2,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0xD3,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0xD0,
-    0x04,
-    0x00,
-    0x40,
-    0x0D,
-    0x50,
-    0x4E,
-    0x00,
-    0xE3,
-    0x04,
-    0x00,
-    0xC4,
-    0xFF,
-    0x4B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xFF,
-    0xBF,
-    0x03,
-    0xB0,
-    0x05,
-    0x60,
-    0x0E,
-    0xB0,
-    0x05,
-    0x00,
-    0x3D,
-    0xB0,
-    0x05,
-    0x00,
-    0x3D,
-    0xB0,
-    0x05,
-    0x71,
-    0x0C,
-    0xB0,
-    0xDE,
-    0x9D,
-    0x01,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0xFF,
-    0x4C,
-    0x00,
-    0x50,
-    0x4E,
-    0x00,
-    0xE3,
-    0x05,
-    0xD0,
-    0x04,
-    0x00,
-    0x40,
-    0x0D,
-    0xF2,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0xD3,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0xF1,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0xD0,
-    0x04,
-    0x00,
-    0x40,
-    0x0D,
-    0x50,
-    0x4E,
-    0x00,
-    0xE3,
-    0x05,
-    0x00,
-    0xC4,
-    0xFF,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE4,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xFF,
-    0xCF,
-    0x03,
-    0xB0,
-    0x05,
-    0x50,
-    0x0E,
-    0xB0,
-    0x05,
-    0x00,
-    0x1F,
-    0xB0,
-    0x05,
-    0x70,
-    0x0C,
-    0xB0,
-    0xDE,
-    0xAF,
-    0x00,
-    0xB0,
-    0x05,
-    0xB6,
-    0x00,
-    0xB0,
-    0x05,
-    0xD0,
-    0x05,
-    0xB0,
-    0x05,
-    0x40,
-    0x0D,
-    0xB0,
-    0x05,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0xEF,
-    0x0B,
-    0xF1,
-    0x03,
-    0x40,
-    0x20,
-    0x0E,
-    0x00,
-    0x00,
-    0xC0,
-    0x19,
-    0x00,
-    0x00,
-    0x80,
-    0xBE,
-    0x02,
-    0x00,
-    0x00,
-    0xE6,
-    0x01,
-    0x00,
-    0x00,
-    0x5B,
-    0x22,
-    0x00,
-    0xE3,
-    0x32,
-    0xFC,
-    0xCF,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xFF,
-    0xFF,
-    0xDF,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x30,
-    0x0D,
-    0xD0,
-    0x03,
-    0x00,
-    0xD3,
-    0x00,
-    0x3D,
-    0x00,
-    0x30,
-    0x0D,
-    0xD0,
-    0x03,
-    0x00,
-    0xD3,
-    0x00,
-    0x3D,
-    0x00,
-    0x30,
-    0x0D,
-    0xD0,
-    0x03,
-    0x00,
-    0xD3,
-    0x00,
-    0x4C,
-    0x00,
-    0x40,
-    0x0C,
-    0x60,
-    0x1C,
-    0x10,
-    0x6C,
-    0x00,
-    0x70,
-    0xFE,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5C,
-    0x00,
-    0x00,
-    0xC5,
-    0xB6,
-    0x00,
-    0x00,
-    0x6B,
-    0xF0,
-    0x01,
-    0x10,
-    0x0F,
-    0xA0,
-    0x07,
-    0x80,
-    0x0A,
-    0x40,
-    0x0D,
-    0xD0,
-    0x04,
-    0x00,
-    0x3D,
-    0xD4,
-    0x00,
-    0x00,
-    0x97,
-    0x79,
-    0x00,
-    0x00,
-    0xE1,
-    0x1E,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x00,
-    0xB0,
-    0x0A,
-    0x00,
-    0xA6,
-    0xB6,
-    0x00,
-    0xE0,
-    0x0E,
-    0x00,
-    0x6B,
-    0xE1,
-    0x00,
-    0xA5,
-    0x4B,
-    0x00,
-    0x1E,
-    0xD0,
-    0x03,
-    0x5A,
-    0x96,
-    0x30,
-    0x0D,
-    0x90,
-    0x07,
-    0x0E,
-    0xE1,
-    0x70,
-    0x09,
-    0x40,
-    0x4B,
-    0x0B,
-    0xC0,
-    0xB3,
-    0x04,
-    0x00,
-    0x9E,
-    0x07,
-    0x70,
-    0xE8,
-    0x00,
-    0x00,
-    0xEB,
-    0x02,
-    0x20,
-    0xBE,
-    0x00,
-    0x00,
-    0xD7,
-    0x00,
-    0x00,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD5,
-    0x00,
-    0x00,
-    0x5C,
-    0xA0,
-    0x08,
-    0x80,
-    0x09,
-    0x00,
-    0x3D,
-    0xD3,
-    0x00,
-    0x00,
-    0xD3,
-    0x2D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0C,
-    0x00,
-    0x00,
-    0xA7,
-    0x7A,
-    0x00,
-    0x30,
-    0x0D,
-    0xE1,
-    0x03,
-    0xD0,
-    0x04,
-    0x50,
-    0x0D,
-    0x99,
-    0x00,
-    0x00,
-    0x9A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0xB5,
-    0xE2,
-    0x00,
-    0xD0,
-    0x02,
-    0x6A,
-    0x60,
-    0x0A,
-    0x10,
-    0x1E,
-    0x1E,
-    0x00,
-    0x90,
-    0x9D,
-    0x00,
-    0x00,
-    0xF1,
-    0x02,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x00,
-    0x00,
-    0xD4,
-    0x00,
-    0x00,
-    0xD0,
-    0x04,
-    0x00,
-    0x80,
-    0x0A,
-    0x00,
-    0x20,
-    0x1E,
-    0x00,
-    0x00,
-    0x5C,
-    0x00,
-    0x00,
-    0xB6,
-    0x00,
-    0x00,
-    0xE1,
-    0x02,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xAD,
-    0xF0,
-    0x01,
-    0xF0,
-    0x01,
-    0xF0,
-    0x01,
-    0xF0,
-    0x01,
-    0xF0,
-    0x01,
-    0xF0,
-    0x01,
-    0xF0,
-    0x01,
-    0xF0,
-    0x01,
-    0xF0,
-    0x01,
-    0xF0,
-    0xAD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x06,
-    0x00,
-    0xD3,
-    0x00,
-    0x00,
-    0x3D,
-    0x00,
-    0x60,
-    0x0A,
-    0x00,
-    0xE0,
-    0x00,
-    0x00,
-    0x6A,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0xC0,
-    0x04,
-    0x00,
-    0xA6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDA,
-    0x0F,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0x00,
-    0x0F,
-    0xDA,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0E,
-    0x00,
-    0x00,
-    0x6B,
-    0x08,
-    0x00,
-    0x84,
-    0xB0,
-    0x02,
-    0xC0,
-    0x01,
-    0xB2,
-    0x60,
-    0x07,
-    0x00,
-    0x58,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0xDD,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0x05,
-    0x00,
-    0x00,
-    0x20,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD5,
-    0xED,
-    0x04,
-    0x20,
-    0x00,
-    0xE4,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x60,
-    0xCC,
-    0xFC,
-    0x40,
-    0x0D,
-    0x10,
-    0x0F,
-    0xC5,
-    0x00,
-    0xF7,
-    0x00,
-    0xEA,
-    0x7D,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0xD6,
-    0xCE,
-    0x02,
-    0xD0,
-    0x0A,
-    0x50,
-    0x0D,
-    0xD0,
-    0x04,
-    0x00,
-    0x2E,
-    0xD0,
-    0x01,
-    0x00,
-    0x3D,
-    0xD0,
-    0x04,
-    0x00,
-    0x2E,
-    0xD0,
-    0x0A,
-    0x50,
-    0x0D,
-    0xD0,
-    0xC4,
-    0xCE,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xFB,
-    0x5E,
-    0xD0,
-    0x06,
-    0x00,
-    0xE2,
-    0x00,
-    0x00,
-    0xB3,
-    0x00,
-    0x00,
-    0xE2,
-    0x00,
-    0x00,
-    0xD0,
-    0x06,
-    0x10,
-    0x20,
-    0xEB,
-    0x5E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x20,
-    0xEC,
-    0x6C,
-    0x0D,
-    0xD0,
-    0x06,
-    0xA0,
-    0x0D,
-    0xE2,
-    0x00,
-    0x40,
-    0x0D,
-    0xD3,
-    0x00,
-    0x10,
-    0x0D,
-    0xE2,
-    0x00,
-    0x30,
-    0x0D,
-    0xD0,
-    0x05,
-    0xA0,
-    0x0D,
-    0x20,
-    0xEC,
-    0x5D,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB2,
-    0xDD,
-    0x03,
-    0xD0,
-    0x05,
-    0xE2,
-    0x20,
-    0x0E,
-    0x00,
-    0x4C,
-    0xF3,
-    0xDD,
-    0xDD,
-    0x24,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x06,
-    0x20,
-    0x00,
-    0xB1,
-    0xEE,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xDC,
-    0x0A,
-    0x88,
-    0x00,
-    0xB0,
-    0x05,
-    0x80,
-    0xEE,
-    0x1D,
-    0xB0,
-    0x05,
-    0x00,
-    0x5B,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x5B,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC7,
-    0xFB,
-    0x7D,
-    0xE1,
-    0x00,
-    0xC4,
-    0x20,
-    0x0E,
-    0x40,
-    0x0C,
-    0x70,
-    0xBD,
-    0x3C,
-    0x00,
-    0x49,
-    0x00,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0x1C,
-    0x78,
-    0x00,
-    0x80,
-    0xA8,
-    0x06,
-    0x00,
-    0x7A,
-    0xB2,
-    0xDD,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0xC6,
-    0xCD,
-    0x03,
-    0xD0,
-    0x0A,
-    0x50,
-    0x0C,
-    0xD0,
-    0x04,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0x1F,
-    0xF0,
-    0x01,
-    0x1F,
-    0xF0,
-    0x01,
-    0x1F,
-    0xF0,
-    0x01,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x1F,
-    0x00,
-    0x1F,
-    0x00,
-    0x1F,
-    0x00,
-    0x1F,
-    0x00,
-    0x1F,
-    0x00,
-    0x1F,
-    0x00,
-    0x1F,
-    0x10,
-    0x0F,
-    0xEB,
-    0x07,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x1D,
-    0x20,
-    0x3D,
-    0xD0,
-    0x11,
-    0x3D,
-    0x00,
-    0x2D,
-    0x3C,
-    0x00,
-    0xD0,
-    0xFC,
-    0x02,
-    0x00,
-    0x6D,
-    0xD8,
-    0x00,
-    0xD0,
-    0x01,
-    0xAA,
-    0x00,
-    0x1D,
-    0x00,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x1F,
-    0xF0,
-    0x01,
-    0x1F,
-    0xF0,
-    0x01,
-    0x1F,
-    0xF0,
-    0x01,
-    0x1F,
-    0xF0,
-    0x01,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xD6,
-    0xBE,
-    0xC3,
-    0xDD,
-    0x03,
-    0xD0,
-    0x09,
-    0xB0,
-    0x1E,
-    0x50,
-    0x0C,
-    0xD0,
-    0x03,
-    0x70,
-    0x09,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x70,
-    0x09,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x70,
-    0x09,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x70,
-    0x09,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x70,
-    0x09,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xC5,
-    0xCE,
-    0x03,
-    0xD0,
-    0x0A,
-    0x60,
-    0x0C,
-    0xD0,
-    0x04,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x10,
-    0x0F,
-    0xD0,
-    0x01,
-    0x10,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xEA,
-    0xAE,
-    0x01,
-    0xC0,
-    0x07,
-    0x70,
-    0x0B,
-    0xE2,
-    0x00,
-    0x00,
-    0x2E,
-    0xD3,
-    0x00,
-    0x00,
-    0x3D,
-    0xE1,
-    0x00,
-    0x00,
-    0x2E,
-    0xB0,
-    0x07,
-    0x70,
-    0x0C,
-    0x10,
-    0xDA,
-    0xAD,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xC5,
-    0xCE,
-    0x02,
-    0xD0,
-    0x0A,
-    0x70,
-    0x0D,
-    0xD0,
-    0x03,
-    0x00,
-    0x2E,
-    0xD0,
-    0x01,
-    0x00,
-    0x3D,
-    0xD0,
-    0x04,
-    0x00,
-    0x2E,
-    0xD0,
-    0x0A,
-    0x70,
-    0x0D,
-    0xD0,
-    0xC6,
-    0xCE,
-    0x02,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xEC,
-    0x5C,
-    0x0D,
-    0xD0,
-    0x06,
-    0xA0,
-    0x0D,
-    0xE2,
-    0x00,
-    0x40,
-    0x0D,
-    0xD3,
-    0x00,
-    0x10,
-    0x0D,
-    0xE2,
-    0x00,
-    0x30,
-    0x0D,
-    0xD0,
-    0x05,
-    0xA0,
-    0x0D,
-    0x20,
-    0xEC,
-    0x6C,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3E,
-    0xBD,
-    0xF0,
-    0x0A,
-    0x00,
-    0x2F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x1F,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xED,
-    0x1C,
-    0xB4,
-    0x00,
-    0x01,
-    0xE2,
-    0x04,
-    0x00,
-    0x30,
-    0xDA,
-    0x06,
-    0x00,
-    0x10,
-    0x4D,
-    0x00,
-    0x00,
-    0x5B,
-    0xC4,
-    0xDD,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x56,
-    0x00,
-    0xB0,
-    0x05,
-    0x90,
-    0xEF,
-    0x8D,
-    0xB0,
-    0x05,
-    0x00,
-    0x5B,
-    0x00,
-    0xB0,
-    0x05,
-    0x00,
-    0x5B,
-    0x00,
-    0x90,
-    0x08,
-    0x00,
-    0xD2,
-    0x9D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x10,
-    0x0D,
-    0xF0,
-    0x01,
-    0x10,
-    0x0D,
-    0xF0,
-    0x01,
-    0x10,
-    0x0D,
-    0xF0,
-    0x01,
-    0x10,
-    0x0D,
-    0xF0,
-    0x01,
-    0x30,
-    0x0D,
-    0xC0,
-    0x05,
-    0xA0,
-    0x0D,
-    0x30,
-    0xDC,
-    0x5C,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x06,
-    0x00,
-    0xC6,
-    0xC6,
-    0x00,
-    0xC0,
-    0x06,
-    0x2E,
-    0x20,
-    0x0E,
-    0x80,
-    0x08,
-    0x88,
-    0x00,
-    0xE2,
-    0xE0,
-    0x02,
-    0x00,
-    0x9C,
-    0x0C,
-    0x00,
-    0x50,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5B,
-    0x00,
-    0xBA,
-    0x00,
-    0xB5,
-    0x97,
-    0x00,
-    0xDD,
-    0x00,
-    0x69,
-    0xD2,
-    0x50,
-    0xA9,
-    0x05,
-    0x2D,
-    0xE0,
-    0x91,
-    0x54,
-    0x19,
-    0x0E,
-    0xA0,
-    0xE5,
-    0x00,
-    0x5E,
-    0x09,
-    0x50,
-    0xAC,
-    0x00,
-    0xCB,
-    0x05,
-    0x10,
-    0x5F,
-    0x00,
-    0xF6,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0x3D,
-    0x80,
-    0x0A,
-    0x7A,
-    0x00,
-    0xC0,
-    0xBA,
-    0x00,
-    0x00,
-    0xF4,
-    0x04,
-    0x00,
-    0xD0,
-    0xD7,
-    0x00,
-    0x90,
-    0x08,
-    0x98,
-    0x40,
-    0x0C,
-    0x00,
-    0x5C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x06,
-    0x00,
-    0xC6,
-    0xC5,
-    0x00,
-    0xC0,
-    0x05,
-    0x3E,
-    0x20,
-    0x0E,
-    0x80,
-    0x0A,
-    0x88,
-    0x00,
-    0xF2,
-    0xE1,
-    0x02,
-    0x00,
-    0xBC,
-    0x0B,
-    0x00,
-    0x50,
-    0x5F,
-    0x00,
-    0x00,
-    0xE6,
-    0x00,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0xEB,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD3,
-    0xDD,
-    0x5F,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0x88,
-    0x00,
-    0x30,
-    0x0D,
-    0x00,
-    0xD0,
-    0x03,
-    0x00,
-    0xF7,
-    0xDD,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x6D,
-    0x00,
-    0x3E,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xE3,
-    0x00,
-    0xE9,
-    0x04,
-    0x00,
-    0xE3,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x3E,
-    0x00,
-    0x40,
-    0x6C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x4D,
-    0x00,
-    0x30,
-    0x0E,
-    0x00,
-    0xF1,
-    0x00,
-    0x10,
-    0x0F,
-    0x00,
-    0xE0,
-    0x02,
-    0x00,
-    0xE4,
-    0x09,
-    0xE0,
-    0x03,
-    0x10,
-    0x0F,
-    0x00,
-    0xF1,
-    0x00,
-    0x30,
-    0x0E,
-    0x60,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xDC,
-    0xDE,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x99,
-    0x99,
-    0x0D,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0xD0,
-    0x99,
-    0x99,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_REGULAR_10_13PX = [
-    FontCharacter(3, 21, 0),
-    FontCharacter(3, 21, 21),
-    FontCharacter(5, 35, 42),
-    FontCharacter(8, 56, 77),
-    FontCharacter(7, 49, 133),
-    FontCharacter(11, 77, 182),
-    FontCharacter(9, 63, 259),
-    FontCharacter(3, 21, 322),
-    FontCharacter(4, 28, 343),
-    FontCharacter(4, 28, 371),
-    FontCharacter(7, 49, 399),
-    FontCharacter(7, 49, 448),
-    FontCharacter(3, 21, 497),
-    FontCharacter(4, 28, 518),
-    FontCharacter(3, 21, 546),
-    FontCharacter(5, 35, 567),
-    FontCharacter(7, 49, 602),
-    FontCharacter(7, 49, 651),
-    FontCharacter(7, 49, 700),
-    FontCharacter(7, 49, 749),
-    FontCharacter(7, 49, 798),
-    FontCharacter(7, 49, 847),
-    FontCharacter(7, 49, 896),
-    FontCharacter(7, 49, 945),
-    FontCharacter(7, 49, 994),
-    FontCharacter(7, 49, 1043),
-    FontCharacter(3, 21, 1092),
-    FontCharacter(3, 21, 1113),
-    FontCharacter(7, 49, 1134),
-    FontCharacter(7, 49, 1183),
-    FontCharacter(7, 49, 1232),
-    FontCharacter(6, 42, 1281),
-    FontCharacter(12, 84, 1323),
-    FontCharacter(8, 56, 1407),
-    FontCharacter(8, 56, 1463),
-    FontCharacter(8, 56, 1519),
-    FontCharacter(9, 63, 1575),
-    FontCharacter(7, 49, 1638),
-    FontCharacter(7, 49, 1687),
-    FontCharacter(9, 63, 1736),
-    FontCharacter(10, 70, 1799),
-    FontCharacter(4, 28, 1869),
-    FontCharacter(5, 35, 1897),
-    FontCharacter(8, 56, 1932),
-    FontCharacter(7, 49, 1988),
-    FontCharacter(12, 84, 2037),
-    FontCharacter(10, 70, 2121),
-    FontCharacter(10, 70, 2191),
-    FontCharacter(8, 56, 2261),
-    FontCharacter(10, 70, 2317),
-    FontCharacter(8, 56, 2387),
-    FontCharacter(7, 49, 2443),
-    FontCharacter(7, 49, 2492),
-    FontCharacter(9, 63, 2541),
-    FontCharacter(8, 56, 2604),
-    FontCharacter(12, 84, 2660),
-    FontCharacter(8, 56, 2744),
-    FontCharacter(7, 49, 2800),
-    FontCharacter(7, 49, 2849),
-    FontCharacter(4, 28, 2898),
-    FontCharacter(5, 35, 2926),
-    FontCharacter(4, 28, 2961),
-    FontCharacter(7, 49, 2989),
-    FontCharacter(6, 42, 3038),
-    FontCharacter(8, 56, 3080),
-    FontCharacter(7, 49, 3136),
-    FontCharacter(8, 56, 3185),
-    FontCharacter(6, 42, 3241),
-    FontCharacter(8, 56, 3283),
-    FontCharacter(7, 49, 3339),
-    FontCharacter(5, 35, 3388),
-    FontCharacter(7, 49, 3423),
-    FontCharacter(8, 56, 3472),
-    FontCharacter(3, 21, 3528),
-    FontCharacter(4, 28, 3549),
-    FontCharacter(7, 49, 3577),
-    FontCharacter(3, 21, 3626),
-    FontCharacter(12, 84, 3647),
-    FontCharacter(8, 56, 3731),
-    FontCharacter(8, 56, 3787),
-    FontCharacter(8, 56, 3843),
-    FontCharacter(8, 56, 3899),
-    FontCharacter(5, 35, 3955),
-    FontCharacter(6, 42, 3990),
-    FontCharacter(5, 35, 4032),
-    FontCharacter(8, 56, 4067),
-    FontCharacter(7, 49, 4123),
-    FontCharacter(10, 70, 4172),
-    FontCharacter(7, 49, 4242),
-    FontCharacter(7, 49, 4291),
-    FontCharacter(6, 42, 4340),
-    FontCharacter(5, 35, 4382),
-    FontCharacter(7, 49, 4417),
-    FontCharacter(5, 35, 4466),
-    FontCharacter(7, 49, 4501),
-    FontCharacter(8, 56, 4550),
-]
+    magic, version, count = FONT_PACK_HEADER.unpack_from(data)
+    if magic != FONT_PACK_MAGIC or version != FONT_PACK_VERSION:
+        raise ValueError(f"{path} is not a BAGL font pack, or its version is not supported")
 
-bitmapOPEN_SANS_SEMIBOLD_10_13PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x0B,
-    0xD0,
-    0x0B,
-    0xD0,
-    0x09,
-    0xB0,
-    0x09,
-    0xB0,
-    0x07,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x09,
-    0xD0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x44,
-    0x0F,
-    0xF0,
-    0x33,
-    0x0F,
-    0xD0,
-    0x11,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x80,
-    0x08,
-    0x00,
-    0xD4,
-    0xA0,
-    0x06,
-    0x00,
-    0xA6,
-    0xD0,
-    0x04,
-    0xF3,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x10,
-    0x5D,
-    0xD5,
-    0x11,
-    0xFB,
-    0xFF,
-    0xFF,
-    0x3F,
-    0x51,
-    0x1D,
-    0x7B,
-    0x01,
-    0x60,
-    0x0A,
-    0x4D,
-    0x00,
-    0x80,
-    0x08,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x00,
-    0x00,
-    0xD5,
-    0xEF,
-    0x0B,
-    0xF2,
-    0xE9,
-    0x74,
-    0x30,
-    0x5F,
-    0x0D,
-    0x00,
-    0xB0,
-    0xFF,
-    0x05,
-    0x00,
-    0x50,
-    0xFE,
-    0x0B,
-    0x00,
-    0xD0,
-    0xF4,
-    0x44,
-    0x37,
-    0x8E,
-    0x3F,
-    0xC3,
-    0xFF,
-    0x5D,
-    0x00,
-    0x00,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFA,
-    0x0A,
-    0x00,
-    0x5D,
-    0x00,
-    0xE4,
-    0xD1,
-    0x05,
-    0xC6,
-    0x00,
-    0x70,
-    0x0B,
-    0x7B,
-    0xE0,
-    0x03,
-    0x00,
-    0xB6,
-    0xB0,
-    0x87,
-    0xBA,
-    0x9F,
-    0x30,
-    0x1E,
-    0x7D,
-    0x7E,
-    0x1D,
-    0x3E,
-    0x90,
-    0xAF,
-    0x8B,
-    0xB7,
-    0xB0,
-    0x06,
-    0x00,
-    0xE3,
-    0x70,
-    0x0B,
-    0x6B,
-    0x00,
-    0xC0,
-    0x06,
-    0xD5,
-    0xE1,
-    0x03,
-    0x50,
-    0x0D,
-    0x00,
-    0xFA,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE9,
-    0xBF,
-    0x01,
-    0x00,
-    0x60,
-    0x5F,
-    0xE4,
-    0x09,
-    0x00,
-    0x50,
-    0x1F,
-    0xE1,
-    0x07,
-    0x00,
-    0x00,
-    0xDC,
-    0xAE,
-    0x00,
-    0x00,
-    0x40,
-    0xFE,
-    0x3F,
-    0x10,
-    0x39,
-    0xF1,
-    0x19,
-    0xED,
-    0x73,
-    0x1F,
-    0xF5,
-    0x03,
-    0xD1,
-    0xEE,
-    0x08,
-    0xF2,
-    0x4B,
-    0xA4,
-    0xFF,
-    0x05,
-    0x40,
-    0xFC,
-    0xCF,
-    0x76,
-    0x6F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x3F,
-    0xF0,
-    0x01,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x4E,
-    0x90,
-    0x0B,
-    0xF0,
-    0x05,
-    0xF4,
-    0x01,
-    0xE6,
-    0x00,
-    0xD7,
-    0x00,
-    0xE7,
-    0x00,
-    0xF4,
-    0x01,
-    0xF0,
-    0x05,
-    0x90,
-    0x0B,
-    0x10,
-    0x4E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE4,
-    0x01,
-    0xB0,
-    0x09,
-    0x50,
-    0x0F,
-    0x10,
-    0x4F,
-    0x00,
-    0x6E,
-    0x00,
-    0x7D,
-    0x00,
-    0x7E,
-    0x10,
-    0x4F,
-    0x50,
-    0x0F,
-    0xB0,
-    0x09,
-    0xE4,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x01,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0xF6,
-    0xFB,
-    0xFB,
-    0x06,
-    0xA3,
-    0xAF,
-    0x03,
-    0x20,
-    0x6F,
-    0x2E,
-    0x00,
-    0xA5,
-    0xA0,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x50,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x10,
-    0xF1,
-    0x13,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0xB0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x5F,
-    0xF4,
-    0x80,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x9F,
-    0x32,
-    0x23,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x09,
-    0xD0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xAA,
-    0x00,
-    0xF1,
-    0x04,
-    0x60,
-    0x0E,
-    0x00,
-    0x8C,
-    0x00,
-    0xF2,
-    0x02,
-    0x90,
-    0x0C,
-    0x00,
-    0x6E,
-    0x00,
-    0xF5,
-    0x00,
-    0xB0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0xCF,
-    0x03,
-    0xE0,
-    0x4B,
-    0xDB,
-    0x40,
-    0x3F,
-    0x30,
-    0x3F,
-    0xF6,
-    0x00,
-    0xF0,
-    0x76,
-    0x0F,
-    0x00,
-    0x7F,
-    0xF6,
-    0x00,
-    0xF0,
-    0x36,
-    0x3F,
-    0x30,
-    0x4F,
-    0xD0,
-    0x4B,
-    0xEB,
-    0x00,
-    0xC3,
-    0xCF,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xBE,
-    0x00,
-    0x70,
-    0xDF,
-    0x0B,
-    0x00,
-    0x3B,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD6,
-    0xDF,
-    0x04,
-    0xE2,
-    0x47,
-    0xEC,
-    0x00,
-    0x00,
-    0x50,
-    0x1F,
-    0x00,
-    0x00,
-    0xE8,
-    0x00,
-    0x00,
-    0xF3,
-    0x05,
-    0x00,
-    0xE3,
-    0x08,
-    0x00,
-    0xE2,
-    0x08,
-    0x00,
-    0xE2,
-    0x5D,
-    0x55,
-    0x72,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xE9,
-    0xDF,
-    0x04,
-    0xB1,
-    0x45,
-    0xFC,
-    0x00,
-    0x00,
-    0x50,
-    0x1F,
-    0x00,
-    0x10,
-    0xCB,
-    0x00,
-    0xF1,
-    0xDF,
-    0x02,
-    0x00,
-    0x43,
-    0xEA,
-    0x01,
-    0x00,
-    0x20,
-    0x5F,
-    0x65,
-    0x43,
-    0xFA,
-    0x42,
-    0xFC,
-    0xCF,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0x0B,
-    0x00,
-    0xB0,
-    0xBF,
-    0x00,
-    0x60,
-    0xBC,
-    0x0B,
-    0x10,
-    0x3E,
-    0xBB,
-    0x00,
-    0x8A,
-    0xB0,
-    0x0B,
-    0xD5,
-    0x00,
-    0xBB,
-    0xB0,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x32,
-    0x33,
-    0xCC,
-    0x02,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFD,
-    0xFF,
-    0x0B,
-    0xE0,
-    0x5A,
-    0x45,
-    0x00,
-    0x5F,
-    0x00,
-    0x00,
-    0xF1,
-    0xFE,
-    0x4D,
-    0x00,
-    0x35,
-    0xC4,
-    0x1F,
-    0x00,
-    0x00,
-    0xF3,
-    0x05,
-    0x00,
-    0x30,
-    0x4F,
-    0x72,
-    0x44,
-    0xEC,
-    0x10,
-    0xFC,
-    0xBF,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xFD,
-    0x0D,
-    0x80,
-    0x6E,
-    0x33,
-    0x00,
-    0x5F,
-    0x00,
-    0x00,
-    0xF4,
-    0xE7,
-    0x8E,
-    0x50,
-    0xAF,
-    0x72,
-    0x3F,
-    0xF5,
-    0x01,
-    0xF0,
-    0x47,
-    0x2F,
-    0x00,
-    0x7F,
-    0xD0,
-    0x3C,
-    0xF9,
-    0x02,
-    0xC2,
-    0xDF,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x53,
-    0x55,
-    0xF8,
-    0x04,
-    0x00,
-    0x90,
-    0x0D,
-    0x00,
-    0x10,
-    0x6F,
-    0x00,
-    0x00,
-    0xF7,
-    0x00,
-    0x00,
-    0xE0,
-    0x09,
-    0x00,
-    0x50,
-    0x2F,
-    0x00,
-    0x00,
-    0xCC,
-    0x00,
-    0x00,
-    0xF3,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0xDF,
-    0x04,
-    0xF0,
-    0x28,
-    0xF8,
-    0x20,
-    0x1F,
-    0x10,
-    0x1F,
-    0xC0,
-    0x1A,
-    0xCA,
-    0x00,
-    0xE1,
-    0xDF,
-    0x00,
-    0xC0,
-    0x5A,
-    0xCB,
-    0x60,
-    0x0D,
-    0x00,
-    0x6D,
-    0xF5,
-    0x15,
-    0xF5,
-    0x04,
-    0xE8,
-    0xEF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0xCF,
-    0x02,
-    0xF1,
-    0x39,
-    0xDB,
-    0x60,
-    0x0F,
-    0x20,
-    0x4F,
-    0xF7,
-    0x00,
-    0xF0,
-    0x37,
-    0x8F,
-    0xA3,
-    0x7F,
-    0x70,
-    0xEE,
-    0xF6,
-    0x04,
-    0x00,
-    0x40,
-    0x1F,
-    0x30,
-    0x63,
-    0x8E,
-    0x00,
-    0xFD,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0A,
-    0xC0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x09,
-    0xD0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x09,
-    0xC0,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x09,
-    0xF2,
-    0x03,
-    0xC6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x04,
-    0x00,
-    0xD5,
-    0x2C,
-    0x30,
-    0xDC,
-    0x05,
-    0x40,
-    0x9F,
-    0x00,
-    0x00,
-    0x80,
-    0xBF,
-    0x03,
-    0x00,
-    0x10,
-    0xF8,
-    0x2B,
-    0x00,
-    0x00,
-    0x81,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x10,
-    0x11,
-    0x11,
-    0x00,
-    0x11,
-    0x11,
-    0x01,
-    0xF5,
-    0xFF,
-    0xFF,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x74,
-    0x00,
-    0x00,
-    0x20,
-    0xDC,
-    0x05,
-    0x00,
-    0x00,
-    0xD5,
-    0x3C,
-    0x00,
-    0x00,
-    0x90,
-    0x4F,
-    0x00,
-    0xB3,
-    0x8F,
-    0x20,
-    0xFB,
-    0x18,
-    0x00,
-    0x85,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC6,
-    0xFF,
-    0x1A,
-    0x76,
-    0x53,
-    0x8E,
-    0x00,
-    0x00,
-    0x9D,
-    0x00,
-    0xB1,
-    0x1E,
-    0x00,
-    0xBC,
-    0x01,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x3D,
-    0x00,
-    0x40,
-    0x4F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xEB,
-    0xDF,
-    0x19,
-    0x00,
-    0x00,
-    0xCA,
-    0x04,
-    0x10,
-    0xE8,
-    0x02,
-    0x70,
-    0x0C,
-    0xE6,
-    0xDF,
-    0x74,
-    0x0C,
-    0xE0,
-    0x42,
-    0x2E,
-    0xB0,
-    0x05,
-    0x1F,
-    0xE3,
-    0x90,
-    0x09,
-    0xD0,
-    0x05,
-    0x3D,
-    0xD3,
-    0xA0,
-    0x07,
-    0xE0,
-    0x05,
-    0x2E,
-    0xF2,
-    0x70,
-    0x0C,
-    0xF4,
-    0x36,
-    0x0E,
-    0xD0,
-    0x06,
-    0xFA,
-    0x3C,
-    0xEE,
-    0x03,
-    0x30,
-    0x8E,
-    0x02,
-    0x20,
-    0x06,
-    0x00,
-    0x00,
-    0x92,
-    0xFD,
-    0xCF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x08,
-    0x00,
-    0x00,
-    0xE0,
-    0xED,
-    0x00,
-    0x00,
-    0x50,
-    0x2F,
-    0x5F,
-    0x00,
-    0x00,
-    0xAB,
-    0xA0,
-    0x0B,
-    0x00,
-    0xF2,
-    0x04,
-    0xF4,
-    0x02,
-    0x80,
-    0xFF,
-    0xFF,
-    0x8F,
-    0x00,
-    0xAE,
-    0x55,
-    0xA5,
-    0x0E,
-    0xF5,
-    0x02,
-    0x00,
-    0xF2,
-    0xC5,
-    0x0C,
-    0x00,
-    0x00,
-    0xCC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0xAE,
-    0x01,
-    0xB0,
-    0x3E,
-    0x63,
-    0xCE,
-    0x00,
-    0xDB,
-    0x00,
-    0x90,
-    0x0F,
-    0xB0,
-    0x0D,
-    0x20,
-    0xAD,
-    0x00,
-    0xFB,
-    0xFF,
-    0xCF,
-    0x01,
-    0xB0,
-    0x3E,
-    0x43,
-    0xEC,
-    0x00,
-    0xDB,
-    0x00,
-    0x50,
-    0x3F,
-    0xB0,
-    0x3E,
-    0x53,
-    0xED,
-    0x01,
-    0xFB,
-    0xFF,
-    0xBF,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB3,
-    0xFF,
-    0x4C,
-    0x50,
-    0xBF,
-    0x45,
-    0x29,
-    0xD0,
-    0x0C,
-    0x00,
-    0x00,
-    0xF2,
-    0x07,
-    0x00,
-    0x00,
-    0xF3,
-    0x05,
-    0x00,
-    0x00,
-    0xF2,
-    0x06,
-    0x00,
-    0x00,
-    0xE0,
-    0x0C,
-    0x00,
-    0x00,
-    0x60,
-    0xBF,
-    0x45,
-    0x27,
-    0x00,
-    0xC6,
-    0xFF,
-    0x2C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xFF,
-    0xEF,
-    0x29,
-    0x00,
-    0xB0,
-    0x3E,
-    0x63,
-    0xEC,
-    0x03,
-    0xB0,
-    0x0D,
-    0x00,
-    0xD0,
-    0x0D,
-    0xB0,
-    0x0D,
-    0x00,
-    0x70,
-    0x1F,
-    0xB0,
-    0x0D,
-    0x00,
-    0x50,
-    0x1F,
-    0xB0,
-    0x0D,
-    0x00,
-    0x80,
-    0x0F,
-    0xB0,
-    0x0D,
-    0x00,
-    0xE1,
-    0x0C,
-    0xB0,
-    0x3E,
-    0x74,
-    0xED,
-    0x02,
-    0xB0,
-    0xFF,
-    0xDF,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFD,
-    0xFF,
-    0x3F,
-    0xD0,
-    0x3C,
-    0x33,
-    0x00,
-    0xBD,
-    0x00,
-    0x00,
-    0xD0,
-    0x0B,
-    0x00,
-    0x00,
-    0xFD,
-    0xFF,
-    0x0F,
-    0xD0,
-    0x3C,
-    0x33,
-    0x00,
-    0xBD,
-    0x00,
-    0x00,
-    0xD0,
-    0x3C,
-    0x33,
-    0x00,
-    0xFD,
-    0xFF,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0x7F,
-    0xB0,
-    0x3C,
-    0x33,
-    0x01,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0x3F,
-    0xB0,
-    0x3C,
-    0x33,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xEB,
-    0xDF,
-    0x08,
-    0x40,
-    0xCF,
-    0x46,
-    0x66,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x06,
-    0x00,
-    0x00,
-    0x30,
-    0x5F,
-    0x30,
-    0xFF,
-    0x0F,
-    0xF2,
-    0x06,
-    0x30,
-    0xF9,
-    0x00,
-    0xBE,
-    0x00,
-    0x70,
-    0x0F,
-    0x60,
-    0xBF,
-    0x44,
-    0xFA,
-    0x00,
-    0x50,
-    0xFC,
-    0xDF,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0B,
-    0xB0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0B,
-    0xB0,
-    0x3C,
-    0x33,
-    0xC3,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0xBB,
-    0x00,
-    0xBB,
-    0x00,
-    0xBB,
-    0x00,
-    0xBB,
-    0x00,
-    0xBB,
-    0x00,
-    0xBB,
-    0x00,
-    0xBB,
-    0x00,
-    0xBC,
-    0x64,
-    0x8F,
-    0xFE,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0B,
-    0x30,
-    0x7F,
-    0xD0,
-    0x0B,
-    0xE1,
-    0x09,
-    0xD0,
-    0x0B,
-    0xBC,
-    0x00,
-    0xD0,
-    0xAB,
-    0x0D,
-    0x00,
-    0xD0,
-    0xFF,
-    0x0D,
-    0x00,
-    0xD0,
-    0x3D,
-    0x9F,
-    0x00,
-    0xD0,
-    0x0B,
-    0xF6,
-    0x04,
-    0xD0,
-    0x0B,
-    0xB0,
-    0x0D,
-    0xD0,
-    0x0B,
-    0x10,
-    0xAE,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0xB0,
-    0x3C,
-    0x33,
-    0x02,
-    0xFB,
-    0xFF,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x8F,
-    0x00,
-    0x00,
-    0xF8,
-    0x0B,
-    0xB0,
-    0xDE,
-    0x00,
-    0x00,
-    0xEE,
-    0x0B,
-    0xB0,
-    0xFA,
-    0x03,
-    0x40,
-    0xAE,
-    0x0B,
-    0xB0,
-    0xB9,
-    0x09,
-    0xA0,
-    0x99,
-    0x0B,
-    0xB0,
-    0x59,
-    0x0E,
-    0xF0,
-    0xA3,
-    0x0B,
-    0xB0,
-    0x09,
-    0x5F,
-    0xD6,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x09,
-    0xAA,
-    0x7C,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x09,
-    0xF4,
-    0x1F,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x09,
-    0xE0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x5F,
-    0x00,
-    0x90,
-    0x0B,
-    0xB0,
-    0xEF,
-    0x00,
-    0x90,
-    0x0B,
-    0xB0,
-    0xE9,
-    0x09,
-    0x90,
-    0x0B,
-    0xB0,
-    0x69,
-    0x3F,
-    0x90,
-    0x0B,
-    0xB0,
-    0x09,
-    0xCC,
-    0x90,
-    0x0B,
-    0xB0,
-    0x09,
-    0xF3,
-    0x96,
-    0x0B,
-    0xB0,
-    0x09,
-    0x90,
-    0x9E,
-    0x0B,
-    0xB0,
-    0x09,
-    0x00,
-    0xFE,
-    0x0B,
-    0xB0,
-    0x09,
-    0x00,
-    0xF5,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0xFF,
-    0x5C,
-    0x00,
-    0x50,
-    0xBF,
-    0x44,
-    0xFA,
-    0x05,
-    0xE0,
-    0x0C,
-    0x00,
-    0xC0,
-    0x0E,
-    0xF2,
-    0x06,
-    0x00,
-    0x60,
-    0x2F,
-    0xF3,
-    0x05,
-    0x00,
-    0x50,
-    0x3F,
-    0xF2,
-    0x06,
-    0x00,
-    0x60,
-    0x2F,
-    0xE0,
-    0x0C,
-    0x00,
-    0xC0,
-    0x0E,
-    0x50,
-    0xBF,
-    0x44,
-    0xFB,
-    0x05,
-    0x00,
-    0xC5,
-    0xFF,
-    0x4C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xFF,
-    0xCF,
-    0x04,
-    0xB0,
-    0x3C,
-    0xB4,
-    0x2F,
-    0xB0,
-    0x0B,
-    0x30,
-    0x5F,
-    0xB0,
-    0x0B,
-    0x90,
-    0x2F,
-    0xB0,
-    0xFF,
-    0xFF,
-    0x07,
-    0xB0,
-    0x3C,
-    0x03,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0xFF,
-    0x5C,
-    0x00,
-    0x50,
-    0xBF,
-    0x44,
-    0xFA,
-    0x05,
-    0xE0,
-    0x0C,
-    0x00,
-    0xC0,
-    0x0E,
-    0xF2,
-    0x06,
-    0x00,
-    0x60,
-    0x2F,
-    0xF3,
-    0x05,
-    0x00,
-    0x50,
-    0x3F,
-    0xF2,
-    0x06,
-    0x00,
-    0x60,
-    0x2F,
-    0xE0,
-    0x0C,
-    0x00,
-    0xC0,
-    0x0E,
-    0x50,
-    0xBF,
-    0x44,
-    0xFB,
-    0x05,
-    0x00,
-    0xC5,
-    0xFF,
-    0x4F,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x8F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xFF,
-    0xBF,
-    0x02,
-    0xD0,
-    0x3C,
-    0xD5,
-    0x0D,
-    0xD0,
-    0x0B,
-    0x70,
-    0x1F,
-    0xD0,
-    0x0B,
-    0xC1,
-    0x0D,
-    0xD0,
-    0xFF,
-    0xDF,
-    0x02,
-    0xD0,
-    0x3C,
-    0xCC,
-    0x00,
-    0xD0,
-    0x0B,
-    0xF3,
-    0x05,
-    0xD0,
-    0x0B,
-    0xA0,
-    0x0E,
-    0xD0,
-    0x0B,
-    0x10,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD4,
-    0xEF,
-    0x1B,
-    0xF1,
-    0x4A,
-    0x96,
-    0x30,
-    0x4F,
-    0x00,
-    0x00,
-    0xE0,
-    0x4D,
-    0x00,
-    0x00,
-    0xB1,
-    0xDF,
-    0x04,
-    0x00,
-    0x20,
-    0xFB,
-    0x02,
-    0x00,
-    0x10,
-    0x5F,
-    0x84,
-    0x45,
-    0xF9,
-    0x33,
-    0xFC,
-    0xCF,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xFF,
-    0xFF,
-    0xDF,
-    0x33,
-    0xF6,
-    0x36,
-    0x03,
-    0x30,
-    0x3F,
-    0x00,
-    0x00,
-    0xF3,
-    0x03,
-    0x00,
-    0x30,
-    0x3F,
-    0x00,
-    0x00,
-    0xF3,
-    0x03,
-    0x00,
-    0x30,
-    0x3F,
-    0x00,
-    0x00,
-    0xF3,
-    0x03,
-    0x00,
-    0x30,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0D,
-    0xD0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0D,
-    0xD0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0D,
-    0xD0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0D,
-    0xD0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0D,
-    0xD0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x0D,
-    0xB0,
-    0x0D,
-    0x00,
-    0xD0,
-    0x0B,
-    0x40,
-    0xAF,
-    0x44,
-    0xFA,
-    0x04,
-    0x00,
-    0xC5,
-    0xFF,
-    0x4C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBC,
-    0x00,
-    0x00,
-    0xCB,
-    0xF7,
-    0x00,
-    0x10,
-    0x7F,
-    0xF1,
-    0x06,
-    0x60,
-    0x1F,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0B,
-    0x50,
-    0x1F,
-    0xF1,
-    0x05,
-    0x00,
-    0x6F,
-    0xF7,
-    0x00,
-    0x00,
-    0xBA,
-    0xAB,
-    0x00,
-    0x00,
-    0xF5,
-    0x4F,
-    0x00,
-    0x00,
-    0xE0,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBC,
-    0x00,
-    0xE0,
-    0x0D,
-    0x00,
-    0xCB,
-    0xF8,
-    0x00,
-    0xF2,
-    0x2F,
-    0x00,
-    0x7F,
-    0xF3,
-    0x03,
-    0xC7,
-    0x6D,
-    0x30,
-    0x3F,
-    0xF0,
-    0x07,
-    0x9B,
-    0xB9,
-    0x70,
-    0x0F,
-    0xB0,
-    0x0B,
-    0x4F,
-    0xF5,
-    0xB0,
-    0x0B,
-    0x70,
-    0x4E,
-    0x0F,
-    0xF0,
-    0xE4,
-    0x07,
-    0x30,
-    0xAF,
-    0x0B,
-    0xC0,
-    0xFA,
-    0x03,
-    0x00,
-    0xEE,
-    0x07,
-    0x70,
-    0xEE,
-    0x00,
-    0x00,
-    0xFB,
-    0x02,
-    0x30,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF6,
-    0x03,
-    0x30,
-    0x6F,
-    0xC0,
-    0x0C,
-    0xC0,
-    0x0B,
-    0x20,
-    0x6F,
-    0xF6,
-    0x02,
-    0x00,
-    0xE6,
-    0x6E,
-    0x00,
-    0x00,
-    0xF1,
-    0x1F,
-    0x00,
-    0x00,
-    0xCA,
-    0xAD,
-    0x00,
-    0x40,
-    0x3F,
-    0xF4,
-    0x04,
-    0xE0,
-    0x09,
-    0xA0,
-    0x0D,
-    0xE9,
-    0x00,
-    0x10,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xEB,
-    0x00,
-    0x00,
-    0xBD,
-    0xF2,
-    0x07,
-    0x70,
-    0x1F,
-    0x80,
-    0x1F,
-    0xF1,
-    0x07,
-    0x00,
-    0x9E,
-    0xDA,
-    0x00,
-    0x00,
-    0xF6,
-    0x5F,
-    0x00,
-    0x00,
-    0xD0,
-    0x0C,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x31,
-    0x33,
-    0xFA,
-    0x03,
-    0x00,
-    0xF2,
-    0x08,
-    0x00,
-    0xB0,
-    0x0D,
-    0x00,
-    0x60,
-    0x3F,
-    0x00,
-    0x10,
-    0x9E,
-    0x00,
-    0x00,
-    0xEA,
-    0x00,
-    0x00,
-    0xF4,
-    0x38,
-    0x33,
-    0x92,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xBF,
-    0xF1,
-    0x15,
-    0xF1,
-    0x03,
-    0xF1,
-    0x03,
-    0xF1,
-    0x03,
-    0xF1,
-    0x03,
-    0xF1,
-    0x03,
-    0xF1,
-    0x03,
-    0xF1,
-    0x03,
-    0xF1,
-    0x15,
-    0xF1,
-    0xBF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0A,
-    0x00,
-    0xF5,
-    0x00,
-    0x00,
-    0x6E,
-    0x00,
-    0x90,
-    0x0C,
-    0x00,
-    0xF2,
-    0x02,
-    0x00,
-    0x8C,
-    0x00,
-    0x60,
-    0x0E,
-    0x00,
-    0xF1,
-    0x04,
-    0x00,
-    0xAA,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x1F,
-    0x51,
-    0x1F,
-    0x30,
-    0x1F,
-    0x30,
-    0x1F,
-    0x30,
-    0x1F,
-    0x30,
-    0x1F,
-    0x30,
-    0x1F,
-    0x30,
-    0x1F,
-    0x30,
-    0x1F,
-    0x51,
-    0x1F,
-    0xFB,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x0E,
-    0x00,
-    0x00,
-    0xEB,
-    0x07,
-    0x00,
-    0xE2,
-    0xE3,
-    0x00,
-    0xA0,
-    0x07,
-    0x7A,
-    0x10,
-    0x1E,
-    0x20,
-    0x1F,
-    0x98,
-    0x00,
-    0xA0,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0xDD,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE3,
-    0x07,
-    0x00,
-    0x00,
-    0x20,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xFC,
-    0xCF,
-    0x02,
-    0x20,
-    0x26,
-    0xD2,
-    0x0C,
-    0x00,
-    0x00,
-    0x90,
-    0x0D,
-    0x60,
-    0xEC,
-    0xFF,
-    0x0D,
-    0xF4,
-    0x06,
-    0x90,
-    0x0D,
-    0xF4,
-    0x16,
-    0xE5,
-    0x0D,
-    0xA0,
-    0xFF,
-    0x5A,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0xF0,
-    0xB9,
-    0xDF,
-    0x03,
-    0xF0,
-    0x5E,
-    0xC4,
-    0x0E,
-    0xF0,
-    0x0A,
-    0x40,
-    0x3F,
-    0xF0,
-    0x07,
-    0x30,
-    0x5F,
-    0xF0,
-    0x0A,
-    0x40,
-    0x3F,
-    0xF0,
-    0x5F,
-    0xC4,
-    0x0E,
-    0xF0,
-    0xC7,
-    0xDF,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xFC,
-    0x5E,
-    0xE0,
-    0x4C,
-    0x25,
-    0xF4,
-    0x04,
-    0x00,
-    0xF5,
-    0x01,
-    0x00,
-    0xF4,
-    0x03,
-    0x00,
-    0xE0,
-    0x4C,
-    0x45,
-    0x30,
-    0xFC,
-    0x5E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x70,
-    0x0F,
-    0x30,
-    0xFD,
-    0xAC,
-    0x0F,
-    0xE0,
-    0x4D,
-    0xE5,
-    0x0F,
-    0xF3,
-    0x04,
-    0x80,
-    0x0F,
-    0xF5,
-    0x03,
-    0x70,
-    0x0F,
-    0xF4,
-    0x04,
-    0x80,
-    0x0F,
-    0xE0,
-    0x3C,
-    0xE5,
-    0x0F,
-    0x30,
-    0xFD,
-    0x6B,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0xDF,
-    0x04,
-    0xD0,
-    0x2A,
-    0xE9,
-    0x41,
-    0x3F,
-    0x10,
-    0x5F,
-    0xF5,
-    0xFF,
-    0xFF,
-    0x45,
-    0x4F,
-    0x11,
-    0x01,
-    0xD0,
-    0x3B,
-    0x63,
-    0x01,
-    0xB2,
-    0xFF,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFA,
-    0x2E,
-    0x60,
-    0x5F,
-    0x04,
-    0x70,
-    0x0F,
-    0x00,
-    0xF8,
-    0xFF,
-    0x0D,
-    0x81,
-    0x1F,
-    0x01,
-    0x70,
-    0x0F,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE6,
-    0xFF,
-    0xAF,
-    0xF2,
-    0x05,
-    0xCA,
-    0x50,
-    0x1F,
-    0x70,
-    0x0F,
-    0xF2,
-    0x05,
-    0xCA,
-    0x00,
-    0xF7,
-    0xCF,
-    0x02,
-    0xE0,
-    0x05,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0x3D,
-    0xC8,
-    0x34,
-    0xD4,
-    0xCA,
-    0x0A,
-    0x30,
-    0x7D,
-    0xC3,
-    0xFF,
-    0x8D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0xF0,
-    0xB9,
-    0xDF,
-    0x03,
-    0xF0,
-    0x5F,
-    0xD4,
-    0x0D,
-    0xF0,
-    0x0A,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x09,
-    0xB0,
-    0x09,
-    0x00,
-    0x00,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9B,
-    0x00,
-    0x9B,
-    0x00,
-    0x00,
-    0x00,
-    0x9D,
-    0x00,
-    0x9D,
-    0x00,
-    0x9D,
-    0x00,
-    0x9D,
-    0x00,
-    0x9D,
-    0x00,
-    0x9D,
-    0x00,
-    0x9D,
-    0x00,
-    0x9D,
-    0x42,
-    0x8E,
-    0xF8,
-    0x1C,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0x7F,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0x7F,
-    0x50,
-    0x4F,
-    0xF0,
-    0x37,
-    0x6F,
-    0x00,
-    0x8F,
-    0x8E,
-    0x00,
-    0xF0,
-    0xFE,
-    0x06,
-    0x00,
-    0xAF,
-    0xF6,
-    0x02,
-    0xF0,
-    0x07,
-    0xDC,
-    0x00,
-    0x7F,
-    0x20,
-    0x8F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0xD0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xC7,
-    0xCF,
-    0xB3,
-    0xEF,
-    0x04,
-    0xF0,
-    0x5E,
-    0xF4,
-    0x7F,
-    0xC3,
-    0x0D,
-    0xF0,
-    0x09,
-    0xB0,
-    0x0E,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0xB0,
-    0x0B,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0xB0,
-    0x0B,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0xB0,
-    0x0B,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0xB0,
-    0x0B,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xC7,
-    0xDF,
-    0x04,
-    0xF0,
-    0x5F,
-    0xD4,
-    0x0D,
-    0xF0,
-    0x0A,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xFB,
-    0xBF,
-    0x01,
-    0xD0,
-    0x4D,
-    0xD4,
-    0x0C,
-    0xF3,
-    0x04,
-    0x40,
-    0x3F,
-    0xF5,
-    0x03,
-    0x30,
-    0x5F,
-    0xF3,
-    0x04,
-    0x40,
-    0x3F,
-    0xC0,
-    0x4D,
-    0xD4,
-    0x0D,
-    0x10,
-    0xFA,
-    0xBF,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xB6,
-    0xDF,
-    0x03,
-    0xF0,
-    0x5E,
-    0xC4,
-    0x0E,
-    0xF0,
-    0x09,
-    0x40,
-    0x3F,
-    0xF0,
-    0x07,
-    0x30,
-    0x5F,
-    0xF0,
-    0x0A,
-    0x40,
-    0x3F,
-    0xF0,
-    0x5F,
-    0xD4,
-    0x0E,
-    0xF0,
-    0xCA,
-    0xDF,
-    0x03,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xFD,
-    0x8B,
-    0x0F,
-    0xE0,
-    0x4D,
-    0xE5,
-    0x0F,
-    0xF3,
-    0x04,
-    0x80,
-    0x0F,
-    0xF5,
-    0x03,
-    0x70,
-    0x0F,
-    0xF4,
-    0x04,
-    0x80,
-    0x0F,
-    0xE0,
-    0x3C,
-    0xE4,
-    0x0F,
-    0x30,
-    0xFD,
-    0x9B,
-    0x0F,
-    0x00,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x86,
-    0xAE,
-    0xD0,
-    0xBE,
-    0x36,
-    0xD0,
-    0x0D,
-    0x00,
-    0xD0,
-    0x09,
-    0x00,
-    0xD0,
-    0x09,
-    0x00,
-    0xD0,
-    0x09,
-    0x00,
-    0xD0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFE,
-    0x2C,
-    0xF5,
-    0x25,
-    0x06,
-    0xF3,
-    0x1A,
-    0x00,
-    0x50,
-    0xFD,
-    0x0A,
-    0x00,
-    0x60,
-    0x6F,
-    0x53,
-    0x41,
-    0x5F,
-    0xD3,
-    0xEF,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0x00,
-    0x90,
-    0x0B,
-    0x80,
-    0xFF,
-    0x9F,
-    0xD1,
-    0x1C,
-    0x00,
-    0xBD,
-    0x00,
-    0xD0,
-    0x0B,
-    0x00,
-    0xBD,
-    0x00,
-    0xB0,
-    0x3D,
-    0x02,
-    0xD3,
-    0x8F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0x70,
-    0x0F,
-    0xF0,
-    0x07,
-    0xA0,
-    0x0F,
-    0xD0,
-    0x3D,
-    0xF5,
-    0x0F,
-    0x40,
-    0xFD,
-    0x7C,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x0B,
-    0x00,
-    0xCB,
-    0xF6,
-    0x01,
-    0xF1,
-    0x06,
-    0x7F,
-    0x70,
-    0x0F,
-    0xA0,
-    0x0C,
-    0xAC,
-    0x00,
-    0xF4,
-    0xF4,
-    0x03,
-    0x00,
-    0xDD,
-    0x0D,
-    0x00,
-    0x70,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0C,
-    0x70,
-    0x7F,
-    0x00,
-    0xBC,
-    0xF6,
-    0x00,
-    0xDB,
-    0x0B,
-    0xF0,
-    0x16,
-    0x5F,
-    0xF0,
-    0xF5,
-    0x50,
-    0x1F,
-    0xD0,
-    0x59,
-    0x0E,
-    0x5E,
-    0xC9,
-    0x00,
-    0xD8,
-    0x9A,
-    0x90,
-    0xD9,
-    0x07,
-    0x30,
-    0xEF,
-    0x04,
-    0xE5,
-    0x3F,
-    0x00,
-    0xE0,
-    0x0F,
-    0x00,
-    0xEF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x4F,
-    0x40,
-    0x5F,
-    0xA0,
-    0x0D,
-    0xAD,
-    0x00,
-    0xE1,
-    0xED,
-    0x01,
-    0x00,
-    0xF9,
-    0x08,
-    0x00,
-    0xF2,
-    0xFB,
-    0x02,
-    0xC0,
-    0x0C,
-    0xCC,
-    0x70,
-    0x2F,
-    0x20,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x0C,
-    0x00,
-    0xCB,
-    0xF6,
-    0x02,
-    0xF1,
-    0x06,
-    0x8E,
-    0x70,
-    0x0F,
-    0x80,
-    0x0D,
-    0xAC,
-    0x00,
-    0xF2,
-    0xF5,
-    0x04,
-    0x00,
-    0xEC,
-    0x0D,
-    0x00,
-    0x50,
-    0x7F,
-    0x00,
-    0x00,
-    0xF5,
-    0x01,
-    0x20,
-    0xE4,
-    0x0A,
-    0x00,
-    0xFB,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF5,
-    0xFF,
-    0x7F,
-    0x10,
-    0x81,
-    0x2F,
-    0x00,
-    0xF2,
-    0x06,
-    0x00,
-    0xCC,
-    0x00,
-    0x70,
-    0x1E,
-    0x00,
-    0xF2,
-    0x18,
-    0x01,
-    0xF9,
-    0xFF,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xBD,
-    0x00,
-    0xAF,
-    0x01,
-    0xF0,
-    0x05,
-    0x00,
-    0x5F,
-    0x00,
-    0xF4,
-    0x04,
-    0xFB,
-    0x08,
-    0x20,
-    0xF8,
-    0x03,
-    0x00,
-    0x5F,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0xAF,
-    0x01,
-    0x50,
-    0xBD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x5D,
-    0x00,
-    0xA1,
-    0x0F,
-    0x00,
-    0xF5,
-    0x00,
-    0x50,
-    0x0F,
-    0x00,
-    0xF3,
-    0x04,
-    0x00,
-    0xF8,
-    0x0B,
-    0xF2,
-    0x28,
-    0x50,
-    0x0F,
-    0x00,
-    0xF5,
-    0x00,
-    0x91,
-    0x0F,
-    0xB0,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD2,
-    0x9F,
-    0x43,
-    0x44,
-    0x23,
-    0xE9,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x99,
-    0x99,
-    0x0A,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x00,
-    0x00,
-    0x09,
-    0xA0,
-    0x99,
-    0x99,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_SEMIBOLD_10_13PX = [
-    FontCharacter(3, 21, 0),
-    FontCharacter(4, 28, 21),
-    FontCharacter(6, 42, 49),
-    FontCharacter(8, 56, 91),
-    FontCharacter(7, 49, 147),
-    FontCharacter(11, 77, 196),
-    FontCharacter(10, 70, 273),
-    FontCharacter(3, 21, 343),
-    FontCharacter(4, 28, 364),
-    FontCharacter(4, 28, 392),
-    FontCharacter(7, 49, 420),
-    FontCharacter(7, 49, 469),
-    FontCharacter(3, 21, 518),
-    FontCharacter(4, 28, 539),
-    FontCharacter(4, 28, 567),
-    FontCharacter(5, 35, 595),
-    FontCharacter(7, 49, 630),
-    FontCharacter(7, 49, 679),
-    FontCharacter(7, 49, 728),
-    FontCharacter(7, 49, 777),
-    FontCharacter(7, 49, 826),
-    FontCharacter(7, 49, 875),
-    FontCharacter(7, 49, 924),
-    FontCharacter(7, 49, 973),
-    FontCharacter(7, 49, 1022),
-    FontCharacter(7, 49, 1071),
-    FontCharacter(4, 28, 1120),
-    FontCharacter(4, 28, 1148),
-    FontCharacter(7, 49, 1176),
-    FontCharacter(7, 49, 1225),
-    FontCharacter(7, 49, 1274),
-    FontCharacter(6, 42, 1323),
-    FontCharacter(12, 84, 1365),
-    FontCharacter(9, 63, 1449),
-    FontCharacter(9, 63, 1512),
-    FontCharacter(8, 56, 1575),
-    FontCharacter(10, 70, 1631),
-    FontCharacter(7, 49, 1701),
-    FontCharacter(7, 49, 1750),
-    FontCharacter(9, 63, 1799),
-    FontCharacter(10, 70, 1862),
-    FontCharacter(4, 28, 1932),
-    FontCharacter(4, 28, 1960),
-    FontCharacter(8, 56, 1988),
-    FontCharacter(7, 49, 2044),
-    FontCharacter(12, 84, 2093),
-    FontCharacter(10, 70, 2177),
-    FontCharacter(10, 70, 2247),
-    FontCharacter(8, 56, 2317),
-    FontCharacter(10, 70, 2373),
-    FontCharacter(8, 56, 2443),
-    FontCharacter(7, 49, 2499),
-    FontCharacter(7, 49, 2548),
-    FontCharacter(10, 70, 2597),
-    FontCharacter(8, 56, 2667),
-    FontCharacter(12, 84, 2723),
-    FontCharacter(8, 56, 2807),
-    FontCharacter(8, 56, 2863),
-    FontCharacter(7, 49, 2919),
-    FontCharacter(4, 28, 2968),
-    FontCharacter(5, 35, 2996),
-    FontCharacter(4, 28, 3031),
-    FontCharacter(7, 49, 3059),
-    FontCharacter(6, 42, 3108),
-    FontCharacter(8, 56, 3150),
-    FontCharacter(8, 56, 3206),
-    FontCharacter(8, 56, 3262),
-    FontCharacter(6, 42, 3318),
-    FontCharacter(8, 56, 3360),
-    FontCharacter(7, 49, 3416),
-    FontCharacter(6, 42, 3465),
-    FontCharacter(7, 49, 3507),
-    FontCharacter(8, 56, 3556),
-    FontCharacter(4, 28, 3612),
-    FontCharacter(4, 28, 3640),
-    FontCharacter(7, 49, 3668),
-    FontCharacter(4, 28, 3717),
-    FontCharacter(12, 84, 3745),
-    FontCharacter(8, 56, 3829),
-    FontCharacter(8, 56, 3885),
-    FontCharacter(8, 56, 3941),
-    FontCharacter(8, 56, 3997),
-    FontCharacter(6, 42, 4053),
-    FontCharacter(6, 42, 4095),
-    FontCharacter(5, 35, 4137),
-    FontCharacter(8, 56, 4172),
-    FontCharacter(7, 49, 4228),
-    FontCharacter(11, 77, 4277),
-    FontCharacter(7, 49, 4354),
-    FontCharacter(7, 49, 4403),
-    FontCharacter(6, 42, 4452),
-    FontCharacter(5, 35, 4494),
-    FontCharacter(7, 49, 4529),
-    FontCharacter(5, 35, 4578),
-    FontCharacter(7, 49, 4613),
-    FontCharacter(8, 56, 4662),
-]
+    fonts = []
+    for i in range(count):
+        entry = FONT_PACK_ENTRY.unpack_from(data, FONT_PACK_HEADER.size + i * FONT_PACK_ENTRY.size)
+        nb_chars, characters_offset, bitmap_offset, bitmap_size = entry[7:]
+        characters = [
+            FontCharacter(*character)
+            for character in FONT_PACK_CHARACTER.iter_unpack(
+                data[characters_offset : characters_offset + nb_chars * FONT_PACK_CHARACTER.size]
+            )
+        ]
+        fonts.append(Font(*entry[:7], characters, data[bitmap_offset : bitmap_offset + bitmap_size]))
 
-bitmapOPEN_SANS_SEMIBOLD_8_11PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x13,
-    0x1F,
-    0xF1,
-    0x01,
-    0x0F,
-    0xF0,
-    0x00,
-    0x00,
-    0x91,
-    0x21,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE3,
-    0xE0,
-    0x13,
-    0x0D,
-    0x1D,
-    0xC0,
-    0xC0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x77,
-    0xB2,
-    0x00,
-    0xA0,
-    0x63,
-    0x07,
-    0xD4,
-    0xDF,
-    0xEF,
-    0x0A,
-    0xE0,
-    0xC0,
-    0x02,
-    0x20,
-    0x0B,
-    0x0E,
-    0xA0,
-    0xEE,
-    0xFD,
-    0x4D,
-    0x80,
-    0x46,
-    0x0A,
-    0x00,
-    0x2B,
-    0x67,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x55,
-    0x00,
-    0x90,
-    0xFE,
-    0x1C,
-    0xE5,
-    0x67,
-    0x04,
-    0xE2,
-    0x8D,
-    0x00,
-    0x10,
-    0xFA,
-    0x2D,
-    0x23,
-    0x65,
-    0x6E,
-    0xD5,
-    0xEF,
-    0x0A,
-    0x00,
-    0x55,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD1,
-    0x2D,
-    0x30,
-    0x0C,
-    0x70,
-    0x68,
-    0x09,
-    0x4B,
-    0x00,
-    0x79,
-    0xB5,
-    0xC3,
-    0x00,
-    0x70,
-    0x68,
-    0xB9,
-    0xD7,
-    0x1D,
-    0xD1,
-    0x7D,
-    0x9B,
-    0x86,
-    0x07,
-    0x00,
-    0x3C,
-    0x5B,
-    0x97,
-    0x00,
-    0xB4,
-    0x90,
-    0x86,
-    0x07,
-    0xC0,
-    0x03,
-    0xD2,
-    0x1D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xFD,
-    0x0A,
-    0x00,
-    0xB0,
-    0x07,
-    0x3E,
-    0x00,
-    0x90,
-    0x39,
-    0x1F,
-    0x00,
-    0x20,
-    0xEF,
-    0x04,
-    0x01,
-    0xE1,
-    0xEA,
-    0x06,
-    0x6D,
-    0xE7,
-    0x20,
-    0xAE,
-    0x0E,
-    0xE5,
-    0x13,
-    0xF7,
-    0x09,
-    0x90,
-    0xFE,
-    0x6B,
-    0x6E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x10,
-    0x0E,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x1F,
-    0xC5,
-    0x80,
-    0x0A,
-    0x89,
-    0x90,
-    0x08,
-    0x98,
-    0x50,
-    0x0C,
-    0xF1,
-    0x00,
-    0x6A,
-    0x00,
-    0x00,
-    0x97,
-    0x10,
-    0x0F,
-    0xC0,
-    0x05,
-    0x8A,
-    0x80,
-    0x09,
-    0x98,
-    0x90,
-    0x08,
-    0x5C,
-    0xF0,
-    0x61,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x88,
-    0x00,
-    0x43,
-    0x77,
-    0x34,
-    0xB5,
-    0xEE,
-    0x4B,
-    0x30,
-    0xDC,
-    0x03,
-    0x80,
-    0x55,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x11,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0xF7,
-    0xFF,
-    0x7F,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x1F,
-    0xC4,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x9F,
-    0x10,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0x21,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB6,
-    0x00,
-    0x6B,
-    0x10,
-    0x1F,
-    0x60,
-    0x0B,
-    0xB0,
-    0x06,
-    0xF1,
-    0x01,
-    0xB6,
-    0x00,
-    0x6B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xEE,
-    0x06,
-    0xF2,
-    0x44,
-    0x1F,
-    0xC6,
-    0x00,
-    0x6C,
-    0xB7,
-    0x00,
-    0x7B,
-    0xB7,
-    0x00,
-    0x7B,
-    0xC6,
-    0x00,
-    0x6C,
-    0xF1,
-    0x33,
-    0x2F,
-    0x60,
-    0xEE,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x01,
-    0xB0,
-    0xFC,
-    0x01,
-    0x60,
-    0xF3,
-    0x01,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA1,
-    0xEF,
-    0x07,
-    0x82,
-    0x42,
-    0x2F,
-    0x00,
-    0x00,
-    0x3F,
-    0x00,
-    0x60,
-    0x0E,
-    0x00,
-    0xE3,
-    0x04,
-    0x20,
-    0x4D,
-    0x00,
-    0xE1,
-    0x18,
-    0x01,
-    0xF7,
-    0xFF,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB2,
-    0xEF,
-    0x09,
-    0x61,
-    0x31,
-    0x3F,
-    0x00,
-    0x40,
-    0x1E,
-    0x50,
-    0xFF,
-    0x06,
-    0x00,
-    0x40,
-    0x3F,
-    0x00,
-    0x00,
-    0x7D,
-    0x23,
-    0x40,
-    0x4F,
-    0xE6,
-    0xEF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x0D,
-    0x00,
-    0xE5,
-    0x0D,
-    0x10,
-    0x7D,
-    0x0D,
-    0xB0,
-    0x55,
-    0x0D,
-    0xA6,
-    0x50,
-    0x0D,
-    0xFB,
-    0xFF,
-    0xDF,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0x0F,
-    0xF1,
-    0x13,
-    0x01,
-    0xF1,
-    0x00,
-    0x00,
-    0xF3,
-    0xFE,
-    0x09,
-    0x10,
-    0x40,
-    0x4F,
-    0x00,
-    0x00,
-    0x7D,
-    0x22,
-    0x40,
-    0x3F,
-    0xE3,
-    0xEF,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xFA,
-    0x0F,
-    0xC0,
-    0x19,
-    0x00,
-    0xE3,
-    0x00,
-    0x00,
-    0xC6,
-    0xFB,
-    0x0B,
-    0xE7,
-    0x02,
-    0x6D,
-    0xC6,
-    0x00,
-    0x9A,
-    0xF2,
-    0x13,
-    0x5E,
-    0x60,
-    0xFE,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0x9F,
-    0x10,
-    0x21,
-    0x4E,
-    0x00,
-    0x50,
-    0x0E,
-    0x00,
-    0xC0,
-    0x07,
-    0x00,
-    0xF2,
-    0x01,
-    0x00,
-    0xA9,
-    0x00,
-    0x00,
-    0x4F,
-    0x00,
-    0x70,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0x09,
-    0xD3,
-    0x00,
-    0x3E,
-    0xE1,
-    0x33,
-    0x1E,
-    0x60,
-    0xFF,
-    0x04,
-    0xE2,
-    0x64,
-    0x2E,
-    0x87,
-    0x00,
-    0x78,
-    0xC6,
-    0x00,
-    0x6C,
-    0xA0,
-    0xFF,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xEF,
-    0x06,
-    0xE5,
-    0x31,
-    0x2F,
-    0xA7,
-    0x00,
-    0x6C,
-    0xD6,
-    0x20,
-    0x7E,
-    0xA0,
-    0xCF,
-    0x7C,
-    0x00,
-    0x00,
-    0x4E,
-    0x00,
-    0x90,
-    0x0D,
-    0xF0,
-    0xBF,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x12,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0x21,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x12,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x1F,
-    0xC5,
-    0x80,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x66,
-    0x00,
-    0xD4,
-    0x1A,
-    0xB2,
-    0x2B,
-    0x00,
-    0xE4,
-    0x18,
-    0x00,
-    0x00,
-    0xE7,
-    0x19,
-    0x00,
-    0x00,
-    0x67,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0xFF,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0xFF,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x66,
-    0x00,
-    0x00,
-    0xA1,
-    0x4D,
-    0x00,
-    0x00,
-    0xB2,
-    0x2B,
-    0x00,
-    0x81,
-    0x4E,
-    0x91,
-    0x7E,
-    0x00,
-    0x76,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE7,
-    0xCF,
-    0x43,
-    0x12,
-    0xAA,
-    0x00,
-    0xC0,
-    0x07,
-    0xD1,
-    0x08,
-    0x70,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x06,
-    0x00,
-    0xC9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA2,
-    0xDD,
-    0x6C,
-    0x00,
-    0x30,
-    0x3D,
-    0x00,
-    0xA0,
-    0x08,
-    0xD0,
-    0x42,
-    0xDD,
-    0x0C,
-    0x1D,
-    0xB3,
-    0xE0,
-    0x01,
-    0x0F,
-    0x59,
-    0x95,
-    0xC3,
-    0x00,
-    0x0F,
-    0x58,
-    0x95,
-    0xD2,
-    0x40,
-    0x0E,
-    0x2C,
-    0xD1,
-    0x80,
-    0xBD,
-    0xD8,
-    0x08,
-    0x90,
-    0x0A,
-    0x00,
-    0x10,
-    0x00,
-    0x00,
-    0xC6,
-    0xDD,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF5,
-    0x05,
-    0x00,
-    0xB0,
-    0xBC,
-    0x00,
-    0x00,
-    0x4F,
-    0x0F,
-    0x00,
-    0xD6,
-    0xD0,
-    0x06,
-    0xB0,
-    0x08,
-    0xB8,
-    0x10,
-    0xFF,
-    0xFF,
-    0x1F,
-    0xD7,
-    0x11,
-    0xE1,
-    0xC7,
-    0x08,
-    0x00,
-    0xC8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0x7D,
-    0x00,
-    0x5F,
-    0x61,
-    0x2F,
-    0xF0,
-    0x03,
-    0xF4,
-    0x01,
-    0xFF,
-    0xFF,
-    0x07,
-    0xF0,
-    0x03,
-    0xF4,
-    0x02,
-    0x3F,
-    0x00,
-    0x5F,
-    0xF0,
-    0x15,
-    0xF5,
-    0x03,
-    0xFF,
-    0xEF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE8,
-    0xDF,
-    0x05,
-    0xD9,
-    0x13,
-    0x24,
-    0xF1,
-    0x04,
-    0x00,
-    0x40,
-    0x0F,
-    0x00,
-    0x00,
-    0xF4,
-    0x00,
-    0x00,
-    0x20,
-    0x3F,
-    0x00,
-    0x00,
-    0xB0,
-    0x3D,
-    0x31,
-    0x02,
-    0x90,
-    0xFE,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0x8D,
-    0x00,
-    0xF0,
-    0x16,
-    0xD3,
-    0x0A,
-    0xF0,
-    0x05,
-    0x30,
-    0x2F,
-    0xF0,
-    0x05,
-    0x00,
-    0x5F,
-    0xF0,
-    0x05,
-    0x00,
-    0x5F,
-    0xF0,
-    0x05,
-    0x40,
-    0x1F,
-    0xF0,
-    0x16,
-    0xE4,
-    0x09,
-    0xF0,
-    0xFF,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0x5F,
-    0xF0,
-    0x16,
-    0x01,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0xFF,
-    0x1F,
-    0xF0,
-    0x16,
-    0x01,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x16,
-    0x01,
-    0xF0,
-    0xFF,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0x9F,
-    0xF0,
-    0x16,
-    0x01,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0xFF,
-    0x5F,
-    0xF0,
-    0x16,
-    0x01,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD7,
-    0xEF,
-    0x0A,
-    0x90,
-    0x5E,
-    0x21,
-    0x04,
-    0xF1,
-    0x04,
-    0x00,
-    0x00,
-    0xF4,
-    0x00,
-    0x00,
-    0x00,
-    0xF4,
-    0x00,
-    0xFB,
-    0x1F,
-    0xF1,
-    0x03,
-    0x31,
-    0x1F,
-    0xA0,
-    0x4D,
-    0x31,
-    0x1F,
-    0x00,
-    0xE9,
-    0xEF,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0xFF,
-    0xFF,
-    0x0F,
-    0xF0,
-    0x15,
-    0x51,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x13,
-    0x3F,
-    0xF1,
-    0x13,
-    0x3F,
-    0xF1,
-    0x13,
-    0x3F,
-    0xF1,
-    0x13,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x3F,
-    0x10,
-    0x3F,
-    0x10,
-    0x3F,
-    0x10,
-    0x3F,
-    0x10,
-    0x3F,
-    0x10,
-    0x3F,
-    0x10,
-    0x3F,
-    0x10,
-    0x2F,
-    0x61,
-    0x0F,
-    0xEE,
-    0x06,
-    0x00,
-    0x00,
-    0xF0,
-    0x05,
-    0xD1,
-    0x07,
-    0x5F,
-    0xB0,
-    0x0A,
-    0xF0,
-    0x95,
-    0x0C,
-    0x00,
-    0xCF,
-    0x2F,
-    0x00,
-    0xF0,
-    0xCC,
-    0x0A,
-    0x00,
-    0x5F,
-    0xF2,
-    0x04,
-    0xF0,
-    0x05,
-    0xE7,
-    0x00,
-    0x5F,
-    0x00,
-    0xAC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0xF0,
-    0x16,
-    0x11,
-    0xF0,
-    0xFF,
-    0xBF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x0E,
-    0x00,
-    0xE0,
-    0x0F,
-    0xF0,
-    0x4E,
-    0x00,
-    0xE5,
-    0x0F,
-    0xF0,
-    0x99,
-    0x00,
-    0x9A,
-    0x0F,
-    0xF0,
-    0xE3,
-    0x00,
-    0x4E,
-    0x0F,
-    0xF0,
-    0xC3,
-    0x54,
-    0x3A,
-    0x0F,
-    0xF0,
-    0x73,
-    0xB9,
-    0x35,
-    0x0F,
-    0xF0,
-    0x13,
-    0xEE,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x9C,
-    0x30,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0xD3,
-    0x00,
-    0xED,
-    0x09,
-    0x30,
-    0x0D,
-    0xD0,
-    0xF7,
-    0x04,
-    0xD3,
-    0x00,
-    0x3D,
-    0xD8,
-    0x30,
-    0x0D,
-    0xD0,
-    0x03,
-    0x8D,
-    0xD3,
-    0x00,
-    0x3D,
-    0x40,
-    0x7F,
-    0x0D,
-    0xD0,
-    0x03,
-    0x90,
-    0xDE,
-    0x00,
-    0x3D,
-    0x00,
-    0xE0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE8,
-    0xEF,
-    0x08,
-    0x00,
-    0xDA,
-    0x14,
-    0xD4,
-    0x0A,
-    0xF1,
-    0x04,
-    0x00,
-    0xF4,
-    0x41,
-    0x0F,
-    0x00,
-    0x00,
-    0x4F,
-    0xF4,
-    0x00,
-    0x00,
-    0xF0,
-    0x14,
-    0x4F,
-    0x00,
-    0x40,
-    0x1F,
-    0xA0,
-    0x4D,
-    0x41,
-    0xAD,
-    0x00,
-    0x80,
-    0xFE,
-    0x8E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0xFF,
-    0x7D,
-    0x00,
-    0x6D,
-    0x51,
-    0x4F,
-    0xD0,
-    0x05,
-    0xD0,
-    0x06,
-    0x5D,
-    0x40,
-    0x3F,
-    0xD0,
-    0xFF,
-    0x7E,
-    0x00,
-    0x6D,
-    0x00,
-    0x00,
-    0xD0,
-    0x05,
-    0x00,
-    0x00,
-    0x5D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE8,
-    0xEF,
-    0x08,
-    0x00,
-    0xDA,
-    0x14,
-    0xD4,
-    0x0A,
-    0xF1,
-    0x04,
-    0x00,
-    0xF4,
-    0x41,
-    0x0F,
-    0x00,
-    0x00,
-    0x4F,
-    0xF4,
-    0x00,
-    0x00,
-    0xF0,
-    0x14,
-    0x4F,
-    0x00,
-    0x40,
-    0x1F,
-    0xA0,
-    0x4D,
-    0x41,
-    0x9D,
-    0x00,
-    0x80,
-    0xFE,
-    0x8F,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0x4D,
-    0x00,
-    0x6F,
-    0x71,
-    0x0F,
-    0xF0,
-    0x05,
-    0xF1,
-    0x02,
-    0x5F,
-    0x70,
-    0x0E,
-    0xF0,
-    0xFF,
-    0x3E,
-    0x00,
-    0x6F,
-    0xF3,
-    0x03,
-    0xF0,
-    0x05,
-    0xD7,
-    0x00,
-    0x5F,
-    0x00,
-    0x8D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xFE,
-    0x2C,
-    0xF4,
-    0x13,
-    0x05,
-    0xE4,
-    0x01,
-    0x00,
-    0xB0,
-    0x7E,
-    0x00,
-    0x00,
-    0xC5,
-    0x1E,
-    0x00,
-    0x00,
-    0x7D,
-    0x33,
-    0x21,
-    0x5E,
-    0xD5,
-    0xEF,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFD,
-    0xFF,
-    0xDF,
-    0x11,
-    0xAA,
-    0x11,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x03,
-    0x30,
-    0x0F,
-    0xF0,
-    0x04,
-    0x40,
-    0x0F,
-    0xB0,
-    0x2B,
-    0xB2,
-    0x0B,
-    0x10,
-    0xFB,
-    0xAF,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0x70,
-    0x7C,
-    0x0D,
-    0x00,
-    0x7D,
-    0xF1,
-    0x02,
-    0xF2,
-    0x01,
-    0x7B,
-    0x70,
-    0x0B,
-    0x60,
-    0x0D,
-    0x6D,
-    0x00,
-    0xF0,
-    0xF5,
-    0x00,
-    0x00,
-    0xEB,
-    0x0A,
-    0x00,
-    0x50,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0xBC,
-    0x00,
-    0xC7,
-    0xA8,
-    0x00,
-    0xFF,
-    0x00,
-    0x8A,
-    0xE5,
-    0x40,
-    0xCC,
-    0x04,
-    0x4E,
-    0xF1,
-    0x82,
-    0x98,
-    0x28,
-    0x0F,
-    0xD0,
-    0xC5,
-    0x54,
-    0x5C,
-    0x0D,
-    0x90,
-    0xF9,
-    0x00,
-    0x9F,
-    0x09,
-    0x50,
-    0xCE,
-    0x00,
-    0xEC,
-    0x05,
-    0x10,
-    0x8F,
-    0x00,
-    0xF8,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD7,
-    0x00,
-    0xD0,
-    0x06,
-    0x8C,
-    0x80,
-    0x0C,
-    0x30,
-    0x5F,
-    0x2F,
-    0x00,
-    0x80,
-    0x8F,
-    0x00,
-    0x00,
-    0xEB,
-    0x0A,
-    0x00,
-    0xE5,
-    0xE2,
-    0x04,
-    0xE0,
-    0x04,
-    0xE6,
-    0xA0,
-    0x0A,
-    0x00,
-    0xAC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xAB,
-    0x00,
-    0xA0,
-    0x2B,
-    0x3F,
-    0x40,
-    0x1F,
-    0x90,
-    0x0C,
-    0x7D,
-    0x00,
-    0xE0,
-    0xDB,
-    0x00,
-    0x00,
-    0xF6,
-    0x04,
-    0x00,
-    0x30,
-    0x1F,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0x30,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0x9F,
-    0x10,
-    0x51,
-    0x2F,
-    0x00,
-    0xC0,
-    0x08,
-    0x00,
-    0xE6,
-    0x00,
-    0x10,
-    0x5E,
-    0x00,
-    0xA0,
-    0x0B,
-    0x00,
-    0xF4,
-    0x14,
-    0x01,
-    0xF9,
-    0xFF,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xBF,
-    0xF1,
-    0x01,
-    0xF1,
-    0x01,
-    0xF1,
-    0x01,
-    0xF1,
-    0x01,
-    0xF1,
-    0x01,
-    0xF1,
-    0x01,
-    0xF1,
-    0x01,
-    0xF1,
-    0x01,
-    0xF1,
-    0xBF,
-    0x00,
-    0x00,
-    0x6B,
-    0x00,
-    0xB6,
-    0x00,
-    0xF1,
-    0x01,
-    0xB0,
-    0x06,
-    0x60,
-    0x0B,
-    0x10,
-    0x1F,
-    0x00,
-    0x6B,
-    0x00,
-    0xB6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0xFB,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x6A,
-    0x00,
-    0x20,
-    0xDC,
-    0x00,
-    0xA0,
-    0x74,
-    0x07,
-    0xD1,
-    0x00,
-    0x1D,
-    0x69,
-    0x00,
-    0x86,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xBB,
-    0xBB,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFE,
-    0x08,
-    0x20,
-    0x20,
-    0x1F,
-    0xA0,
-    0xDD,
-    0x3F,
-    0xD6,
-    0x10,
-    0x3F,
-    0xD7,
-    0x60,
-    0x3F,
-    0xD1,
-    0x8F,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x03,
-    0x00,
-    0x10,
-    0x3F,
-    0x00,
-    0x00,
-    0xF1,
-    0xE8,
-    0x6E,
-    0x10,
-    0x8F,
-    0x50,
-    0x2F,
-    0xF1,
-    0x03,
-    0xE0,
-    0x15,
-    0x3F,
-    0x00,
-    0x5E,
-    0xF1,
-    0x09,
-    0xF5,
-    0x12,
-    0x7F,
-    0xEE,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFE,
-    0x36,
-    0x3F,
-    0x11,
-    0xC7,
-    0x00,
-    0x70,
-    0x0C,
-    0x00,
-    0xF3,
-    0x03,
-    0x02,
-    0xE7,
-    0x6F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0x30,
-    0x1F,
-    0x60,
-    0xEE,
-    0xF9,
-    0x21,
-    0x5F,
-    0x80,
-    0x1F,
-    0xE5,
-    0x00,
-    0xF2,
-    0x51,
-    0x0D,
-    0x10,
-    0x1F,
-    0xF2,
-    0x04,
-    0xF8,
-    0x01,
-    0xE7,
-    0x7E,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xFE,
-    0x09,
-    0xE2,
-    0x01,
-    0x5D,
-    0xF6,
-    0xDD,
-    0x6D,
-    0xE7,
-    0x00,
-    0x00,
-    0xF2,
-    0x05,
-    0x12,
-    0x60,
-    0xFE,
-    0x2D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xFE,
-    0x04,
-    0x8C,
-    0x00,
-    0xFA,
-    0xDF,
-    0x00,
-    0x7D,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0x7D,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0xED,
-    0xAF,
-    0xD5,
-    0x20,
-    0x0F,
-    0xD5,
-    0x20,
-    0x0F,
-    0xC0,
-    0xDE,
-    0x06,
-    0xE0,
-    0x00,
-    0x00,
-    0xE0,
-    0xFF,
-    0x4E,
-    0x7A,
-    0x11,
-    0xB9,
-    0x5D,
-    0x00,
-    0x9A,
-    0xD4,
-    0xDD,
-    0x09,
-    0xF1,
-    0x01,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0xE8,
-    0x7E,
-    0x10,
-    0x9F,
-    0x60,
-    0x0F,
-    0xF1,
-    0x02,
-    0xF1,
-    0x11,
-    0x1F,
-    0x10,
-    0x1F,
-    0xF1,
-    0x01,
-    0xF1,
-    0x11,
-    0x1F,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE1,
-    0x01,
-    0x00,
-    0xF1,
-    0x11,
-    0x1F,
-    0xF1,
-    0x11,
-    0x1F,
-    0xF1,
-    0x11,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x1E,
-    0x00,
-    0x00,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x30,
-    0x1F,
-    0xFA,
-    0x09,
-    0xF1,
-    0x01,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0xF1,
-    0x21,
-    0x5E,
-    0xF1,
-    0xD2,
-    0x07,
-    0xF1,
-    0xBB,
-    0x00,
-    0xF1,
-    0xFA,
-    0x02,
-    0xF1,
-    0x81,
-    0x0D,
-    0xF1,
-    0x01,
-    0x9D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x11,
-    0x1F,
-    0xF1,
-    0x11,
-    0x1F,
-    0xF1,
-    0x11,
-    0x1F,
-    0xF1,
-    0x11,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xE7,
-    0x8F,
-    0xE8,
-    0x7E,
-    0x10,
-    0x9F,
-    0x60,
-    0x8F,
-    0x60,
-    0x0F,
-    0xF1,
-    0x03,
-    0xF1,
-    0x01,
-    0xF1,
-    0x11,
-    0x3F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0xF1,
-    0x03,
-    0xF1,
-    0x01,
-    0xF1,
-    0x11,
-    0x3F,
-    0x10,
-    0x1F,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xE7,
-    0x7E,
-    0x10,
-    0x9F,
-    0x60,
-    0x0F,
-    0xF1,
-    0x02,
-    0xF1,
-    0x11,
-    0x1F,
-    0x10,
-    0x1F,
-    0xF1,
-    0x01,
-    0xF1,
-    0x11,
-    0x1F,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xFD,
-    0x4D,
-    0x10,
-    0x5F,
-    0x50,
-    0x1F,
-    0xE5,
-    0x00,
-    0xE0,
-    0x55,
-    0x0E,
-    0x00,
-    0x5E,
-    0xF1,
-    0x05,
-    0xF5,
-    0x01,
-    0xD4,
-    0xDF,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xE7,
-    0x6E,
-    0x10,
-    0x8F,
-    0x50,
-    0x2F,
-    0xF1,
-    0x03,
-    0xE0,
-    0x15,
-    0x3F,
-    0x00,
-    0x5E,
-    0xF1,
-    0x09,
-    0xF5,
-    0x12,
-    0x9F,
-    0xEE,
-    0x06,
-    0xF1,
-    0x03,
-    0x00,
-    0x10,
-    0x3F,
-    0x00,
-    0x00,
-    0xF1,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xEE,
-    0xF7,
-    0x21,
-    0x5F,
-    0x80,
-    0x1F,
-    0xE5,
-    0x00,
-    0xF2,
-    0x51,
-    0x0D,
-    0x10,
-    0x1F,
-    0xF2,
-    0x04,
-    0xF8,
-    0x01,
-    0xE7,
-    0x8E,
-    0x1F,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0x30,
-    0x1F,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xD4,
-    0x0B,
-    0xCF,
-    0x13,
-    0xF0,
-    0x04,
-    0x00,
-    0x3F,
-    0x00,
-    0xF0,
-    0x03,
-    0x00,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC1,
-    0xEF,
-    0x73,
-    0x0C,
-    0x02,
-    0xE3,
-    0x3B,
-    0x00,
-    0x81,
-    0x4F,
-    0x02,
-    0xB0,
-    0x57,
-    0xFE,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0xFB,
-    0xBF,
-    0xF1,
-    0x03,
-    0xF1,
-    0x03,
-    0xF1,
-    0x03,
-    0xF0,
-    0x05,
-    0x80,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0xF1,
-    0x11,
-    0x1F,
-    0x10,
-    0x1F,
-    0xF1,
-    0x01,
-    0xF1,
-    0x11,
-    0x1F,
-    0x20,
-    0x1F,
-    0xF0,
-    0x05,
-    0xF9,
-    0x01,
-    0xE7,
-    0x7E,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0xC7,
-    0xD6,
-    0x00,
-    0x6D,
-    0xF0,
-    0x33,
-    0x0F,
-    0xA0,
-    0x98,
-    0x09,
-    0x40,
-    0xDD,
-    0x03,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x8B,
-    0x40,
-    0x4F,
-    0x80,
-    0x7B,
-    0x0C,
-    0xC9,
-    0x09,
-    0x7C,
-    0xF2,
-    0xD0,
-    0xD4,
-    0xF0,
-    0x02,
-    0x6E,
-    0x0D,
-    0x6E,
-    0x0E,
-    0x90,
-    0x9D,
-    0x90,
-    0x9D,
-    0x00,
-    0xF5,
-    0x04,
-    0xF5,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE6,
-    0x00,
-    0x6E,
-    0xB0,
-    0x99,
-    0x0B,
-    0x10,
-    0xEE,
-    0x01,
-    0x20,
-    0xFF,
-    0x02,
-    0xC0,
-    0x87,
-    0x0C,
-    0xD8,
-    0x00,
-    0x8D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x8C,
-    0x00,
-    0xC8,
-    0xE6,
-    0x00,
-    0x6D,
-    0xE0,
-    0x34,
-    0x1F,
-    0x80,
-    0x99,
-    0x0B,
-    0x20,
-    0xDE,
-    0x05,
-    0x00,
-    0xEC,
-    0x00,
-    0x00,
-    0x9B,
-    0x00,
-    0x30,
-    0x2F,
-    0x00,
-    0xEB,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0xFF,
-    0x07,
-    0x30,
-    0x2E,
-    0x00,
-    0x7D,
-    0x00,
-    0xC8,
-    0x00,
-    0xF2,
-    0x02,
-    0x90,
-    0xFF,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xBC,
-    0x50,
-    0x0D,
-    0x50,
-    0x0B,
-    0x80,
-    0x0B,
-    0xEB,
-    0x02,
-    0x90,
-    0x0A,
-    0x50,
-    0x0B,
-    0x50,
-    0x0B,
-    0x50,
-    0x0D,
-    0x00,
-    0xBB,
-    0x00,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0x00,
-    0x77,
-    0x00,
-    0xCB,
-    0x01,
-    0xC0,
-    0x06,
-    0xB0,
-    0x07,
-    0xA0,
-    0x09,
-    0x10,
-    0xBE,
-    0x90,
-    0x0A,
-    0xB0,
-    0x07,
-    0xB0,
-    0x07,
-    0xD0,
-    0x05,
-    0xBB,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE4,
-    0x3C,
-    0x40,
-    0x04,
-    0xC3,
-    0x4E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x99,
-    0xB9,
-    0x00,
-    0x07,
-    0x00,
-    0x07,
-    0x70,
-    0x00,
-    0x70,
-    0x00,
-    0x07,
-    0x00,
-    0x07,
-    0x70,
-    0x00,
-    0x70,
-    0x00,
-    0x07,
-    0x00,
-    0x07,
-    0x70,
-    0x00,
-    0x70,
-    0x00,
-    0x9B,
-    0x99,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_SEMIBOLD_8_11PX = [
-    FontCharacter(3, 17, 0),
-    FontCharacter(3, 17, 17),
-    FontCharacter(5, 28, 34),
-    FontCharacter(7, 39, 62),
-    FontCharacter(6, 33, 101),
-    FontCharacter(9, 50, 134),
-    FontCharacter(8, 44, 184),
-    FontCharacter(3, 17, 228),
-    FontCharacter(3, 17, 245),
-    FontCharacter(3, 17, 262),
-    FontCharacter(6, 33, 279),
-    FontCharacter(6, 33, 312),
-    FontCharacter(3, 17, 345),
-    FontCharacter(4, 22, 362),
-    FontCharacter(3, 17, 384),
-    FontCharacter(4, 22, 401),
-    FontCharacter(6, 33, 423),
-    FontCharacter(6, 33, 456),
-    FontCharacter(6, 33, 489),
-    FontCharacter(6, 33, 522),
-    FontCharacter(6, 33, 555),
-    FontCharacter(6, 33, 588),
-    FontCharacter(6, 33, 621),
-    FontCharacter(6, 33, 654),
-    FontCharacter(6, 33, 687),
-    FontCharacter(6, 33, 720),
-    FontCharacter(3, 17, 753),
-    FontCharacter(3, 17, 770),
-    FontCharacter(6, 33, 787),
-    FontCharacter(6, 33, 820),
-    FontCharacter(6, 33, 853),
-    FontCharacter(5, 28, 886),
-    FontCharacter(10, 55, 914),
-    FontCharacter(7, 39, 969),
-    FontCharacter(7, 39, 1008),
-    FontCharacter(7, 39, 1047),
-    FontCharacter(8, 44, 1086),
-    FontCharacter(6, 33, 1130),
-    FontCharacter(6, 33, 1163),
-    FontCharacter(8, 44, 1196),
-    FontCharacter(8, 44, 1240),
-    FontCharacter(3, 17, 1284),
-    FontCharacter(4, 22, 1301),
-    FontCharacter(7, 39, 1323),
-    FontCharacter(6, 33, 1362),
-    FontCharacter(10, 55, 1395),
-    FontCharacter(9, 50, 1450),
-    FontCharacter(9, 50, 1500),
-    FontCharacter(7, 39, 1550),
-    FontCharacter(9, 50, 1589),
-    FontCharacter(7, 39, 1639),
-    FontCharacter(6, 33, 1678),
-    FontCharacter(6, 33, 1711),
-    FontCharacter(8, 44, 1744),
-    FontCharacter(7, 39, 1788),
-    FontCharacter(10, 55, 1827),
-    FontCharacter(7, 39, 1882),
-    FontCharacter(7, 39, 1921),
-    FontCharacter(6, 33, 1960),
-    FontCharacter(4, 22, 1993),
-    FontCharacter(4, 22, 2015),
-    FontCharacter(4, 22, 2037),
-    FontCharacter(6, 33, 2059),
-    FontCharacter(5, 28, 2092),
-    FontCharacter(7, 39, 2120),
-    FontCharacter(6, 33, 2159),
-    FontCharacter(7, 39, 2192),
-    FontCharacter(5, 28, 2231),
-    FontCharacter(7, 39, 2259),
-    FontCharacter(6, 33, 2298),
-    FontCharacter(5, 28, 2331),
-    FontCharacter(6, 33, 2359),
-    FontCharacter(7, 39, 2392),
-    FontCharacter(3, 17, 2431),
-    FontCharacter(4, 22, 2448),
-    FontCharacter(6, 33, 2470),
-    FontCharacter(3, 17, 2503),
-    FontCharacter(11, 61, 2520),
-    FontCharacter(7, 39, 2581),
-    FontCharacter(7, 39, 2620),
-    FontCharacter(7, 39, 2659),
-    FontCharacter(7, 39, 2698),
-    FontCharacter(5, 28, 2737),
-    FontCharacter(5, 28, 2765),
-    FontCharacter(4, 22, 2793),
-    FontCharacter(7, 39, 2815),
-    FontCharacter(6, 33, 2854),
-    FontCharacter(9, 50, 2887),
-    FontCharacter(6, 33, 2937),
-    FontCharacter(6, 33, 2970),
-    FontCharacter(5, 28, 3003),
-    FontCharacter(4, 22, 3031),
-    FontCharacter(6, 33, 3053),
-    FontCharacter(4, 22, 3086),
-    FontCharacter(6, 33, 3108),
-    FontCharacter(7, 39, 3141),
-]
+    return fonts
 
-bitmapOPEN_SANS_REGULAR_11_14PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0xA0,
-    0x0A,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x70,
-    0x08,
-    0x70,
-    0x07,
-    0x60,
-    0x07,
-    0x50,
-    0x05,
-    0x00,
-    0x00,
-    0xB0,
-    0x0A,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x44,
-    0x0F,
-    0xE0,
-    0x33,
-    0x0E,
-    0xD0,
-    0x11,
-    0x0D,
-    0xB0,
-    0x11,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x0C,
-    0xD0,
-    0x01,
-    0x00,
-    0x60,
-    0x08,
-    0xE0,
-    0x00,
-    0x00,
-    0x90,
-    0x05,
-    0xA4,
-    0x00,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x00,
-    0xE0,
-    0x00,
-    0x4A,
-    0x00,
-    0x00,
-    0xC2,
-    0x00,
-    0x1D,
-    0x00,
-    0x00,
-    0xA4,
-    0x00,
-    0x0F,
-    0x00,
-    0xF9,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0F,
-    0x00,
-    0x4B,
-    0x60,
-    0x08,
-    0x00,
-    0x00,
-    0x0E,
-    0x90,
-    0x05,
-    0x00,
-    0x10,
-    0x0D,
-    0xC0,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0xE9,
-    0xFF,
-    0x5C,
-    0x00,
-    0xBA,
-    0xF1,
-    0x30,
-    0x02,
-    0xC0,
-    0x06,
-    0x0F,
-    0x00,
-    0x00,
-    0xE7,
-    0xF7,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0xBF,
-    0x05,
-    0x00,
-    0x00,
-    0xF0,
-    0xD6,
-    0x09,
-    0x00,
-    0x00,
-    0x0F,
-    0xF4,
-    0x00,
-    0x26,
-    0xF0,
-    0xB2,
-    0x0A,
-    0xA0,
-    0xFE,
-    0xDF,
-    0x08,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xDD,
-    0x02,
-    0x00,
-    0x2D,
-    0x00,
-    0xE0,
-    0x50,
-    0x0A,
-    0x60,
-    0x09,
-    0x00,
-    0xC3,
-    0x00,
-    0x0E,
-    0xD0,
-    0x01,
-    0x00,
-    0xB3,
-    0x00,
-    0x0F,
-    0x87,
-    0x00,
-    0x00,
-    0xC2,
-    0x00,
-    0x0E,
-    0x4E,
-    0xDD,
-    0x04,
-    0xE0,
-    0x51,
-    0x7A,
-    0xB8,
-    0x14,
-    0x0E,
-    0x50,
-    0xDD,
-    0xD4,
-    0xE0,
-    0x00,
-    0x2C,
-    0x00,
-    0x00,
-    0x78,
-    0xF0,
-    0x00,
-    0x3B,
-    0x00,
-    0x10,
-    0x0D,
-    0xE0,
-    0x00,
-    0x2C,
-    0x00,
-    0x90,
-    0x06,
-    0xA0,
-    0x14,
-    0x0E,
-    0x00,
-    0xD1,
-    0x00,
-    0x20,
-    0xDD,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xFC,
-    0x4D,
-    0x00,
-    0x00,
-    0x00,
-    0x6E,
-    0x60,
-    0x0E,
-    0x00,
-    0x00,
-    0xF1,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x00,
-    0x4E,
-    0x60,
-    0x0E,
-    0x00,
-    0x00,
-    0x60,
-    0x8E,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0xF4,
-    0x4F,
-    0x00,
-    0x00,
-    0x00,
-    0xE6,
-    0xA5,
-    0x2E,
-    0x10,
-    0x1F,
-    0xF0,
-    0x04,
-    0x80,
-    0x3E,
-    0xB7,
-    0x10,
-    0x1F,
-    0x00,
-    0x70,
-    0xFE,
-    0x02,
-    0xD0,
-    0x2A,
-    0x31,
-    0xE9,
-    0x4F,
-    0x00,
-    0xB2,
-    0xFF,
-    0x8D,
-    0x41,
-    0x6E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x3F,
-    0xF0,
-    0x01,
-    0x0E,
-    0xD0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x4C,
-    0x50,
-    0x0C,
-    0xC0,
-    0x06,
-    0xF1,
-    0x02,
-    0xF4,
-    0x00,
-    0xD5,
-    0x00,
-    0xD7,
-    0x00,
-    0xD6,
-    0x00,
-    0xF4,
-    0x00,
-    0xF1,
-    0x02,
-    0xC0,
-    0x06,
-    0x50,
-    0x0C,
-    0x00,
-    0x4C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0x00,
-    0xC0,
-    0x05,
-    0x60,
-    0x0C,
-    0x20,
-    0x1F,
-    0x00,
-    0x4F,
-    0x00,
-    0x5D,
-    0x00,
-    0x7D,
-    0x00,
-    0x6D,
-    0x00,
-    0x4F,
-    0x20,
-    0x1F,
-    0x60,
-    0x0C,
-    0xC0,
-    0x06,
-    0xC4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x09,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x92,
-    0x84,
-    0x56,
-    0x29,
-    0x93,
-    0xEB,
-    0xBE,
-    0x29,
-    0x00,
-    0xC3,
-    0x2D,
-    0x00,
-    0x00,
-    0x6D,
-    0xC7,
-    0x00,
-    0x10,
-    0x0C,
-    0xB0,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0C,
-    0xE0,
-    0x07,
-    0xF1,
-    0x01,
-    0xB5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xFF,
-    0x5F,
-    0x10,
-    0x11,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0A,
-    0xB0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9A,
-    0x00,
-    0x10,
-    0x3F,
-    0x00,
-    0x70,
-    0x0D,
-    0x00,
-    0xD0,
-    0x06,
-    0x00,
-    0xF4,
-    0x00,
-    0x00,
-    0xAA,
-    0x00,
-    0x10,
-    0x3F,
-    0x00,
-    0x60,
-    0x0D,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0xAA,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xFD,
-    0x5D,
-    0x00,
-    0x50,
-    0x3E,
-    0x40,
-    0x4E,
-    0x00,
-    0x6C,
-    0x00,
-    0x60,
-    0x0C,
-    0xF0,
-    0x02,
-    0x00,
-    0xF2,
-    0x20,
-    0x0F,
-    0x00,
-    0x00,
-    0x2F,
-    0xF3,
-    0x00,
-    0x00,
-    0xF0,
-    0x23,
-    0x0F,
-    0x00,
-    0x00,
-    0x2F,
-    0xF0,
-    0x02,
-    0x00,
-    0xF2,
-    0x00,
-    0x6C,
-    0x00,
-    0x60,
-    0x0C,
-    0x40,
-    0x3E,
-    0x40,
-    0x5E,
-    0x00,
-    0x50,
-    0xFD,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE4,
-    0x07,
-    0x00,
-    0x00,
-    0xD9,
-    0x7D,
-    0x00,
-    0x00,
-    0xA3,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA2,
-    0xFE,
-    0x5D,
-    0x00,
-    0xC0,
-    0x27,
-    0x40,
-    0x4E,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x04,
-    0x00,
-    0x00,
-    0xA0,
-    0x09,
-    0x00,
-    0x00,
-    0xA0,
-    0x0B,
-    0x00,
-    0x00,
-    0xA0,
-    0x0B,
-    0x00,
-    0x00,
-    0xA0,
-    0x0A,
-    0x00,
-    0x00,
-    0xB0,
-    0x1B,
-    0x11,
-    0x11,
-    0x30,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB4,
-    0xFE,
-    0x7D,
-    0x00,
-    0xB0,
-    0x16,
-    0x40,
-    0x6E,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x9A,
-    0x00,
-    0x00,
-    0x10,
-    0xE7,
-    0x02,
-    0x00,
-    0xF9,
-    0xDF,
-    0x04,
-    0x00,
-    0x00,
-    0x10,
-    0xD4,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0xF4,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0x62,
-    0x02,
-    0x40,
-    0x9D,
-    0x10,
-    0xEB,
-    0xFF,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0x00,
-    0x00,
-    0xC7,
-    0x0F,
-    0x00,
-    0x00,
-    0xD3,
-    0xF3,
-    0x00,
-    0x00,
-    0xD0,
-    0x33,
-    0x0F,
-    0x00,
-    0xB0,
-    0x07,
-    0xF3,
-    0x00,
-    0x70,
-    0x0A,
-    0x30,
-    0x0F,
-    0x30,
-    0x0D,
-    0x00,
-    0xF3,
-    0x00,
-    0xF9,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0B,
-    0x11,
-    0x11,
-    0xF5,
-    0x11,
-    0x00,
-    0x00,
-    0x30,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF4,
-    0xFF,
-    0xFF,
-    0x03,
-    0x60,
-    0x1B,
-    0x11,
-    0x01,
-    0x00,
-    0x97,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xE9,
-    0xFF,
-    0x7D,
-    0x00,
-    0x00,
-    0x02,
-    0x40,
-    0x9E,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x00,
-    0x50,
-    0x0E,
-    0x70,
-    0x03,
-    0x50,
-    0x6E,
-    0x00,
-    0xE9,
-    0xFF,
-    0x5C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC7,
-    0xFF,
-    0x04,
-    0x00,
-    0xBB,
-    0x03,
-    0x00,
-    0x00,
-    0xD5,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x5F,
-    0xFB,
-    0xAF,
-    0x01,
-    0xF0,
-    0x3C,
-    0x00,
-    0xCA,
-    0x10,
-    0x4F,
-    0x00,
-    0x00,
-    0x2F,
-    0xF0,
-    0x02,
-    0x00,
-    0xF0,
-    0x03,
-    0x7B,
-    0x00,
-    0x20,
-    0x0F,
-    0x30,
-    0x5E,
-    0x20,
-    0xAB,
-    0x00,
-    0x40,
-    0xFC,
-    0x9E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x3F,
-    0x10,
-    0x11,
-    0x11,
-    0xE5,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x20,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x9A,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x01,
-    0x00,
-    0x00,
-    0xA0,
-    0x0A,
-    0x00,
-    0x00,
-    0x10,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0xB9,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x04,
-    0x00,
-    0x00,
-    0x80,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xFE,
-    0x8E,
-    0x00,
-    0x80,
-    0x2D,
-    0x20,
-    0x8D,
-    0x00,
-    0x6C,
-    0x00,
-    0x60,
-    0x0C,
-    0xA0,
-    0x08,
-    0x00,
-    0xA8,
-    0x00,
-    0xE2,
-    0x18,
-    0xD7,
-    0x01,
-    0x00,
-    0xF4,
-    0xEF,
-    0x02,
-    0x00,
-    0xD6,
-    0x25,
-    0xE8,
-    0x05,
-    0xF0,
-    0x02,
-    0x00,
-    0xF4,
-    0x20,
-    0x0F,
-    0x00,
-    0x00,
-    0x1F,
-    0xD0,
-    0x19,
-    0x10,
-    0xC9,
-    0x00,
-    0xA1,
-    0xFE,
-    0x9E,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0xFE,
-    0x4C,
-    0x00,
-    0x90,
-    0x2C,
-    0x40,
-    0x4E,
-    0x00,
-    0x3F,
-    0x00,
-    0x50,
-    0x0C,
-    0xF1,
-    0x00,
-    0x00,
-    0xF1,
-    0x10,
-    0x1F,
-    0x00,
-    0x20,
-    0x1F,
-    0xB0,
-    0x0A,
-    0x20,
-    0xFC,
-    0x01,
-    0xA1,
-    0xFE,
-    0x4B,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x06,
-    0x00,
-    0x00,
-    0xB2,
-    0x0B,
-    0x00,
-    0xF4,
-    0xCF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0xB0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0A,
-    0xB0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0A,
-    0xB0,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x08,
-    0xF0,
-    0x04,
-    0xE2,
-    0x00,
-    0x86,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x3A,
-    0x00,
-    0x00,
-    0xC4,
-    0x5C,
-    0x00,
-    0x60,
-    0x9C,
-    0x02,
-    0x00,
-    0xE2,
-    0x1B,
-    0x00,
-    0x00,
-    0x00,
-    0xB4,
-    0x7D,
-    0x01,
-    0x00,
-    0x00,
-    0x10,
-    0xD8,
-    0x4A,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x3B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x3A,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xBC,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0xA3,
-    0x6D,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xEB,
-    0x02,
-    0x00,
-    0x71,
-    0xBD,
-    0x04,
-    0x40,
-    0xDA,
-    0x18,
-    0x00,
-    0x30,
-    0x4B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0xEF,
-    0x09,
-    0x45,
-    0x31,
-    0x6D,
-    0x00,
-    0x00,
-    0x98,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x60,
-    0x1E,
-    0x00,
-    0xE5,
-    0x02,
-    0x00,
-    0x3D,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0x3F,
-    0x00,
-    0x30,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x81,
-    0xFC,
-    0xCF,
-    0x06,
-    0x00,
-    0x00,
-    0xD3,
-    0x17,
-    0x00,
-    0xA2,
-    0x0B,
-    0x00,
-    0xD1,
-    0x03,
-    0x00,
-    0x00,
-    0xA0,
-    0x07,
-    0x80,
-    0x07,
-    0xB1,
-    0xEE,
-    0x0C,
-    0xD2,
-    0x00,
-    0x1E,
-    0xC0,
-    0x07,
-    0xE1,
-    0x00,
-    0x1E,
-    0xE1,
-    0x10,
-    0x0E,
-    0x30,
-    0x0D,
-    0xD0,
-    0x11,
-    0x0D,
-    0xD3,
-    0x00,
-    0xD4,
-    0x00,
-    0x0E,
-    0xE0,
-    0x00,
-    0x2F,
-    0x90,
-    0x0D,
-    0xA5,
-    0x00,
-    0x2D,
-    0x50,
-    0xDE,
-    0x76,
-    0xCE,
-    0x01,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x3B,
-    0x00,
-    0x40,
-    0x02,
-    0x00,
-    0x00,
-    0x60,
-    0xFC,
-    0xEF,
-    0x2A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xCB,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xEE,
-    0x02,
-    0x00,
-    0x00,
-    0x80,
-    0x89,
-    0x08,
-    0x00,
-    0x00,
-    0xE0,
-    0x22,
-    0x0E,
-    0x00,
-    0x00,
-    0xC5,
-    0x00,
-    0x5B,
-    0x00,
-    0x00,
-    0x5C,
-    0x00,
-    0xC5,
-    0x00,
-    0x20,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x02,
-    0x80,
-    0x18,
-    0x11,
-    0x91,
-    0x09,
-    0xE0,
-    0x02,
-    0x00,
-    0x30,
-    0x0E,
-    0xC6,
-    0x00,
-    0x00,
-    0x00,
-    0x6D,
-    0x6C,
-    0x00,
-    0x00,
-    0x00,
-    0xC7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0x7C,
-    0x00,
-    0x70,
-    0x1C,
-    0x11,
-    0xE5,
-    0x07,
-    0x70,
-    0x0B,
-    0x00,
-    0x80,
-    0x0B,
-    0x70,
-    0x0B,
-    0x00,
-    0x80,
-    0x0A,
-    0x70,
-    0x0B,
-    0x00,
-    0xE3,
-    0x03,
-    0x70,
-    0xFF,
-    0xFF,
-    0x6E,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0xC3,
-    0x09,
-    0x70,
-    0x0B,
-    0x00,
-    0x30,
-    0x1F,
-    0x70,
-    0x0B,
-    0x00,
-    0x30,
-    0x1F,
-    0x70,
-    0x1C,
-    0x11,
-    0xC3,
-    0x0C,
-    0x70,
-    0xFF,
-    0xFF,
-    0x9D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD7,
-    0xFF,
-    0x3C,
-    0x00,
-    0xDB,
-    0x15,
-    0x62,
-    0x02,
-    0xE7,
-    0x01,
-    0x00,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x4F,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0xE8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xCD,
-    0x14,
-    0x52,
-    0x00,
-    0x00,
-    0xE9,
-    0xEF,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0xFF,
-    0xCF,
-    0x06,
-    0x00,
-    0x70,
-    0x1C,
-    0x21,
-    0xD6,
-    0x0B,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0xE1,
-    0x06,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0xD8,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0xB7,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0xC8,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0xF2,
-    0x06,
-    0x70,
-    0x1C,
-    0x21,
-    0xE7,
-    0x0A,
-    0x00,
-    0xF7,
-    0xFF,
-    0xBE,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x90,
-    0x1A,
-    0x11,
-    0x01,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0xFF,
-    0x0D,
-    0x90,
-    0x1A,
-    0x11,
-    0x01,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x1A,
-    0x11,
-    0x01,
-    0x90,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x70,
-    0x1C,
-    0x11,
-    0x11,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x70,
-    0x1C,
-    0x11,
-    0x01,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB4,
-    0xFE,
-    0xCE,
-    0x05,
-    0x00,
-    0xE8,
-    0x27,
-    0x21,
-    0x46,
-    0x00,
-    0xF5,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x4F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x03,
-    0x00,
-    0xFB,
-    0xDF,
-    0x00,
-    0x4F,
-    0x00,
-    0x10,
-    0x61,
-    0x0D,
-    0xC0,
-    0x08,
-    0x00,
-    0x00,
-    0xD5,
-    0x00,
-    0xE6,
-    0x02,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0xEB,
-    0x26,
-    0x21,
-    0xD8,
-    0x00,
-    0x00,
-    0xC6,
-    0xFF,
-    0xCE,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x70,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x00,
-    0xC7,
-    0x11,
-    0x11,
-    0xC1,
-    0x07,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x99,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x99,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x99,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x99,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x99,
-    0x00,
-    0x90,
-    0x09,
-    0x31,
-    0x5E,
-    0xF1,
-    0x8E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB9,
-    0x00,
-    0x10,
-    0x6E,
-    0x90,
-    0x0B,
-    0x00,
-    0x7D,
-    0x00,
-    0xB9,
-    0x00,
-    0x9B,
-    0x00,
-    0x90,
-    0x0B,
-    0xB9,
-    0x00,
-    0x00,
-    0xB9,
-    0xD7,
-    0x00,
-    0x00,
-    0x90,
-    0xEE,
-    0x2F,
-    0x00,
-    0x00,
-    0xD9,
-    0xA1,
-    0x0C,
-    0x00,
-    0x90,
-    0x0B,
-    0xD0,
-    0x08,
-    0x00,
-    0xB9,
-    0x00,
-    0xF3,
-    0x03,
-    0x90,
-    0x0B,
-    0x00,
-    0xD7,
-    0x00,
-    0xB9,
-    0x00,
-    0x00,
-    0xAC,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x70,
-    0x1C,
-    0x11,
-    0x01,
-    0x70,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x07,
-    0x70,
-    0xED,
-    0x00,
-    0x00,
-    0x00,
-    0xDE,
-    0x07,
-    0x70,
-    0xD9,
-    0x05,
-    0x00,
-    0x50,
-    0xBC,
-    0x07,
-    0x70,
-    0x79,
-    0x0C,
-    0x00,
-    0xC0,
-    0xB6,
-    0x07,
-    0x70,
-    0x19,
-    0x2F,
-    0x00,
-    0xF2,
-    0xB0,
-    0x07,
-    0x70,
-    0x09,
-    0x8B,
-    0x00,
-    0x98,
-    0xB0,
-    0x07,
-    0x70,
-    0x09,
-    0xE4,
-    0x00,
-    0x3E,
-    0xB0,
-    0x07,
-    0x70,
-    0x09,
-    0xE0,
-    0x55,
-    0x0D,
-    0xB0,
-    0x07,
-    0x70,
-    0x09,
-    0x80,
-    0xBB,
-    0x06,
-    0xB0,
-    0x07,
-    0x70,
-    0x09,
-    0x20,
-    0xFF,
-    0x00,
-    0xB0,
-    0x07,
-    0x70,
-    0x09,
-    0x00,
-    0xAC,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x02,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0xBF,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x89,
-    0x5E,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0x68,
-    0x0E,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0xC0,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0xF3,
-    0x02,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0xC9,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0x6E,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x50,
-    0x8E,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0xB0,
-    0x9F,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0xF2,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFC,
-    0xCF,
-    0x06,
-    0x00,
-    0x00,
-    0xDB,
-    0x15,
-    0x51,
-    0xBD,
-    0x00,
-    0x60,
-    0x1E,
-    0x00,
-    0x00,
-    0xE1,
-    0x06,
-    0xC0,
-    0x08,
-    0x00,
-    0x00,
-    0x70,
-    0x0C,
-    0xF0,
-    0x04,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0xF0,
-    0x03,
-    0x00,
-    0x00,
-    0x30,
-    0x0F,
-    0xF0,
-    0x04,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0xC0,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x0C,
-    0x60,
-    0x1E,
-    0x00,
-    0x00,
-    0xE1,
-    0x06,
-    0x00,
-    0xDB,
-    0x15,
-    0x51,
-    0xBD,
-    0x00,
-    0x00,
-    0x70,
-    0xFC,
-    0xCF,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0xFF,
-    0x9D,
-    0x00,
-    0x70,
-    0x1C,
-    0x41,
-    0xCD,
-    0x00,
-    0xB7,
-    0x00,
-    0x30,
-    0x1F,
-    0x70,
-    0x0B,
-    0x00,
-    0xF1,
-    0x03,
-    0xB7,
-    0x00,
-    0x30,
-    0x1F,
-    0x70,
-    0x0B,
-    0x30,
-    0x9D,
-    0x00,
-    0xF7,
-    0xFF,
-    0x7E,
-    0x00,
-    0x70,
-    0x1C,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFC,
-    0xCF,
-    0x06,
-    0x00,
-    0x00,
-    0xDB,
-    0x15,
-    0x51,
-    0xBD,
-    0x00,
-    0x60,
-    0x1E,
-    0x00,
-    0x00,
-    0xE1,
-    0x06,
-    0xC0,
-    0x08,
-    0x00,
-    0x00,
-    0x70,
-    0x0C,
-    0xF0,
-    0x04,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0xF0,
-    0x03,
-    0x00,
-    0x00,
-    0x30,
-    0x0F,
-    0xF0,
-    0x04,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0xC0,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x0C,
-    0x60,
-    0x1E,
-    0x00,
-    0x00,
-    0xE1,
-    0x06,
-    0x00,
-    0xDB,
-    0x15,
-    0x51,
-    0xBD,
-    0x00,
-    0x00,
-    0x70,
-    0xFC,
-    0xFF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE2,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xBD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0x9E,
-    0x00,
-    0x90,
-    0x1A,
-    0x31,
-    0xAD,
-    0x00,
-    0x99,
-    0x00,
-    0x50,
-    0x0F,
-    0x90,
-    0x09,
-    0x00,
-    0xE5,
-    0x00,
-    0x99,
-    0x00,
-    0xC2,
-    0x08,
-    0x90,
-    0xFF,
-    0xFF,
-    0x06,
-    0x00,
-    0xA9,
-    0x21,
-    0x5E,
-    0x00,
-    0x90,
-    0x09,
-    0x70,
-    0x0D,
-    0x00,
-    0x99,
-    0x00,
-    0xE0,
-    0x06,
-    0x90,
-    0x09,
-    0x00,
-    0xE7,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x7E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xEA,
-    0xDF,
-    0x09,
-    0xC0,
-    0x2B,
-    0x41,
-    0x06,
-    0xF1,
-    0x02,
-    0x00,
-    0x00,
-    0xF0,
-    0x04,
-    0x00,
-    0x00,
-    0x80,
-    0x6E,
-    0x00,
-    0x00,
-    0x00,
-    0xD5,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0xC3,
-    0x0D,
-    0x00,
-    0x00,
-    0x10,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x3F,
-    0x62,
-    0x12,
-    0xA2,
-    0x0D,
-    0xC1,
-    0xFE,
-    0xAE,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFD,
-    0xFF,
-    0xFF,
-    0xDF,
-    0x11,
-    0xA1,
-    0x1A,
-    0x11,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0xD5,
-    0x00,
-    0x00,
-    0xD0,
-    0x05,
-    0x00,
-    0xAD,
-    0x13,
-    0xA3,
-    0x0D,
-    0x00,
-    0x10,
-    0xE9,
-    0xEF,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x07,
-    0x00,
-    0x00,
-    0xC7,
-    0xD7,
-    0x00,
-    0x00,
-    0xD0,
-    0x17,
-    0x2F,
-    0x00,
-    0x30,
-    0x1F,
-    0xB0,
-    0x08,
-    0x00,
-    0xB8,
-    0x00,
-    0xD6,
-    0x00,
-    0xD0,
-    0x06,
-    0x00,
-    0x3F,
-    0x30,
-    0x0F,
-    0x00,
-    0xB0,
-    0x09,
-    0xA9,
-    0x00,
-    0x00,
-    0xE5,
-    0xE0,
-    0x05,
-    0x00,
-    0x00,
-    0x7F,
-    0x0E,
-    0x00,
-    0x00,
-    0x90,
-    0x9E,
-    0x00,
-    0x00,
-    0x00,
-    0xF4,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xAA,
-    0x00,
-    0x00,
-    0xBD,
-    0x00,
-    0x00,
-    0xAA,
-    0xE6,
-    0x00,
-    0x20,
-    0xFE,
-    0x00,
-    0x00,
-    0x6E,
-    0xF1,
-    0x02,
-    0x60,
-    0xCB,
-    0x05,
-    0x20,
-    0x1F,
-    0xD0,
-    0x06,
-    0xB0,
-    0x87,
-    0x0A,
-    0x60,
-    0x0D,
-    0x90,
-    0x0A,
-    0xF0,
-    0x32,
-    0x0E,
-    0xA0,
-    0x09,
-    0x50,
-    0x0E,
-    0xD4,
-    0x00,
-    0x3E,
-    0xE0,
-    0x05,
-    0x10,
-    0x2F,
-    0x99,
-    0x00,
-    0x8A,
-    0xF2,
-    0x01,
-    0x00,
-    0x6D,
-    0x4D,
-    0x00,
-    0xD5,
-    0xC6,
-    0x00,
-    0x00,
-    0xA8,
-    0x0F,
-    0x00,
-    0xF0,
-    0x8A,
-    0x00,
-    0x00,
-    0xF4,
-    0x0B,
-    0x00,
-    0xB0,
-    0x4F,
-    0x00,
-    0x00,
-    0xF0,
-    0x07,
-    0x00,
-    0x70,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x1E,
-    0x00,
-    0x10,
-    0x4E,
-    0xA0,
-    0x0A,
-    0x00,
-    0xAA,
-    0x00,
-    0xE1,
-    0x04,
-    0xE4,
-    0x00,
-    0x00,
-    0xD5,
-    0xD1,
-    0x04,
-    0x00,
-    0x00,
-    0xEB,
-    0x0A,
-    0x00,
-    0x00,
-    0x60,
-    0x6F,
-    0x00,
-    0x00,
-    0x10,
-    0x8E,
-    0x1E,
-    0x00,
-    0x00,
-    0x9A,
-    0xA0,
-    0x0A,
-    0x00,
-    0xE4,
-    0x00,
-    0xE1,
-    0x04,
-    0xE0,
-    0x05,
-    0x00,
-    0xE6,
-    0x90,
-    0x0B,
-    0x00,
-    0x00,
-    0x9C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x8B,
-    0x00,
-    0x00,
-    0xB7,
-    0xF3,
-    0x01,
-    0x00,
-    0x3E,
-    0xB0,
-    0x07,
-    0x70,
-    0x0B,
-    0x30,
-    0x0E,
-    0xE0,
-    0x03,
-    0x00,
-    0x7B,
-    0xB7,
-    0x00,
-    0x00,
-    0xE3,
-    0x3E,
-    0x00,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x3F,
-    0x10,
-    0x11,
-    0x11,
-    0xDA,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x02,
-    0x00,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0x00,
-    0x90,
-    0x0C,
-    0x00,
-    0x00,
-    0x40,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0x6E,
-    0x00,
-    0x00,
-    0x00,
-    0xBA,
-    0x00,
-    0x00,
-    0x00,
-    0xE5,
-    0x01,
-    0x00,
-    0x00,
-    0xE1,
-    0x17,
-    0x11,
-    0x11,
-    0x50,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x9F,
-    0xB0,
-    0x07,
-    0x00,
-    0x7B,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x7B,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x7B,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x7B,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x7B,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0xFB,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA9,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0xC0,
-    0x07,
-    0x00,
-    0x60,
-    0x0D,
-    0x00,
-    0x00,
-    0x4F,
-    0x00,
-    0x00,
-    0xAA,
-    0x00,
-    0x00,
-    0xF3,
-    0x00,
-    0x00,
-    0xD0,
-    0x06,
-    0x00,
-    0x70,
-    0x0D,
-    0x00,
-    0x10,
-    0x3F,
-    0x00,
-    0x00,
-    0xAA,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0x0B,
-    0x00,
-    0xB7,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0xB7,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0xB7,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0xB7,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0xB7,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0xB7,
-    0x90,
-    0xFF,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x06,
-    0x00,
-    0x00,
-    0xD2,
-    0x0D,
-    0x00,
-    0x00,
-    0x59,
-    0x69,
-    0x00,
-    0x10,
-    0x0D,
-    0xD1,
-    0x00,
-    0x80,
-    0x07,
-    0x90,
-    0x05,
-    0xE0,
-    0x01,
-    0x20,
-    0x0D,
-    0xA6,
-    0x00,
-    0x00,
-    0x5A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDA,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xEB,
-    0xBF,
-    0x01,
-    0x10,
-    0x04,
-    0xA0,
-    0x0A,
-    0x00,
-    0x00,
-    0x50,
-    0x0D,
-    0x20,
-    0xDA,
-    0xED,
-    0x0D,
-    0xE1,
-    0x07,
-    0x50,
-    0x0D,
-    0xF5,
-    0x00,
-    0x70,
-    0x0D,
-    0xF2,
-    0x04,
-    0xE4,
-    0x0D,
-    0x70,
-    0xFE,
-    0x4B,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xA8,
-    0xEF,
-    0x09,
-    0x00,
-    0xEB,
-    0x04,
-    0xC2,
-    0x09,
-    0xB0,
-    0x09,
-    0x00,
-    0xF3,
-    0x00,
-    0x7B,
-    0x00,
-    0x10,
-    0x1F,
-    0xB0,
-    0x07,
-    0x00,
-    0xF1,
-    0x01,
-    0xAB,
-    0x00,
-    0x40,
-    0x0F,
-    0xB0,
-    0x4F,
-    0x20,
-    0x9C,
-    0x00,
-    0x5B,
-    0xFA,
-    0x9E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE7,
-    0xDF,
-    0x04,
-    0xD8,
-    0x13,
-    0x13,
-    0xE0,
-    0x05,
-    0x00,
-    0x10,
-    0x1F,
-    0x00,
-    0x00,
-    0xF1,
-    0x01,
-    0x00,
-    0x00,
-    0x5F,
-    0x00,
-    0x00,
-    0x80,
-    0x3D,
-    0x21,
-    0x02,
-    0x80,
-    0xFE,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0xE9,
-    0xAF,
-    0xB8,
-    0x00,
-    0xD9,
-    0x02,
-    0xF4,
-    0x0B,
-    0xF0,
-    0x04,
-    0x00,
-    0xBA,
-    0x10,
-    0x1F,
-    0x00,
-    0x70,
-    0x0B,
-    0xF1,
-    0x01,
-    0x00,
-    0xB7,
-    0x00,
-    0x4F,
-    0x00,
-    0x90,
-    0x0B,
-    0x90,
-    0x2C,
-    0x40,
-    0xBE,
-    0x00,
-    0x90,
-    0xFE,
-    0x6A,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE8,
-    0xBF,
-    0x01,
-    0x80,
-    0x1B,
-    0x90,
-    0x0C,
-    0xF0,
-    0x02,
-    0x10,
-    0x2F,
-    0xF2,
-    0xFF,
-    0xFF,
-    0x3F,
-    0xF2,
-    0x01,
-    0x00,
-    0x00,
-    0xF0,
-    0x05,
-    0x00,
-    0x00,
-    0x80,
-    0x3E,
-    0x21,
-    0x05,
-    0x00,
-    0xE8,
-    0xEF,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE5,
-    0x7F,
-    0x00,
-    0x3F,
-    0x00,
-    0x40,
-    0x0E,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0xE7,
-    0xFF,
-    0x0D,
-    0x50,
-    0x0D,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xEC,
-    0xFE,
-    0x7E,
-    0xD0,
-    0x06,
-    0xB0,
-    0x07,
-    0xF1,
-    0x01,
-    0x70,
-    0x0B,
-    0xE0,
-    0x05,
-    0xB0,
-    0x07,
-    0x30,
-    0xDF,
-    0x9D,
-    0x00,
-    0x60,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x07,
-    0x00,
-    0x00,
-    0x50,
-    0xFF,
-    0xFF,
-    0x0A,
-    0xD4,
-    0x12,
-    0x21,
-    0x6D,
-    0x7B,
-    0x00,
-    0x00,
-    0x7A,
-    0xB8,
-    0x00,
-    0x40,
-    0x3E,
-    0x90,
-    0xFE,
-    0xBE,
-    0x03,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xA8,
-    0xFF,
-    0x1A,
-    0x00,
-    0xEB,
-    0x04,
-    0xC1,
-    0x09,
-    0xB0,
-    0x09,
-    0x00,
-    0xB6,
-    0x00,
-    0x7B,
-    0x00,
-    0x50,
-    0x0D,
-    0xB0,
-    0x07,
-    0x00,
-    0xD5,
-    0x00,
-    0x7B,
-    0x00,
-    0x50,
-    0x0D,
-    0xB0,
-    0x07,
-    0x00,
-    0xD5,
-    0x00,
-    0x7B,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x04,
-    0xA0,
-    0x08,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x45,
-    0x00,
-    0x8A,
-    0x00,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x99,
-    0x00,
-    0x89,
-    0x00,
-    0x6D,
-    0xFA,
-    0x0B,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x50,
-    0x2E,
-    0xB0,
-    0x07,
-    0xE6,
-    0x03,
-    0xB0,
-    0x67,
-    0x3E,
-    0x00,
-    0xB0,
-    0xFC,
-    0x07,
-    0x00,
-    0xB0,
-    0x4C,
-    0x2E,
-    0x00,
-    0xB0,
-    0x07,
-    0xD7,
-    0x00,
-    0xB0,
-    0x07,
-    0xB0,
-    0x0A,
-    0xB0,
-    0x07,
-    0x10,
-    0x7E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xB7,
-    0xFF,
-    0x2A,
-    0xFA,
-    0xAF,
-    0x00,
-    0xB0,
-    0x4F,
-    0x20,
-    0xFE,
-    0x06,
-    0xC1,
-    0x08,
-    0xB0,
-    0x0A,
-    0x00,
-    0xC9,
-    0x00,
-    0x70,
-    0x0B,
-    0xB0,
-    0x07,
-    0x00,
-    0x99,
-    0x00,
-    0x70,
-    0x0B,
-    0xB0,
-    0x07,
-    0x00,
-    0x99,
-    0x00,
-    0x70,
-    0x0B,
-    0xB0,
-    0x07,
-    0x00,
-    0x99,
-    0x00,
-    0x70,
-    0x0B,
-    0xB0,
-    0x07,
-    0x00,
-    0x99,
-    0x00,
-    0x70,
-    0x0B,
-    0xB0,
-    0x07,
-    0x00,
-    0x99,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xA5,
-    0xFF,
-    0x1A,
-    0x00,
-    0xEB,
-    0x04,
-    0xC1,
-    0x09,
-    0xB0,
-    0x09,
-    0x00,
-    0xB6,
-    0x00,
-    0x7B,
-    0x00,
-    0x50,
-    0x0D,
-    0xB0,
-    0x07,
-    0x00,
-    0xD5,
-    0x00,
-    0x7B,
-    0x00,
-    0x50,
-    0x0D,
-    0xB0,
-    0x07,
-    0x00,
-    0xD5,
-    0x00,
-    0x7B,
-    0x00,
-    0x50,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD7,
-    0xDF,
-    0x07,
-    0x00,
-    0xD7,
-    0x03,
-    0xD3,
-    0x07,
-    0xE0,
-    0x05,
-    0x00,
-    0xE5,
-    0x10,
-    0x1F,
-    0x00,
-    0x10,
-    0x1F,
-    0xF1,
-    0x01,
-    0x00,
-    0xF1,
-    0x01,
-    0x5E,
-    0x00,
-    0x50,
-    0x0E,
-    0x70,
-    0x3D,
-    0x30,
-    0x7D,
-    0x00,
-    0x60,
-    0xFD,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0xA6,
-    0xEF,
-    0x09,
-    0x00,
-    0xEB,
-    0x04,
-    0xD2,
-    0x09,
-    0xB0,
-    0x09,
-    0x00,
-    0xF4,
-    0x00,
-    0x7B,
-    0x00,
-    0x10,
-    0x1F,
-    0xB0,
-    0x07,
-    0x00,
-    0xF1,
-    0x01,
-    0xAB,
-    0x00,
-    0x40,
-    0x0F,
-    0xB0,
-    0x4F,
-    0x20,
-    0x9D,
-    0x00,
-    0x8B,
-    0xFA,
-    0x9E,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE9,
-    0xAF,
-    0xB6,
-    0x00,
-    0xD9,
-    0x02,
-    0xE5,
-    0x0B,
-    0xF0,
-    0x04,
-    0x00,
-    0xBA,
-    0x10,
-    0x1F,
-    0x00,
-    0x70,
-    0x0B,
-    0xF1,
-    0x01,
-    0x00,
-    0xB7,
-    0x00,
-    0x4F,
-    0x00,
-    0xA0,
-    0x0B,
-    0x90,
-    0x2C,
-    0x40,
-    0xBE,
-    0x00,
-    0x90,
-    0xFE,
-    0x8A,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xB7,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x84,
-    0xAF,
-    0xB0,
-    0x9C,
-    0x12,
-    0xB0,
-    0x0B,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xFD,
-    0xAE,
-    0x10,
-    0x3F,
-    0x10,
-    0x04,
-    0xF2,
-    0x02,
-    0x00,
-    0x00,
-    0xF7,
-    0x4A,
-    0x00,
-    0x00,
-    0x60,
-    0xBD,
-    0x00,
-    0x00,
-    0x00,
-    0x4E,
-    0x00,
-    0x00,
-    0xF3,
-    0x22,
-    0xFD,
-    0xDF,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x07,
-    0x00,
-    0x79,
-    0x00,
-    0xFA,
-    0xFF,
-    0x09,
-    0x7B,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x7B,
-    0x00,
-    0xB0,
-    0x07,
-    0x00,
-    0x7B,
-    0x00,
-    0x80,
-    0x0C,
-    0x00,
-    0xC1,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x05,
-    0x00,
-    0xB7,
-    0x00,
-    0x5D,
-    0x00,
-    0x70,
-    0x0B,
-    0xD0,
-    0x05,
-    0x00,
-    0xB7,
-    0x00,
-    0x5D,
-    0x00,
-    0x70,
-    0x0B,
-    0xD0,
-    0x05,
-    0x00,
-    0xB7,
-    0x00,
-    0x6C,
-    0x00,
-    0xA0,
-    0x0B,
-    0x90,
-    0x1C,
-    0x40,
-    0xBE,
-    0x00,
-    0xA1,
-    0xFF,
-    0x5A,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x8C,
-    0x00,
-    0x00,
-    0xC8,
-    0xE6,
-    0x00,
-    0x00,
-    0x6E,
-    0xE0,
-    0x05,
-    0x50,
-    0x0E,
-    0x80,
-    0x0B,
-    0xB0,
-    0x08,
-    0x20,
-    0x1F,
-    0xF1,
-    0x02,
-    0x00,
-    0x7C,
-    0xC7,
-    0x00,
-    0x00,
-    0xD5,
-    0x5D,
-    0x00,
-    0x00,
-    0xE0,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9A,
-    0x00,
-    0xC0,
-    0x0D,
-    0x00,
-    0xA9,
-    0xD6,
-    0x00,
-    0xE1,
-    0x2E,
-    0x00,
-    0x5D,
-    0xF1,
-    0x01,
-    0xA7,
-    0x7A,
-    0x10,
-    0x1F,
-    0xD0,
-    0x06,
-    0x5C,
-    0xC5,
-    0x60,
-    0x0C,
-    0x80,
-    0x1A,
-    0x0F,
-    0xF0,
-    0xA1,
-    0x08,
-    0x40,
-    0x7E,
-    0x0A,
-    0xB0,
-    0xE6,
-    0x03,
-    0x00,
-    0xDF,
-    0x05,
-    0x60,
-    0xED,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0x10,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF2,
-    0x03,
-    0x30,
-    0x2F,
-    0x70,
-    0x0D,
-    0xD0,
-    0x06,
-    0x00,
-    0x9B,
-    0xB9,
-    0x00,
-    0x00,
-    0xE1,
-    0x1E,
-    0x00,
-    0x00,
-    0xE2,
-    0x2E,
-    0x00,
-    0x00,
-    0x7C,
-    0xC7,
-    0x00,
-    0x80,
-    0x0B,
-    0xB0,
-    0x09,
-    0xE4,
-    0x01,
-    0x10,
-    0x4E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9C,
-    0x00,
-    0x00,
-    0xC8,
-    0xE6,
-    0x00,
-    0x00,
-    0x6E,
-    0xF0,
-    0x05,
-    0x40,
-    0x0F,
-    0x90,
-    0x0C,
-    0xA0,
-    0x09,
-    0x30,
-    0x2F,
-    0xF0,
-    0x03,
-    0x00,
-    0x8D,
-    0xD6,
-    0x00,
-    0x00,
-    0xD7,
-    0x7B,
-    0x00,
-    0x00,
-    0xF1,
-    0x1F,
-    0x00,
-    0x00,
-    0xD0,
-    0x0A,
-    0x00,
-    0x00,
-    0xF2,
-    0x04,
-    0x00,
-    0x10,
-    0xCC,
-    0x00,
-    0x00,
-    0xFC,
-    0x1B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0xFF,
-    0xFF,
-    0x03,
-    0x00,
-    0x60,
-    0x0D,
-    0x00,
-    0x20,
-    0x3E,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0x00,
-    0xC8,
-    0x00,
-    0x00,
-    0xE3,
-    0x01,
-    0x00,
-    0xD0,
-    0x06,
-    0x00,
-    0x50,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x80,
-    0x7E,
-    0x00,
-    0xD7,
-    0x02,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x20,
-    0x5D,
-    0x00,
-    0xF7,
-    0x07,
-    0x00,
-    0x20,
-    0x5D,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0x99,
-    0x00,
-    0x00,
-    0xD7,
-    0x02,
-    0x00,
-    0x80,
-    0x7E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x70,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE7,
-    0x08,
-    0x00,
-    0x30,
-    0x5E,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x7A,
-    0x00,
-    0x00,
-    0xC6,
-    0x02,
-    0x00,
-    0x80,
-    0x7F,
-    0x00,
-    0xC6,
-    0x02,
-    0x00,
-    0x7A,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x00,
-    0x7B,
-    0x00,
-    0x20,
-    0x5E,
-    0x00,
-    0xE7,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xA0,
-    0xEF,
-    0x28,
-    0x60,
-    0x33,
-    0x06,
-    0x92,
-    0xFE,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBE,
-    0xBB,
-    0xBB,
-    0x0E,
-    0xB0,
-    0x00,
-    0x00,
-    0xB0,
-    0x00,
-    0x0B,
-    0x00,
-    0x00,
-    0x0B,
-    0xB0,
-    0x00,
-    0x00,
-    0xB0,
-    0x00,
-    0x0B,
-    0x00,
-    0x00,
-    0x0B,
-    0xB0,
-    0x00,
-    0x00,
-    0xB0,
-    0x00,
-    0x0B,
-    0x00,
-    0x00,
-    0x0B,
-    0xB0,
-    0x00,
-    0x00,
-    0xB0,
-    0x00,
-    0x0B,
-    0x00,
-    0x00,
-    0x0B,
-    0xB0,
-    0x00,
-    0x00,
-    0xB0,
-    0x00,
-    0xBE,
-    0xBB,
-    0xBB,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_REGULAR_11_14PX = [
-    FontCharacter(4, 32, 0),
-    FontCharacter(4, 32, 32),
-    FontCharacter(6, 48, 64),
-    FontCharacter(10, 80, 112),
-    FontCharacter(9, 72, 192),
-    FontCharacter(12, 96, 264),
-    FontCharacter(11, 88, 360),
-    FontCharacter(3, 24, 448),
-    FontCharacter(4, 32, 472),
-    FontCharacter(4, 32, 504),
-    FontCharacter(8, 64, 536),
-    FontCharacter(9, 72, 600),
-    FontCharacter(4, 32, 672),
-    FontCharacter(5, 40, 704),
-    FontCharacter(4, 32, 744),
-    FontCharacter(6, 48, 776),
-    FontCharacter(9, 72, 824),
-    FontCharacter(9, 72, 896),
-    FontCharacter(9, 72, 968),
-    FontCharacter(9, 72, 1040),
-    FontCharacter(9, 72, 1112),
-    FontCharacter(9, 72, 1184),
-    FontCharacter(9, 72, 1256),
-    FontCharacter(9, 72, 1328),
-    FontCharacter(9, 72, 1400),
-    FontCharacter(9, 72, 1472),
-    FontCharacter(4, 32, 1544),
-    FontCharacter(4, 32, 1576),
-    FontCharacter(9, 72, 1608),
-    FontCharacter(9, 72, 1680),
-    FontCharacter(9, 72, 1752),
-    FontCharacter(6, 48, 1824),
-    FontCharacter(13, 104, 1872),
-    FontCharacter(10, 80, 1976),
-    FontCharacter(10, 80, 2056),
-    FontCharacter(9, 72, 2136),
-    FontCharacter(11, 88, 2208),
-    FontCharacter(8, 64, 2296),
-    FontCharacter(8, 64, 2360),
-    FontCharacter(11, 88, 2424),
-    FontCharacter(11, 88, 2512),
-    FontCharacter(4, 32, 2600),
-    FontCharacter(5, 40, 2632),
-    FontCharacter(9, 72, 2672),
-    FontCharacter(8, 64, 2744),
-    FontCharacter(14, 112, 2808),
-    FontCharacter(11, 88, 2920),
-    FontCharacter(12, 96, 3008),
-    FontCharacter(9, 72, 3104),
-    FontCharacter(12, 96, 3176),
-    FontCharacter(9, 72, 3272),
-    FontCharacter(8, 64, 3344),
-    FontCharacter(8, 64, 3408),
-    FontCharacter(11, 88, 3472),
-    FontCharacter(9, 72, 3560),
-    FontCharacter(14, 112, 3632),
-    FontCharacter(9, 72, 3744),
-    FontCharacter(8, 64, 3816),
-    FontCharacter(9, 72, 3880),
-    FontCharacter(5, 40, 3952),
-    FontCharacter(6, 48, 3992),
-    FontCharacter(5, 40, 4040),
-    FontCharacter(8, 64, 4080),
-    FontCharacter(7, 56, 4144),
-    FontCharacter(9, 72, 4200),
-    FontCharacter(8, 64, 4272),
-    FontCharacter(9, 72, 4336),
-    FontCharacter(7, 56, 4408),
-    FontCharacter(9, 72, 4464),
-    FontCharacter(8, 64, 4536),
-    FontCharacter(6, 48, 4600),
-    FontCharacter(8, 64, 4648),
-    FontCharacter(9, 72, 4712),
-    FontCharacter(4, 32, 4784),
-    FontCharacter(4, 32, 4816),
-    FontCharacter(8, 64, 4848),
-    FontCharacter(4, 32, 4912),
-    FontCharacter(14, 112, 4944),
-    FontCharacter(9, 72, 5056),
-    FontCharacter(9, 72, 5128),
-    FontCharacter(9, 72, 5200),
-    FontCharacter(9, 72, 5272),
-    FontCharacter(6, 48, 5344),
-    FontCharacter(7, 56, 5392),
-    FontCharacter(5, 40, 5448),
-    FontCharacter(9, 72, 5488),
-    FontCharacter(8, 64, 5560),
-    FontCharacter(12, 96, 5624),
-    FontCharacter(8, 64, 5720),
-    FontCharacter(8, 64, 5784),
-    FontCharacter(7, 56, 5848),
-    FontCharacter(6, 48, 5904),
-    FontCharacter(8, 64, 5952),
-    FontCharacter(6, 48, 6016),
-    FontCharacter(9, 72, 6064),
-    FontCharacter(9, 72, 6136),
-]
 
-bitmapSYMBOLS_0 = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x51,
-    0xFE,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x4C,
-    0x00,
-    0x10,
-    0xF7,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xCF,
-    0x00,
-    0x71,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x00,
-    0xF6,
-    0xFF,
-    0xFF,
-    0x8D,
-    0xFF,
-    0xBF,
-    0xFA,
-    0xFF,
-    0xFF,
-    0x50,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x14,
-    0xF7,
-    0x2B,
-    0xE2,
-    0xFF,
-    0xFF,
-    0xF5,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x3C,
-    0x51,
-    0x12,
-    0xF9,
-    0xFF,
-    0xFF,
-    0xFE,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xCF,
-    0x03,
-    0x91,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFE,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xCF,
-    0x03,
-    0x91,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xF5,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x3C,
-    0x51,
-    0x12,
-    0xF9,
-    0xFF,
-    0xFF,
-    0x50,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x14,
-    0xF7,
-    0x2B,
-    0xE2,
-    0xFF,
-    0xFF,
-    0x00,
-    0xF6,
-    0xFF,
-    0xFF,
-    0x8D,
-    0xFF,
-    0xBF,
-    0xFA,
-    0xFF,
-    0xFF,
-    0x00,
-    0x71,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x00,
-    0x10,
-    0xF7,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xCF,
-    0x00,
-    0x00,
-    0x51,
-    0xFE,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x4C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x84,
-    0xCC,
-    0x48,
-    0x00,
-    0x40,
-    0xCC,
-    0xCC,
-    0xCC,
-    0x04,
-    0xC4,
-    0xCC,
-    0xCC,
-    0xCC,
-    0x4C,
-    0xC8,
-    0xCC,
-    0xCC,
-    0xCC,
-    0x8C,
-    0xCC,
-    0xCC,
-    0xCC,
-    0xCC,
-    0xCC,
-    0xCC,
-    0xCC,
-    0xCC,
-    0xCC,
-    0xCC,
-    0xC8,
-    0xCC,
-    0xCC,
-    0xCC,
-    0x8C,
-    0xC4,
-    0xCC,
-    0xCC,
-    0xCC,
-    0x4C,
-    0x40,
-    0xCC,
-    0xCC,
-    0xCC,
-    0x04,
-    0x00,
-    0x84,
-    0xCC,
-    0x48,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x4E,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0x0A,
-    0x00,
-    0x70,
-    0xFF,
-    0x1D,
-    0x00,
-    0x70,
-    0xFF,
-    0x1D,
-    0x00,
-    0x70,
-    0xFF,
-    0x1D,
-    0x00,
-    0x70,
-    0xFF,
-    0x1D,
-    0x00,
-    0x60,
-    0xFF,
-    0x1D,
-    0x00,
-    0x00,
-    0xFB,
-    0x9F,
-    0x00,
-    0x00,
-    0x10,
-    0xFC,
-    0x8F,
-    0x00,
-    0x00,
-    0x10,
-    0xFC,
-    0x8F,
-    0x00,
-    0x00,
-    0x10,
-    0xFC,
-    0x8F,
-    0x00,
-    0x00,
-    0x10,
-    0xFC,
-    0x8F,
-    0x00,
-    0x00,
-    0x10,
-    0xFC,
-    0x6F,
-    0x00,
-    0x00,
-    0x10,
-    0xEC,
-    0x05,
-    0x00,
-    0x00,
-    0x10,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x24,
-    0x00,
-    0x00,
-    0xB3,
-    0x00,
-    0x00,
-    0xE2,
-    0x07,
-    0x00,
-    0xD2,
-    0x5F,
-    0x00,
-    0xC1,
-    0xFF,
-    0xBD,
-    0x66,
-    0x98,
-    0xFF,
-    0x19,
-    0x00,
-    0xF5,
-    0x1A,
-    0x00,
-    0x80,
-    0x1C,
-    0x00,
-    0x00,
-    0x2B,
-    0x00,
-    0x00,
-    0x33,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE6,
-    0x07,
-    0x00,
-    0x90,
-    0x7F,
-    0x00,
-    0x00,
-    0xF8,
-    0x07,
-    0x00,
-    0xA0,
-    0x5F,
-    0x00,
-    0xC1,
-    0x2D,
-    0x10,
-    0xDC,
-    0x03,
-    0xC1,
-    0x3D,
-    0x00,
-    0xB4,
-    0x03,
-    0x00,
-    0x00,
-    0x85,
-    0xCB,
-    0xFF,
-    0xFF,
-    0xBC,
-    0x58,
-    0x00,
-    0x70,
-    0xFE,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xEF,
-    0x07,
-    0xE5,
-    0x9F,
-    0x46,
-    0x01,
-    0x10,
-    0x64,
-    0xF9,
-    0x5E,
-    0xF8,
-    0x29,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x92,
-    0x8F,
-    0xFA,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xBF,
-    0xFD,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xDF,
-    0xFF,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xFF,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFF,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFF,
-    0xFF,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xFF,
-    0xFD,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0xDF,
-    0xFA,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xBF,
-    0xF8,
-    0x29,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x92,
-    0x8F,
-    0xE5,
-    0x9F,
-    0x36,
-    0x01,
-    0x10,
-    0x63,
-    0xF9,
-    0x5E,
-    0x70,
-    0xFE,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xEF,
-    0x07,
-    0x00,
-    0x85,
-    0xDB,
-    0xFF,
-    0xFF,
-    0xBD,
-    0x58,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0F,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0F,
-    0xF0,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0F,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0F,
-    0xF0,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0F,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x0F,
-    0xF0,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersSYMBOLS_0 = [
-    FontCharacter(20, 160, 0),
-    FontCharacter(10, 80, 160),
-    FontCharacter(9, 72, 240),
-    FontCharacter(7, 56, 312),
-    FontCharacter(6, 48, 368),
-    FontCharacter(16, 128, 416),
-    FontCharacter(16, 128, 544),
-]
+def get_fonts() -> list[Font]:
+    global _FONTS
+    if _FONTS is None:
+        _FONTS = load_font_pack(FONT_PACK_PATH)
+    return _FONTS
 
-bitmapOPEN_SANS_SEMIBOLD_11_16PX = [
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x0F,
-    0xD0,
-    0x0F,
-    0xD0,
-    0x0E,
-    0xC0,
-    0x0D,
-    0xB0,
-    0x0D,
-    0xB0,
-    0x0C,
-    0x90,
-    0x0B,
-    0x90,
-    0x0B,
-    0x10,
-    0x01,
-    0xE0,
-    0x0F,
-    0xC0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xBE,
-    0xA0,
-    0x0E,
-    0xD0,
-    0x09,
-    0xD9,
-    0x00,
-    0x8B,
-    0x80,
-    0x0B,
-    0xA0,
-    0x07,
-    0xA7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x40,
-    0x0F,
-    0xF0,
-    0x03,
-    0x00,
-    0x70,
-    0x0C,
-    0xF3,
-    0x00,
-    0x00,
-    0xB0,
-    0x08,
-    0xC6,
-    0x00,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x30,
-    0xF4,
-    0x35,
-    0x8E,
-    0x23,
-    0x00,
-    0xF3,
-    0x00,
-    0x4F,
-    0x00,
-    0x00,
-    0xD6,
-    0x20,
-    0x1F,
-    0x00,
-    0xF9,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x32,
-    0x9D,
-    0xA3,
-    0x3B,
-    0x03,
-    0x00,
-    0x4F,
-    0xC0,
-    0x07,
-    0x00,
-    0x30,
-    0x0F,
-    0xF0,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x10,
-    0xE9,
-    0xFF,
-    0x7C,
-    0x00,
-    0xED,
-    0xF8,
-    0xA7,
-    0x08,
-    0xF0,
-    0x0A,
-    0x0F,
-    0x00,
-    0x00,
-    0xFC,
-    0xFA,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0xEF,
-    0x08,
-    0x00,
-    0x00,
-    0xF0,
-    0xFB,
-    0x0D,
-    0x00,
-    0x00,
-    0x0F,
-    0xF8,
-    0x11,
-    0x8D,
-    0xF5,
-    0xE8,
-    0x0D,
-    0xA0,
-    0xFD,
-    0xDF,
-    0x19,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE6,
-    0x5E,
-    0x00,
-    0x70,
-    0x0D,
-    0x00,
-    0xF1,
-    0x88,
-    0x0F,
-    0x10,
-    0x5E,
-    0x00,
-    0x40,
-    0x1F,
-    0xF1,
-    0x04,
-    0xC9,
-    0x00,
-    0x00,
-    0xF5,
-    0x01,
-    0x5F,
-    0xF1,
-    0x04,
-    0x00,
-    0x40,
-    0x1F,
-    0xF1,
-    0xA4,
-    0x6B,
-    0xEE,
-    0x05,
-    0xF0,
-    0x88,
-    0x4F,
-    0x4F,
-    0x8F,
-    0xF8,
-    0x00,
-    0xE5,
-    0x5E,
-    0xAB,
-    0xF4,
-    0x11,
-    0x4F,
-    0x00,
-    0x00,
-    0xF4,
-    0x51,
-    0x0F,
-    0xF0,
-    0x05,
-    0x00,
-    0xD0,
-    0x08,
-    0xF4,
-    0x11,
-    0x4F,
-    0x00,
-    0x50,
-    0x1E,
-    0x00,
-    0x8F,
-    0xF8,
-    0x00,
-    0x00,
-    0x7E,
-    0x00,
-    0x50,
-    0xEE,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xFD,
-    0x5D,
-    0x00,
-    0x00,
-    0x20,
-    0xCF,
-    0xC5,
-    0x1F,
-    0x00,
-    0x00,
-    0xF5,
-    0x04,
-    0xF5,
-    0x03,
-    0x00,
-    0x10,
-    0x9F,
-    0xC0,
-    0x0E,
-    0x00,
-    0x00,
-    0x80,
-    0xEF,
-    0x4E,
-    0x00,
-    0x00,
-    0x10,
-    0xFB,
-    0x6F,
-    0x00,
-    0x93,
-    0x03,
-    0xFC,
-    0xA5,
-    0x6F,
-    0xA0,
-    0x1F,
-    0xF3,
-    0x09,
-    0xA0,
-    0x8F,
-    0xAF,
-    0x30,
-    0x9F,
-    0x00,
-    0xA0,
-    0xEF,
-    0x01,
-    0xD0,
-    0xAF,
-    0x97,
-    0xFE,
-    0x6F,
-    0x00,
-    0xA1,
-    0xFE,
-    0x8D,
-    0xA1,
-    0x6F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0B,
-    0xC0,
-    0x09,
-    0xB0,
-    0x09,
-    0xA0,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0x2F,
-    0x10,
-    0x7E,
-    0x00,
-    0xF8,
-    0x00,
-    0xE0,
-    0x0A,
-    0x20,
-    0x6F,
-    0x00,
-    0xF4,
-    0x04,
-    0x50,
-    0x3F,
-    0x00,
-    0xF5,
-    0x03,
-    0x20,
-    0x6F,
-    0x00,
-    0xE0,
-    0x0A,
-    0x00,
-    0xF9,
-    0x00,
-    0x10,
-    0x7F,
-    0x00,
-    0x50,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0x5F,
-    0x00,
-    0x70,
-    0x1E,
-    0x00,
-    0xF0,
-    0x08,
-    0x00,
-    0xEA,
-    0x00,
-    0x60,
-    0x2F,
-    0x00,
-    0xF4,
-    0x04,
-    0x30,
-    0x5F,
-    0x00,
-    0xF3,
-    0x05,
-    0x60,
-    0x2F,
-    0x00,
-    0xEA,
-    0x00,
-    0xF0,
-    0x09,
-    0x70,
-    0x1F,
-    0x20,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x0B,
-    0x00,
-    0x00,
-    0xA0,
-    0x09,
-    0x00,
-    0xB4,
-    0xA6,
-    0x69,
-    0x4B,
-    0xB4,
-    0xFD,
-    0xCF,
-    0x3B,
-    0x00,
-    0xE5,
-    0x4F,
-    0x00,
-    0x10,
-    0x8E,
-    0xE8,
-    0x01,
-    0x20,
-    0x1B,
-    0xC1,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0x00,
-    0x30,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0xF3,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x03,
-    0x33,
-    0xF6,
-    0x35,
-    0x03,
-    0x00,
-    0x30,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0E,
-    0xF0,
-    0x09,
-    0xF2,
-    0x04,
-    0xE6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0x7F,
-    0x73,
-    0x77,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x01,
-    0xE0,
-    0x0F,
-    0xC0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xAE,
-    0x00,
-    0x40,
-    0x4F,
-    0x00,
-    0xA0,
-    0x0E,
-    0x00,
-    0xF0,
-    0x08,
-    0x00,
-    0xF6,
-    0x02,
-    0x00,
-    0xCC,
-    0x00,
-    0x20,
-    0x6F,
-    0x00,
-    0x80,
-    0x0F,
-    0x00,
-    0xE0,
-    0x0A,
-    0x00,
-    0xF4,
-    0x04,
-    0x00,
-    0xEA,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFD,
-    0x6D,
-    0x00,
-    0x70,
-    0xBF,
-    0xB7,
-    0x6F,
-    0x00,
-    0xDE,
-    0x00,
-    0xD0,
-    0x0D,
-    0xF2,
-    0x08,
-    0x00,
-    0xF8,
-    0x32,
-    0x7F,
-    0x00,
-    0x60,
-    0x3F,
-    0xF5,
-    0x05,
-    0x00,
-    0xF5,
-    0x35,
-    0x7F,
-    0x00,
-    0x60,
-    0x4F,
-    0xF2,
-    0x08,
-    0x00,
-    0xF8,
-    0x02,
-    0xDD,
-    0x00,
-    0xD0,
-    0x0E,
-    0x60,
-    0xBF,
-    0xB7,
-    0x7F,
-    0x00,
-    0x60,
-    0xFD,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE3,
-    0x0F,
-    0x00,
-    0x00,
-    0xF5,
-    0xFF,
-    0x00,
-    0x00,
-    0xF5,
-    0xB9,
-    0x0F,
-    0x00,
-    0x00,
-    0x05,
-    0xFB,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x92,
-    0xFE,
-    0x8D,
-    0x00,
-    0xE0,
-    0x9E,
-    0xB7,
-    0x8F,
-    0x00,
-    0x03,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x08,
-    0x00,
-    0x00,
-    0xE1,
-    0x0D,
-    0x00,
-    0x00,
-    0xD1,
-    0x2E,
-    0x00,
-    0x00,
-    0xD2,
-    0x1D,
-    0x00,
-    0x00,
-    0xE2,
-    0x0B,
-    0x00,
-    0x00,
-    0xE1,
-    0x8F,
-    0x77,
-    0x77,
-    0x52,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB5,
-    0xFE,
-    0x8D,
-    0x00,
-    0xE0,
-    0x8C,
-    0xB7,
-    0x8F,
-    0x00,
-    0x01,
-    0x00,
-    0xE0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xCE,
-    0x00,
-    0x00,
-    0x10,
-    0xF8,
-    0x05,
-    0x00,
-    0xF9,
-    0xEF,
-    0x05,
-    0x00,
-    0x30,
-    0x75,
-    0xFA,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0xFA,
-    0x02,
-    0x00,
-    0x00,
-    0xB0,
-    0x2F,
-    0xB5,
-    0x58,
-    0xB6,
-    0xBF,
-    0x20,
-    0xEB,
-    0xFF,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFD,
-    0x01,
-    0x00,
-    0x00,
-    0xFA,
-    0x1F,
-    0x00,
-    0x00,
-    0xF5,
-    0xFA,
-    0x01,
-    0x00,
-    0xE1,
-    0x77,
-    0x1F,
-    0x00,
-    0xC0,
-    0x0B,
-    0xF9,
-    0x01,
-    0x80,
-    0x1E,
-    0x90,
-    0x1F,
-    0x30,
-    0x4F,
-    0x00,
-    0xF9,
-    0x01,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x4B,
-    0x55,
-    0x55,
-    0xFB,
-    0x46,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0xFF,
-    0xFF,
-    0x05,
-    0x80,
-    0x7F,
-    0x77,
-    0x27,
-    0x00,
-    0xF9,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0xFE,
-    0x8E,
-    0x00,
-    0x60,
-    0x78,
-    0xC7,
-    0xBF,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x02,
-    0x00,
-    0x00,
-    0xC0,
-    0x0F,
-    0xD1,
-    0x79,
-    0xC7,
-    0x7F,
-    0x00,
-    0xEA,
-    0xFF,
-    0x6C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC7,
-    0xFF,
-    0x06,
-    0x00,
-    0xFC,
-    0x6A,
-    0x36,
-    0x00,
-    0xF8,
-    0x03,
-    0x00,
-    0x00,
-    0xE0,
-    0x0A,
-    0x00,
-    0x00,
-    0x20,
-    0x7F,
-    0xE9,
-    0xBF,
-    0x02,
-    0xF3,
-    0xAE,
-    0x75,
-    0xDE,
-    0x30,
-    0xAF,
-    0x00,
-    0x70,
-    0x4F,
-    0xF2,
-    0x07,
-    0x00,
-    0xF5,
-    0x05,
-    0xCE,
-    0x00,
-    0x80,
-    0x3F,
-    0x50,
-    0xBF,
-    0x96,
-    0xCF,
-    0x00,
-    0x50,
-    0xFD,
-    0x9E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x73,
-    0x77,
-    0x77,
-    0xFC,
-    0x03,
-    0x00,
-    0x00,
-    0xE0,
-    0x0B,
-    0x00,
-    0x00,
-    0x60,
-    0x4F,
-    0x00,
-    0x00,
-    0x00,
-    0xDE,
-    0x00,
-    0x00,
-    0x00,
-    0xF5,
-    0x05,
-    0x00,
-    0x00,
-    0xD0,
-    0x0E,
-    0x00,
-    0x00,
-    0x50,
-    0x6F,
-    0x00,
-    0x00,
-    0x00,
-    0xEC,
-    0x00,
-    0x00,
-    0x00,
-    0xF4,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0xFE,
-    0x9E,
-    0x01,
-    0xB0,
-    0x8F,
-    0x85,
-    0xBF,
-    0x00,
-    0xEF,
-    0x00,
-    0xE0,
-    0x0E,
-    0x90,
-    0x8F,
-    0x71,
-    0x8F,
-    0x00,
-    0x90,
-    0xFF,
-    0x7F,
-    0x00,
-    0x30,
-    0xDE,
-    0xF9,
-    0x3E,
-    0x00,
-    0xEE,
-    0x01,
-    0xE3,
-    0x0E,
-    0xF4,
-    0x08,
-    0x00,
-    0xF8,
-    0x34,
-    0x9F,
-    0x00,
-    0xA0,
-    0x3F,
-    0xD0,
-    0x7F,
-    0x85,
-    0xCF,
-    0x00,
-    0x91,
-    0xFE,
-    0x9E,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFE,
-    0x5D,
-    0x00,
-    0xB0,
-    0x9F,
-    0xB6,
-    0x6F,
-    0x20,
-    0x9F,
-    0x00,
-    0xC0,
-    0x0E,
-    0xF5,
-    0x05,
-    0x00,
-    0xF6,
-    0x32,
-    0x7F,
-    0x00,
-    0x90,
-    0x3F,
-    0xD0,
-    0x8E,
-    0x95,
-    0xFE,
-    0x03,
-    0xB2,
-    0xEF,
-    0x7A,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0xEA,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0x08,
-    0x30,
-    0x65,
-    0xF9,
-    0x0D,
-    0x00,
-    0xF7,
-    0xCF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0xE0,
-    0x0F,
-    0x10,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0x01,
-    0xE0,
-    0x0F,
-    0xC0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0xE0,
-    0x0F,
-    0x10,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x0D,
-    0xF0,
-    0x09,
-    0xF3,
-    0x03,
-    0xD6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x91,
-    0x03,
-    0x00,
-    0x10,
-    0xF9,
-    0x1D,
-    0x00,
-    0x91,
-    0xCF,
-    0x04,
-    0x00,
-    0xF9,
-    0x3A,
-    0x00,
-    0x00,
-    0xF2,
-    0x6E,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xFD,
-    0x39,
-    0x00,
-    0x00,
-    0x00,
-    0xC5,
-    0xCF,
-    0x01,
-    0x00,
-    0x00,
-    0x30,
-    0x3A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x13,
-    0x55,
-    0x55,
-    0x55,
-    0x15,
-    0x30,
-    0x33,
-    0x33,
-    0x33,
-    0x30,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x3F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x93,
-    0x01,
-    0x00,
-    0x00,
-    0x10,
-    0xFD,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0xC4,
-    0x9F,
-    0x01,
-    0x00,
-    0x00,
-    0x30,
-    0xFA,
-    0x09,
-    0x00,
-    0x00,
-    0x60,
-    0xFE,
-    0x02,
-    0x30,
-    0xF9,
-    0x6D,
-    0x00,
-    0xC1,
-    0xCF,
-    0x05,
-    0x00,
-    0x30,
-    0x3A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xEB,
-    0xDF,
-    0x06,
-    0xC8,
-    0x78,
-    0xFC,
-    0x04,
-    0x00,
-    0x10,
-    0x9F,
-    0x00,
-    0x00,
-    0xF2,
-    0x08,
-    0x00,
-    0xD1,
-    0x1E,
-    0x00,
-    0xE2,
-    0x2D,
-    0x00,
-    0xA0,
-    0x1D,
-    0x00,
-    0x00,
-    0x9D,
-    0x00,
-    0x00,
-    0x20,
-    0x01,
-    0x00,
-    0x10,
-    0xEF,
-    0x00,
-    0x00,
-    0xD0,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x81,
-    0xFD,
-    0xCF,
-    0x06,
-    0x00,
-    0x00,
-    0xE3,
-    0x5B,
-    0x22,
-    0xD6,
-    0x0B,
-    0x00,
-    0xE1,
-    0x07,
-    0x00,
-    0x00,
-    0xD1,
-    0x08,
-    0x90,
-    0x0B,
-    0xB2,
-    0xFF,
-    0x0C,
-    0xE6,
-    0x00,
-    0x5E,
-    0xE0,
-    0x2A,
-    0xF5,
-    0x11,
-    0x1F,
-    0xF2,
-    0x52,
-    0x0F,
-    0x40,
-    0x0F,
-    0xF1,
-    0x33,
-    0x1F,
-    0xF5,
-    0x00,
-    0xF6,
-    0x20,
-    0x0F,
-    0xF2,
-    0x32,
-    0x6F,
-    0xC2,
-    0x3F,
-    0xB9,
-    0x00,
-    0x6E,
-    0x70,
-    0xEE,
-    0x77,
-    0xCF,
-    0x01,
-    0x80,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x7E,
-    0x23,
-    0x74,
-    0x07,
-    0x00,
-    0x00,
-    0x60,
-    0xFC,
-    0xEF,
-    0x4B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xFF,
-    0x01,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0x07,
-    0x00,
-    0x00,
-    0xD0,
-    0xAB,
-    0x0D,
-    0x00,
-    0x00,
-    0xF3,
-    0x45,
-    0x3F,
-    0x00,
-    0x00,
-    0xE9,
-    0x00,
-    0x9E,
-    0x00,
-    0x00,
-    0x9E,
-    0x00,
-    0xE9,
-    0x00,
-    0x50,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x05,
-    0xB0,
-    0x7E,
-    0x77,
-    0xE7,
-    0x0B,
-    0xF1,
-    0x09,
-    0x00,
-    0x90,
-    0x1F,
-    0xF6,
-    0x04,
-    0x00,
-    0x40,
-    0x6F,
-    0xFC,
-    0x00,
-    0x00,
-    0x00,
-    0xCF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0xFF,
-    0x7C,
-    0x00,
-    0x90,
-    0x9F,
-    0x87,
-    0xFD,
-    0x07,
-    0x90,
-    0x3F,
-    0x00,
-    0xF1,
-    0x0C,
-    0x90,
-    0x3F,
-    0x00,
-    0xF0,
-    0x0C,
-    0x90,
-    0x3F,
-    0x00,
-    0xF7,
-    0x07,
-    0x90,
-    0xFF,
-    0xFF,
-    0x8F,
-    0x00,
-    0x90,
-    0x8F,
-    0x65,
-    0xFA,
-    0x09,
-    0x90,
-    0x3F,
-    0x00,
-    0xB0,
-    0x1F,
-    0x90,
-    0x3F,
-    0x00,
-    0xC0,
-    0x1F,
-    0x90,
-    0x9F,
-    0x77,
-    0xFB,
-    0x0C,
-    0x90,
-    0xFF,
-    0xFF,
-    0x9D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xEB,
-    0xEF,
-    0x2A,
-    0x00,
-    0xF9,
-    0x8E,
-    0xA7,
-    0x1E,
-    0x50,
-    0xBF,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x2F,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xF0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x8D,
-    0x97,
-    0x1D,
-    0x00,
-    0x70,
-    0xFC,
-    0xEF,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0xCF,
-    0x06,
-    0x00,
-    0x90,
-    0x8F,
-    0x87,
-    0xFC,
-    0x0B,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0xF9,
-    0x07,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0xDF,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0xC0,
-    0x0F,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0xFB,
-    0x01,
-    0xF9,
-    0x01,
-    0x00,
-    0xC0,
-    0x0F,
-    0x90,
-    0x1F,
-    0x00,
-    0x10,
-    0xDF,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0xFA,
-    0x06,
-    0x90,
-    0x8F,
-    0x87,
-    0xFD,
-    0x0A,
-    0x00,
-    0xF9,
-    0xFF,
-    0xBE,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x90,
-    0x8F,
-    0x77,
-    0x07,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0xFF,
-    0x0D,
-    0x90,
-    0x8F,
-    0x77,
-    0x06,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x8F,
-    0x77,
-    0x07,
-    0x90,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x90,
-    0x8F,
-    0x77,
-    0x37,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0xFF,
-    0x3F,
-    0x90,
-    0x8F,
-    0x77,
-    0x17,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB4,
-    0xFE,
-    0xCE,
-    0x05,
-    0x00,
-    0xF9,
-    0x9E,
-    0x87,
-    0x5D,
-    0x00,
-    0xF6,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0xC0,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xCF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF1,
-    0x0B,
-    0x10,
-    0xFF,
-    0xDF,
-    0x00,
-    0xCF,
-    0x00,
-    0x70,
-    0xE7,
-    0x0D,
-    0xD0,
-    0x0F,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0xF7,
-    0x0A,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0xFB,
-    0x8D,
-    0x87,
-    0xDF,
-    0x00,
-    0x00,
-    0xC7,
-    0xFF,
-    0xBE,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0xF1,
-    0x09,
-    0x90,
-    0x1F,
-    0x00,
-    0x10,
-    0x9F,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0xF1,
-    0x09,
-    0x90,
-    0x1F,
-    0x00,
-    0x10,
-    0x9F,
-    0x00,
-    0xF9,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x09,
-    0x90,
-    0x8F,
-    0x77,
-    0x87,
-    0x9F,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0xF1,
-    0x09,
-    0x90,
-    0x1F,
-    0x00,
-    0x10,
-    0x9F,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0xF1,
-    0x09,
-    0x90,
-    0x1F,
-    0x00,
-    0x10,
-    0x9F,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0xF1,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF7,
-    0x05,
-    0x70,
-    0x5F,
-    0x00,
-    0xF7,
-    0x05,
-    0x70,
-    0x5F,
-    0x00,
-    0xF7,
-    0x05,
-    0x70,
-    0x5F,
-    0x00,
-    0xF7,
-    0x05,
-    0x70,
-    0x5F,
-    0x00,
-    0xF7,
-    0x05,
-    0x70,
-    0x5F,
-    0x00,
-    0xF7,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0xFB,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0xFB,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0xFB,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0xFB,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0xFB,
-    0x00,
-    0xE0,
-    0x2E,
-    0xA7,
-    0x8F,
-    0xF3,
-    0x9E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0x3F,
-    0x00,
-    0x80,
-    0x6F,
-    0x70,
-    0x3F,
-    0x00,
-    0xF6,
-    0x09,
-    0x70,
-    0x3F,
-    0x40,
-    0xAF,
-    0x00,
-    0x70,
-    0x3F,
-    0xF3,
-    0x0C,
-    0x00,
-    0x70,
-    0x6F,
-    0xDE,
-    0x01,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0x02,
-    0x00,
-    0x70,
-    0xAF,
-    0xF5,
-    0x0C,
-    0x00,
-    0x70,
-    0x3F,
-    0x80,
-    0x8F,
-    0x00,
-    0x70,
-    0x3F,
-    0x00,
-    0xFC,
-    0x03,
-    0x70,
-    0x3F,
-    0x00,
-    0xE2,
-    0x0D,
-    0x70,
-    0x3F,
-    0x00,
-    0x50,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x90,
-    0x8F,
-    0x77,
-    0x47,
-    0x90,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0xFF,
-    0x09,
-    0x90,
-    0xFF,
-    0x06,
-    0x00,
-    0x60,
-    0xFF,
-    0x09,
-    0x90,
-    0xCE,
-    0x0B,
-    0x00,
-    0xC0,
-    0xFA,
-    0x09,
-    0x90,
-    0x7F,
-    0x1F,
-    0x00,
-    0xF1,
-    0xF6,
-    0x09,
-    0x90,
-    0x1F,
-    0x6F,
-    0x00,
-    0xE7,
-    0xF2,
-    0x09,
-    0x90,
-    0x0F,
-    0xCB,
-    0x00,
-    0x9D,
-    0xF1,
-    0x09,
-    0x90,
-    0x0F,
-    0xF6,
-    0x31,
-    0x3F,
-    0xF1,
-    0x09,
-    0x90,
-    0x0F,
-    0xF1,
-    0x87,
-    0x0E,
-    0xF1,
-    0x09,
-    0x90,
-    0x0F,
-    0xB0,
-    0xED,
-    0x08,
-    0xF1,
-    0x09,
-    0x90,
-    0x0F,
-    0x50,
-    0xFF,
-    0x02,
-    0xF1,
-    0x09,
-    0x90,
-    0x0F,
-    0x00,
-    0xDF,
-    0x00,
-    0xF1,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xDF,
-    0x00,
-    0x00,
-    0xF0,
-    0x09,
-    0x90,
-    0xFF,
-    0x07,
-    0x00,
-    0xF0,
-    0x09,
-    0x90,
-    0xDE,
-    0x2F,
-    0x00,
-    0xF0,
-    0x09,
-    0x90,
-    0x3F,
-    0xBF,
-    0x00,
-    0xF0,
-    0x09,
-    0x90,
-    0x0F,
-    0xF9,
-    0x05,
-    0xF0,
-    0x09,
-    0x90,
-    0x0F,
-    0xE0,
-    0x0E,
-    0xF0,
-    0x09,
-    0x90,
-    0x0F,
-    0x50,
-    0x9F,
-    0xF0,
-    0x09,
-    0x90,
-    0x0F,
-    0x00,
-    0xFB,
-    0xF3,
-    0x09,
-    0x90,
-    0x0F,
-    0x00,
-    0xF2,
-    0xFD,
-    0x09,
-    0x90,
-    0x0F,
-    0x00,
-    0x70,
-    0xFF,
-    0x09,
-    0x90,
-    0x0F,
-    0x00,
-    0x00,
-    0xFD,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFC,
-    0xCF,
-    0x07,
-    0x00,
-    0x00,
-    0xFB,
-    0x8C,
-    0xC8,
-    0xBF,
-    0x00,
-    0x70,
-    0x9F,
-    0x00,
-    0x00,
-    0xF9,
-    0x07,
-    0xD0,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x0D,
-    0xF0,
-    0x0C,
-    0x00,
-    0x00,
-    0xC0,
-    0x0F,
-    0xF1,
-    0x0B,
-    0x00,
-    0x00,
-    0xB0,
-    0x1F,
-    0xF0,
-    0x0C,
-    0x00,
-    0x00,
-    0xC0,
-    0x0F,
-    0xD0,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x0D,
-    0x70,
-    0x9F,
-    0x00,
-    0x00,
-    0xF9,
-    0x07,
-    0x00,
-    0xFB,
-    0x8C,
-    0xC8,
-    0xBF,
-    0x00,
-    0x00,
-    0x70,
-    0xFC,
-    0xCF,
-    0x07,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0xFF,
-    0xAE,
-    0x01,
-    0x90,
-    0x8F,
-    0xA7,
-    0xDF,
-    0x00,
-    0xF9,
-    0x01,
-    0x90,
-    0x3F,
-    0x90,
-    0x1F,
-    0x00,
-    0xF8,
-    0x03,
-    0xF9,
-    0x01,
-    0xE3,
-    0x0F,
-    0x90,
-    0xFF,
-    0xFF,
-    0x4F,
-    0x00,
-    0xF9,
-    0x78,
-    0x05,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFC,
-    0xCF,
-    0x07,
-    0x00,
-    0x00,
-    0xFB,
-    0x8C,
-    0xC8,
-    0xBF,
-    0x00,
-    0x70,
-    0x9F,
-    0x00,
-    0x00,
-    0xF9,
-    0x07,
-    0xD0,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x0D,
-    0xF0,
-    0x0C,
-    0x00,
-    0x00,
-    0xC0,
-    0x0F,
-    0xF1,
-    0x0B,
-    0x00,
-    0x00,
-    0xB0,
-    0x1F,
-    0xF0,
-    0x0C,
-    0x00,
-    0x00,
-    0xC0,
-    0x0F,
-    0xD0,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x0D,
-    0x70,
-    0x9F,
-    0x00,
-    0x00,
-    0xF9,
-    0x06,
-    0x00,
-    0xFB,
-    0x8C,
-    0xC8,
-    0xBF,
-    0x00,
-    0x00,
-    0x70,
-    0xFC,
-    0xFF,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE3,
-    0x2E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x30,
-    0xEE,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xFF,
-    0xFF,
-    0x6C,
-    0x00,
-    0x70,
-    0x9F,
-    0x87,
-    0xFE,
-    0x06,
-    0x70,
-    0x3F,
-    0x00,
-    0xF1,
-    0x0C,
-    0x70,
-    0x3F,
-    0x00,
-    0xE0,
-    0x0D,
-    0x70,
-    0x3F,
-    0x00,
-    0xF7,
-    0x08,
-    0x70,
-    0xFF,
-    0xFF,
-    0x8F,
-    0x00,
-    0x70,
-    0x9F,
-    0xD7,
-    0x0D,
-    0x00,
-    0x70,
-    0x3F,
-    0x30,
-    0x9F,
-    0x00,
-    0x70,
-    0x3F,
-    0x00,
-    0xFA,
-    0x03,
-    0x70,
-    0x3F,
-    0x00,
-    0xE1,
-    0x0D,
-    0x70,
-    0x3F,
-    0x00,
-    0x60,
-    0x8F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xEA,
-    0xDF,
-    0x09,
-    0xC0,
-    0x9F,
-    0xA7,
-    0x0D,
-    0xF1,
-    0x0A,
-    0x00,
-    0x00,
-    0xF1,
-    0x0B,
-    0x00,
-    0x00,
-    0xB0,
-    0xBF,
-    0x03,
-    0x00,
-    0x00,
-    0xF9,
-    0xCF,
-    0x02,
-    0x00,
-    0x10,
-    0xF8,
-    0x0E,
-    0x00,
-    0x00,
-    0x70,
-    0x4F,
-    0x00,
-    0x00,
-    0x70,
-    0x4F,
-    0xD3,
-    0x79,
-    0xE8,
-    0x0D,
-    0xB1,
-    0xFE,
-    0xAE,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x75,
-    0xE7,
-    0x7E,
-    0x57,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x01,
-    0x00,
-    0xF1,
-    0x0B,
-    0xB0,
-    0x1F,
-    0x00,
-    0x10,
-    0xBF,
-    0x00,
-    0xFB,
-    0x01,
-    0x00,
-    0xF1,
-    0x0B,
-    0xB0,
-    0x1F,
-    0x00,
-    0x10,
-    0xBF,
-    0x00,
-    0xFB,
-    0x01,
-    0x00,
-    0xF1,
-    0x0B,
-    0xB0,
-    0x1F,
-    0x00,
-    0x10,
-    0xBF,
-    0x00,
-    0xFB,
-    0x01,
-    0x00,
-    0xF1,
-    0x0B,
-    0xA0,
-    0x1F,
-    0x00,
-    0x10,
-    0x9F,
-    0x00,
-    0xF7,
-    0x06,
-    0x00,
-    0xF6,
-    0x06,
-    0x00,
-    0xFD,
-    0x7A,
-    0xFA,
-    0x0D,
-    0x00,
-    0x10,
-    0xE9,
-    0xEF,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0E,
-    0x00,
-    0x00,
-    0xDE,
-    0xF7,
-    0x03,
-    0x00,
-    0xF3,
-    0x27,
-    0x8F,
-    0x00,
-    0x90,
-    0x2F,
-    0xD0,
-    0x0D,
-    0x00,
-    0xDD,
-    0x00,
-    0xF8,
-    0x02,
-    0xF2,
-    0x07,
-    0x30,
-    0x7F,
-    0x70,
-    0x2F,
-    0x00,
-    0xD0,
-    0x0C,
-    0xDC,
-    0x00,
-    0x00,
-    0xF8,
-    0xF3,
-    0x08,
-    0x00,
-    0x30,
-    0xAF,
-    0x3F,
-    0x00,
-    0x00,
-    0xE0,
-    0xDF,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0x00,
-    0x00,
-    0xEF,
-    0x00,
-    0x00,
-    0xCE,
-    0xF8,
-    0x03,
-    0x40,
-    0xFF,
-    0x03,
-    0x30,
-    0x8F,
-    0xF4,
-    0x06,
-    0x80,
-    0xEE,
-    0x07,
-    0x60,
-    0x4F,
-    0xF0,
-    0x0A,
-    0xC0,
-    0xBA,
-    0x0C,
-    0xA0,
-    0x0F,
-    0xC0,
-    0x0E,
-    0xF1,
-    0x77,
-    0x0F,
-    0xE0,
-    0x0C,
-    0x80,
-    0x2F,
-    0xF5,
-    0x32,
-    0x5F,
-    0xF2,
-    0x08,
-    0x40,
-    0x5F,
-    0xE9,
-    0x00,
-    0x9E,
-    0xF5,
-    0x04,
-    0x00,
-    0x8F,
-    0xAD,
-    0x00,
-    0xCA,
-    0xF9,
-    0x00,
-    0x00,
-    0xCC,
-    0x5F,
-    0x00,
-    0xF6,
-    0xCC,
-    0x00,
-    0x00,
-    0xF8,
-    0x1F,
-    0x00,
-    0xF2,
-    0x8F,
-    0x00,
-    0x00,
-    0xF4,
-    0x0D,
-    0x00,
-    0xD0,
-    0x4F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0x7F,
-    0x00,
-    0x60,
-    0x6F,
-    0xC0,
-    0x1E,
-    0x00,
-    0xCE,
-    0x00,
-    0xF3,
-    0x09,
-    0xF8,
-    0x03,
-    0x00,
-    0xF9,
-    0xF4,
-    0x09,
-    0x00,
-    0x10,
-    0xFE,
-    0x0E,
-    0x00,
-    0x00,
-    0xB0,
-    0xAF,
-    0x00,
-    0x00,
-    0x30,
-    0xDF,
-    0x3F,
-    0x00,
-    0x00,
-    0xDD,
-    0xE0,
-    0x0C,
-    0x00,
-    0xF7,
-    0x04,
-    0xF6,
-    0x06,
-    0xE1,
-    0x0B,
-    0x00,
-    0xED,
-    0xA1,
-    0x2F,
-    0x00,
-    0x40,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x2F,
-    0x00,
-    0x20,
-    0xBF,
-    0xF2,
-    0x0A,
-    0x00,
-    0xFA,
-    0x02,
-    0xFA,
-    0x02,
-    0xF2,
-    0x09,
-    0x20,
-    0xAF,
-    0xB0,
-    0x1F,
-    0x00,
-    0x90,
-    0x7F,
-    0x8F,
-    0x00,
-    0x00,
-    0xF1,
-    0xEF,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x07,
-    0x00,
-    0x00,
-    0x50,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0xF5,
-    0x05,
-    0x00,
-    0x00,
-    0x50,
-    0x5F,
-    0x00,
-    0x00,
-    0x00,
-    0xF5,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x50,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x5F,
-    0x72,
-    0x77,
-    0x77,
-    0xFF,
-    0x02,
-    0x00,
-    0x00,
-    0xF7,
-    0x06,
-    0x00,
-    0x00,
-    0xF2,
-    0x0B,
-    0x00,
-    0x00,
-    0xC0,
-    0x1E,
-    0x00,
-    0x00,
-    0x80,
-    0x5F,
-    0x00,
-    0x00,
-    0x30,
-    0xAF,
-    0x00,
-    0x00,
-    0x00,
-    0xED,
-    0x00,
-    0x00,
-    0x00,
-    0xF9,
-    0x04,
-    0x00,
-    0x00,
-    0xF4,
-    0x7D,
-    0x77,
-    0x77,
-    0x73,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFD,
-    0x9F,
-    0xD0,
-    0x3C,
-    0x02,
-    0xBD,
-    0x00,
-    0xD0,
-    0x0B,
-    0x00,
-    0xBD,
-    0x00,
-    0xD0,
-    0x0B,
-    0x00,
-    0xBD,
-    0x00,
-    0xD0,
-    0x0B,
-    0x00,
-    0xBD,
-    0x00,
-    0xD0,
-    0x0B,
-    0x00,
-    0xBD,
-    0x00,
-    0xD0,
-    0x3C,
-    0x02,
-    0xFD,
-    0x9F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xEA,
-    0x00,
-    0x00,
-    0xF4,
-    0x04,
-    0x00,
-    0xE0,
-    0x0A,
-    0x00,
-    0x80,
-    0x0F,
-    0x00,
-    0x20,
-    0x6F,
-    0x00,
-    0x00,
-    0xCC,
-    0x00,
-    0x00,
-    0xF6,
-    0x02,
-    0x00,
-    0xF0,
-    0x08,
-    0x00,
-    0xA0,
-    0x0E,
-    0x00,
-    0x40,
-    0x4F,
-    0x00,
-    0x00,
-    0xAE,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0xFF,
-    0x0D,
-    0x32,
-    0xDC,
-    0x00,
-    0xB0,
-    0x0D,
-    0x00,
-    0xDB,
-    0x00,
-    0xB0,
-    0x0D,
-    0x00,
-    0xDB,
-    0x00,
-    0xB0,
-    0x0D,
-    0x00,
-    0xDB,
-    0x00,
-    0xB0,
-    0x0D,
-    0x00,
-    0xDB,
-    0x00,
-    0xB0,
-    0x0D,
-    0x32,
-    0xDC,
-    0x90,
-    0xFF,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x07,
-    0x00,
-    0x00,
-    0xF4,
-    0x0E,
-    0x00,
-    0x00,
-    0x8B,
-    0x7C,
-    0x00,
-    0x20,
-    0x1F,
-    0xE4,
-    0x01,
-    0xA0,
-    0x0A,
-    0xC0,
-    0x08,
-    0xF1,
-    0x03,
-    0x50,
-    0x1F,
-    0xC8,
-    0x00,
-    0x00,
-    0x8D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xEC,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-    0xD8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xEA,
-    0xEF,
-    0x09,
-    0x00,
-    0xB1,
-    0x56,
-    0xF8,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0xBE,
-    0x00,
-    0x92,
-    0xFD,
-    0xFF,
-    0x0B,
-    0xE1,
-    0x5E,
-    0x11,
-    0xBF,
-    0x30,
-    0x7F,
-    0x00,
-    0xF1,
-    0x0B,
-    0xF2,
-    0x5D,
-    0xC6,
-    0xBE,
-    0x00,
-    0xE6,
-    0xDF,
-    0x95,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x6D,
-    0xFE,
-    0x1B,
-    0x00,
-    0xFD,
-    0x6C,
-    0xF9,
-    0x0B,
-    0xD0,
-    0x1F,
-    0x00,
-    0xFB,
-    0x01,
-    0xED,
-    0x00,
-    0x70,
-    0x3F,
-    0xD0,
-    0x0E,
-    0x00,
-    0xF7,
-    0x03,
-    0xFD,
-    0x01,
-    0xB0,
-    0x1F,
-    0xD0,
-    0xCF,
-    0x96,
-    0xBF,
-    0x00,
-    0x9D,
-    0xE7,
-    0xAF,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE9,
-    0xDF,
-    0x04,
-    0xFA,
-    0x7A,
-    0x29,
-    0xF1,
-    0x0B,
-    0x00,
-    0x30,
-    0x7F,
-    0x00,
-    0x00,
-    0xF3,
-    0x07,
-    0x00,
-    0x10,
-    0xBF,
-    0x00,
-    0x00,
-    0xB0,
-    0xAF,
-    0x97,
-    0x05,
-    0x90,
-    0xFE,
-    0x3D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x10,
-    0xFA,
-    0x7E,
-    0xDD,
-    0x00,
-    0xFB,
-    0x69,
-    0xFC,
-    0x0D,
-    0xF1,
-    0x0B,
-    0x00,
-    0xDF,
-    0x30,
-    0x7F,
-    0x00,
-    0xD0,
-    0x0D,
-    0xF3,
-    0x07,
-    0x00,
-    0xDD,
-    0x10,
-    0xBF,
-    0x00,
-    0xF0,
-    0x0D,
-    0xB0,
-    0x9F,
-    0xB6,
-    0xDF,
-    0x00,
-    0xB1,
-    0xEF,
-    0xA6,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD6,
-    0xEF,
-    0x09,
-    0x00,
-    0xF7,
-    0x48,
-    0xE7,
-    0x0B,
-    0xF0,
-    0x0B,
-    0x00,
-    0xF8,
-    0x22,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x3F,
-    0xF2,
-    0x3A,
-    0x33,
-    0x33,
-    0x00,
-    0xDF,
-    0x00,
-    0x00,
-    0x00,
-    0x70,
-    0xBF,
-    0x56,
-    0xA7,
-    0x00,
-    0x60,
-    0xFC,
-    0xDF,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE7,
-    0xBF,
-    0x30,
-    0xCF,
-    0x56,
-    0x70,
-    0x3F,
-    0x00,
-    0x70,
-    0x1F,
-    0x00,
-    0xF7,
-    0xFF,
-    0x0D,
-    0x92,
-    0x5F,
-    0x03,
-    0x70,
-    0x1F,
-    0x00,
-    0x70,
-    0x1F,
-    0x00,
-    0x70,
-    0x1F,
-    0x00,
-    0x70,
-    0x1F,
-    0x00,
-    0x70,
-    0x1F,
-    0x00,
-    0x70,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x20,
-    0xFC,
-    0xFF,
-    0xBF,
-    0xD0,
-    0x2C,
-    0xF5,
-    0x09,
-    0xF3,
-    0x06,
-    0xD0,
-    0x0C,
-    0xF3,
-    0x06,
-    0xD0,
-    0x0C,
-    0xD0,
-    0x2C,
-    0xF5,
-    0x07,
-    0x30,
-    0xFF,
-    0x8E,
-    0x00,
-    0xB0,
-    0x0B,
-    0x00,
-    0x00,
-    0x80,
-    0xFF,
-    0xFF,
-    0x1B,
-    0xE4,
-    0x79,
-    0x97,
-    0x8F,
-    0xBC,
-    0x00,
-    0x00,
-    0x9E,
-    0xEB,
-    0x35,
-    0xA4,
-    0x4F,
-    0xA1,
-    0xFE,
-    0xBE,
-    0x04,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x4F,
-    0xFC,
-    0x9E,
-    0x00,
-    0xB0,
-    0xEF,
-    0x67,
-    0xFB,
-    0x07,
-    0xB0,
-    0x4F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0C,
-    0xB0,
-    0x0C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xCB,
-    0x00,
-    0xCB,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x00,
-    0xDD,
-    0x76,
-    0xBF,
-    0xFE,
-    0x2C,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0xEB,
-    0x03,
-    0xFB,
-    0x00,
-    0xEB,
-    0x03,
-    0xB0,
-    0x0F,
-    0xEC,
-    0x03,
-    0x00,
-    0xEB,
-    0xFB,
-    0x07,
-    0x00,
-    0xB0,
-    0xDF,
-    0xED,
-    0x02,
-    0x00,
-    0xFB,
-    0x20,
-    0xDE,
-    0x00,
-    0xB0,
-    0x0F,
-    0x40,
-    0xBF,
-    0x00,
-    0xFB,
-    0x00,
-    0x70,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x79,
-    0xFE,
-    0x2C,
-    0xE7,
-    0xBF,
-    0x01,
-    0xB0,
-    0xDF,
-    0x96,
-    0xEF,
-    0x6C,
-    0xF9,
-    0x09,
-    0xB0,
-    0x2F,
-    0x00,
-    0xFE,
-    0x01,
-    0xE0,
-    0x0D,
-    0xB0,
-    0x0E,
-    0x00,
-    0xED,
-    0x00,
-    0xD0,
-    0x0D,
-    0xB0,
-    0x0D,
-    0x00,
-    0xDD,
-    0x00,
-    0xD0,
-    0x0D,
-    0xB0,
-    0x0D,
-    0x00,
-    0xDD,
-    0x00,
-    0xD0,
-    0x0D,
-    0xB0,
-    0x0D,
-    0x00,
-    0xDD,
-    0x00,
-    0xD0,
-    0x0D,
-    0xB0,
-    0x0D,
-    0x00,
-    0xDD,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x5B,
-    0xFD,
-    0x9E,
-    0x00,
-    0xB0,
-    0xEF,
-    0x67,
-    0xFB,
-    0x07,
-    0xB0,
-    0x4F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD8,
-    0xEF,
-    0x07,
-    0x00,
-    0xF9,
-    0x5A,
-    0xFA,
-    0x08,
-    0xF0,
-    0x0B,
-    0x00,
-    0xFC,
-    0x30,
-    0x7F,
-    0x00,
-    0x80,
-    0x3F,
-    0xF3,
-    0x07,
-    0x00,
-    0xF8,
-    0x03,
-    0xBF,
-    0x00,
-    0xC0,
-    0x0F,
-    0x80,
-    0xAF,
-    0xA6,
-    0x9F,
-    0x00,
-    0x70,
-    0xFD,
-    0x7D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x6A,
-    0xFE,
-    0x1B,
-    0x00,
-    0xFD,
-    0x6C,
-    0xF9,
-    0x0B,
-    0xD0,
-    0x1F,
-    0x00,
-    0xFB,
-    0x01,
-    0xDD,
-    0x00,
-    0x70,
-    0x3F,
-    0xD0,
-    0x0E,
-    0x00,
-    0xF7,
-    0x03,
-    0xFD,
-    0x01,
-    0xB0,
-    0x1F,
-    0xD0,
-    0xCF,
-    0x96,
-    0xBF,
-    0x00,
-    0xDD,
-    0xE7,
-    0xAF,
-    0x01,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xFA,
-    0x7E,
-    0xDA,
-    0x00,
-    0xFB,
-    0x69,
-    0xFC,
-    0x0D,
-    0xF1,
-    0x0B,
-    0x00,
-    0xDF,
-    0x30,
-    0x7F,
-    0x00,
-    0xD0,
-    0x0D,
-    0xF3,
-    0x07,
-    0x00,
-    0xDD,
-    0x10,
-    0xBF,
-    0x00,
-    0xF0,
-    0x0D,
-    0xB0,
-    0x8F,
-    0xB5,
-    0xDF,
-    0x00,
-    0xB1,
-    0xEF,
-    0xD6,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0xDD,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xD0,
-    0x58,
-    0xAE,
-    0xD0,
-    0xED,
-    0x5A,
-    0xD0,
-    0x4F,
-    0x00,
-    0xD0,
-    0x0E,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0xD0,
-    0x0D,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x60,
-    0xFD,
-    0xBE,
-    0x21,
-    0xBF,
-    0x65,
-    0x0A,
-    0xF3,
-    0x0A,
-    0x00,
-    0x00,
-    0xFA,
-    0x8E,
-    0x01,
-    0x00,
-    0xA3,
-    0xEF,
-    0x01,
-    0x00,
-    0x60,
-    0x5F,
-    0x93,
-    0x55,
-    0xFB,
-    0x23,
-    0xFC,
-    0xDF,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x50,
-    0x1F,
-    0x00,
-    0xF7,
-    0xFF,
-    0x7F,
-    0xB2,
-    0x5F,
-    0x13,
-    0x90,
-    0x1F,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x90,
-    0x1F,
-    0x00,
-    0x90,
-    0x2F,
-    0x00,
-    0x60,
-    0xAF,
-    0x45,
-    0x00,
-    0xFA,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF0,
-    0x0B,
-    0xB0,
-    0x0F,
-    0x00,
-    0xF4,
-    0x0B,
-    0x80,
-    0xBF,
-    0x75,
-    0xFE,
-    0x0B,
-    0x00,
-    0xE9,
-    0xDF,
-    0xB5,
-    0x0B,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xEC,
-    0x00,
-    0x00,
-    0xCF,
-    0xF6,
-    0x05,
-    0x50,
-    0x6F,
-    0xF0,
-    0x0A,
-    0xB0,
-    0x0F,
-    0xA0,
-    0x0F,
-    0xF0,
-    0x0A,
-    0x40,
-    0x5F,
-    0xF6,
-    0x03,
-    0x00,
-    0xBD,
-    0xDB,
-    0x00,
-    0x00,
-    0xE7,
-    0x7E,
-    0x00,
-    0x00,
-    0xF1,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFB,
-    0x00,
-    0xF0,
-    0x1F,
-    0x00,
-    0xBF,
-    0xF6,
-    0x04,
-    0xE5,
-    0x5F,
-    0x40,
-    0x6F,
-    0xF2,
-    0x08,
-    0xB9,
-    0x9B,
-    0x80,
-    0x2F,
-    0xD0,
-    0x0C,
-    0x7E,
-    0xE8,
-    0xC0,
-    0x0D,
-    0x90,
-    0x3F,
-    0x3F,
-    0xF3,
-    0xF3,
-    0x09,
-    0x50,
-    0x9F,
-    0x0E,
-    0xF0,
-    0xFA,
-    0x04,
-    0x00,
-    0xEF,
-    0x0A,
-    0xB0,
-    0xFE,
-    0x00,
-    0x00,
-    0xFC,
-    0x05,
-    0x60,
-    0xBF,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF4,
-    0x09,
-    0x80,
-    0x4F,
-    0xA0,
-    0x3F,
-    0xF2,
-    0x0A,
-    0x00,
-    0xCE,
-    0xEC,
-    0x00,
-    0x00,
-    0xF5,
-    0x5F,
-    0x00,
-    0x00,
-    0xF6,
-    0x6F,
-    0x00,
-    0x20,
-    0xAF,
-    0xFA,
-    0x02,
-    0xC0,
-    0x1E,
-    0xE1,
-    0x0C,
-    0xF7,
-    0x06,
-    0x60,
-    0x6F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xFC,
-    0x00,
-    0x00,
-    0xCF,
-    0xF6,
-    0x06,
-    0x50,
-    0x6F,
-    0xE0,
-    0x0B,
-    0xB0,
-    0x1F,
-    0x80,
-    0x1F,
-    0xF0,
-    0x0B,
-    0x20,
-    0x7F,
-    0xF5,
-    0x05,
-    0x00,
-    0xCC,
-    0xEB,
-    0x00,
-    0x00,
-    0xF5,
-    0x9E,
-    0x00,
-    0x00,
-    0xE0,
-    0x3F,
-    0x00,
-    0x00,
-    0xE0,
-    0x0D,
-    0x00,
-    0x00,
-    0xF4,
-    0x08,
-    0x00,
-    0x64,
-    0xEE,
-    0x01,
-    0x00,
-    0xFA,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xF3,
-    0xFF,
-    0xFF,
-    0x15,
-    0x55,
-    0xD5,
-    0x2F,
-    0x00,
-    0x60,
-    0x6F,
-    0x00,
-    0x10,
-    0xBE,
-    0x00,
-    0x00,
-    0xEC,
-    0x01,
-    0x00,
-    0xF7,
-    0x04,
-    0x00,
-    0xF3,
-    0x5D,
-    0x55,
-    0x72,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x9E,
-    0x00,
-    0xF7,
-    0x39,
-    0x00,
-    0xF9,
-    0x00,
-    0x00,
-    0xF9,
-    0x00,
-    0x00,
-    0xF9,
-    0x00,
-    0x20,
-    0xCE,
-    0x00,
-    0xF9,
-    0x1C,
-    0x00,
-    0x93,
-    0xAF,
-    0x00,
-    0x00,
-    0xFA,
-    0x00,
-    0x00,
-    0xF9,
-    0x00,
-    0x00,
-    0xF9,
-    0x00,
-    0x00,
-    0xF7,
-    0x39,
-    0x00,
-    0x90,
-    0x9E,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x90,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE9,
-    0x09,
-    0x00,
-    0x93,
-    0x7F,
-    0x00,
-    0x00,
-    0x9F,
-    0x00,
-    0x00,
-    0x9F,
-    0x00,
-    0x00,
-    0x9F,
-    0x00,
-    0x00,
-    0xDC,
-    0x02,
-    0x00,
-    0xC1,
-    0x9F,
-    0x00,
-    0xF9,
-    0x38,
-    0x00,
-    0xAE,
-    0x00,
-    0x00,
-    0x9F,
-    0x00,
-    0x00,
-    0x9F,
-    0x00,
-    0x93,
-    0x8F,
-    0x00,
-    0xE9,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x10,
-    0xFB,
-    0xBE,
-    0x56,
-    0x38,
-    0x83,
-    0x64,
-    0xEA,
-    0xBF,
-    0x01,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xC9,
-    0xBB,
-    0xCB,
-    0x09,
-    0x90,
-    0x01,
-    0x00,
-    0x93,
-    0x00,
-    0x19,
-    0x00,
-    0x30,
-    0x09,
-    0x90,
-    0x01,
-    0x00,
-    0x93,
-    0x00,
-    0x19,
-    0x00,
-    0x30,
-    0x09,
-    0x90,
-    0x01,
-    0x00,
-    0x93,
-    0x00,
-    0x19,
-    0x00,
-    0x30,
-    0x09,
-    0x90,
-    0x01,
-    0x00,
-    0x93,
-    0x00,
-    0x19,
-    0x00,
-    0x30,
-    0x09,
-    0x90,
-    0x01,
-    0x00,
-    0x93,
-    0x00,
-    0xC9,
-    0xBB,
-    0xCB,
-    0x09,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-]
-charactersOPEN_SANS_SEMIBOLD_11_16PX = [
-    FontCharacter(4, 32, 0),
-    FontCharacter(4, 32, 32),
-    FontCharacter(7, 56, 64),
-    FontCharacter(10, 80, 120),
-    FontCharacter(9, 72, 200),
-    FontCharacter(13, 104, 272),
-    FontCharacter(11, 88, 376),
-    FontCharacter(4, 32, 464),
-    FontCharacter(5, 40, 496),
-    FontCharacter(5, 40, 536),
-    FontCharacter(8, 64, 576),
-    FontCharacter(9, 72, 640),
-    FontCharacter(4, 32, 712),
-    FontCharacter(5, 40, 744),
-    FontCharacter(4, 32, 784),
-    FontCharacter(6, 48, 816),
-    FontCharacter(9, 72, 864),
-    FontCharacter(9, 72, 936),
-    FontCharacter(9, 72, 1008),
-    FontCharacter(9, 72, 1080),
-    FontCharacter(9, 72, 1152),
-    FontCharacter(9, 72, 1224),
-    FontCharacter(9, 72, 1296),
-    FontCharacter(9, 72, 1368),
-    FontCharacter(9, 72, 1440),
-    FontCharacter(9, 72, 1512),
-    FontCharacter(4, 32, 1584),
-    FontCharacter(4, 32, 1616),
-    FontCharacter(9, 72, 1648),
-    FontCharacter(9, 72, 1720),
-    FontCharacter(9, 72, 1792),
-    FontCharacter(7, 56, 1864),
-    FontCharacter(13, 104, 1920),
-    FontCharacter(10, 80, 2024),
-    FontCharacter(10, 80, 2104),
-    FontCharacter(10, 80, 2184),
-    FontCharacter(11, 88, 2264),
-    FontCharacter(8, 64, 2352),
-    FontCharacter(8, 64, 2416),
-    FontCharacter(11, 88, 2480),
-    FontCharacter(11, 88, 2568),
-    FontCharacter(5, 40, 2656),
-    FontCharacter(5, 40, 2696),
-    FontCharacter(10, 80, 2736),
-    FontCharacter(8, 64, 2816),
-    FontCharacter(14, 112, 2880),
-    FontCharacter(12, 96, 2992),
-    FontCharacter(12, 96, 3088),
-    FontCharacter(9, 72, 3184),
-    FontCharacter(12, 96, 3256),
-    FontCharacter(10, 80, 3352),
-    FontCharacter(8, 64, 3432),
-    FontCharacter(8, 64, 3496),
-    FontCharacter(11, 88, 3560),
-    FontCharacter(9, 72, 3648),
-    FontCharacter(14, 112, 3720),
-    FontCharacter(9, 72, 3832),
-    FontCharacter(9, 72, 3904),
-    FontCharacter(9, 72, 3976),
-    FontCharacter(5, 40, 4048),
-    FontCharacter(6, 48, 4088),
-    FontCharacter(5, 40, 4136),
-    FontCharacter(8, 64, 4176),
-    FontCharacter(6, 48, 4240),
-    FontCharacter(9, 72, 4288),
-    FontCharacter(9, 72, 4360),
-    FontCharacter(9, 72, 4432),
-    FontCharacter(7, 56, 4504),
-    FontCharacter(9, 72, 4560),
-    FontCharacter(9, 72, 4632),
-    FontCharacter(6, 48, 4704),
-    FontCharacter(8, 64, 4752),
-    FontCharacter(10, 80, 4816),
-    FontCharacter(4, 32, 4896),
-    FontCharacter(4, 32, 4928),
-    FontCharacter(9, 72, 4960),
-    FontCharacter(4, 32, 5032),
-    FontCharacter(14, 112, 5064),
-    FontCharacter(10, 80, 5176),
-    FontCharacter(9, 72, 5256),
-    FontCharacter(9, 72, 5328),
-    FontCharacter(9, 72, 5400),
-    FontCharacter(6, 48, 5472),
-    FontCharacter(7, 56, 5520),
-    FontCharacter(6, 48, 5576),
-    FontCharacter(10, 80, 5624),
-    FontCharacter(8, 64, 5704),
-    FontCharacter(12, 96, 5768),
-    FontCharacter(8, 64, 5864),
-    FontCharacter(8, 64, 5928),
-    FontCharacter(7, 56, 5992),
-    FontCharacter(6, 48, 6048),
-    FontCharacter(8, 64, 6096),
-    FontCharacter(6, 48, 6160),
-    FontCharacter(9, 72, 6208),
-    FontCharacter(9, 72, 6280),
-]
 
-FONTS = [
-    Font(
-        BAGL_FONT_LUCIDA_CONSOLE_8PX,
-        1,
-        8,
-        16,
-        0,
-        0x0020,
-        0x00FF,
-        charactersLUCIDA_CONSOLE_6PT_8H,
-        bitmapLUCIDA_CONSOLE_6PT_8H,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_LIGHT_16_22PX,
-        4,
-        22,
-        16,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_LIGHT_16_22PX,
-        bitmapOPEN_SANS_LIGHT_16_22PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_REGULAR_8_11PX,
-        4,
-        11,
-        8,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_REGULAR_8_11PX,
-        bitmapOPEN_SANS_REGULAR_8_11PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_REGULAR_10_13PX,
-        4,
-        14,
-        10,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_REGULAR_10_13PX,
-        bitmapOPEN_SANS_REGULAR_10_13PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_EXTRABOLD_11px,
-        1,
-        12,
-        9,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_EXTRABOLD_11PX,
-        bitmapOPEN_SANS_EXTRABOLD_11PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_REGULAR_11px,
-        1,
-        12,
-        9,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_REGULAR_11PX,
-        bitmapOPEN_SANS_REGULAR_11PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_LIGHT_16px,
-        1,
-        18,
-        13,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_LIGHT_16PX,
-        bitmapOPEN_SANS_LIGHT_16PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_SEMIBOLD_10_13PX,
-        4,
-        14,
-        10,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_SEMIBOLD_10_13PX,
-        bitmapOPEN_SANS_SEMIBOLD_10_13PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_SEMIBOLD_8_11PX,
-        4,
-        11,
-        8,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_SEMIBOLD_8_11PX,
-        bitmapOPEN_SANS_SEMIBOLD_8_11PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_REGULAR_11_14PX,
-        4,
-        16,
-        12,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_REGULAR_11_14PX,
-        bitmapOPEN_SANS_REGULAR_11_14PX,
-    ),
-    Font(
-        BAGL_FONT_OPEN_SANS_SEMIBOLD_11_16PX,
-        4,
-        16,
-        12,
-        0,
-        0x0020,
-        0x007F,
-        charactersOPEN_SANS_SEMIBOLD_11_16PX,
-        bitmapOPEN_SANS_SEMIBOLD_11_16PX,
-    ),
-    Font(
-        BAGL_FONT_SYMBOLS_0,
-        4,
-        16,
-        16,
-        0,
-        0x0000,
-        0x0006,
-        charactersSYMBOLS_0,
-        bitmapSYMBOLS_0,
-    ),
-]
+def __getattr__(name: str):
+    # FONTS is loaded on first access
+    if name == "FONTS":
+        return get_fonts()
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
 
 
 def get(font_id: int) -> Font | None:
     font_id &= BAGL_FONT_ID_MASK
-    for font in FONTS:
+    for font in get_fonts():
         if font.font_id == font_id:
             return font
     return None
@@ -1,7 +1,11 @@
 from __future__ import annotations
 
+import hashlib
 import io
+import time
 from abc import ABC, abstractmethod
+from collections.abc import Callable
+from dataclasses import dataclass
 
 try:
     from functools import cache
@@ -11,18 +15,32 @@ except ImportError:
 
     cache = lru_cache(maxsize=None)
 from socket import socket
-from threading import Lock
-from typing import IO, Any
-
-from PIL import Image
+from threading import Condition, Lock
+from typing import IO, TYPE_CHECKING, Any
 
 from speculos.observer import TextEvent
 
+if TYPE_CHECKING:
+    from PIL import Image
+
 from .struct import MODELS, DisplayArgs, Pixel, ServerArgs
 
 PixelColorMapping = dict[Pixel, int]
 
 
+@dataclass
+class FrameUpdate:
+    """A rectangle of the screen which changed, with its RGB pixels."""
+
+    seq: int
+    timestamp: float
+    x: int
+    y: int
+    w: int
+    h: int
+    data: bytes
+
+
 class IODevice(ABC):
     """
     An interface every class implementing application IOs (screens, buttons, APDUs, ...) should
@@ -86,6 +104,18 @@ class FrameBuffer:
         self.pixels: PixelColorMapping = {}
         self.screenshot_pixels: PixelColorMapping = {}
         self.screenshot_pixels_lock = Lock()
+        # Notified on each screenshot update, along with the frame sequence number
+        self.frame_condition = Condition(self.screenshot_pixels_lock)
+        self.frame_seq = 0
+        self._frame_hash = ""
+        self._frame_hash_seq = -1
+        # Called with each changed rectangle while the screen is being streamed
+        self._frame_listeners: list[Callable[[FrameUpdate], None]] = []
+        # RGB copy of the screenshot, only kept up to date while streaming
+        self._frame_rgb = bytearray()
+        # Observers which acknowledge the frames, by id: last acknowledged frame
+        self._frame_observers: dict[int, int] = {}
+        self._next_frame_observer = 0
         self.default_color = 0
         self.draw_default_color = False
         self.reset_screeshot_pixels = False
@@ -128,21 +158,34 @@ class FrameBuffer:
 
         return []
 
+    def _render(self, default_color: int, pixels: PixelColorMapping) -> bytes:
+        data = bytearray(default_color.to_bytes(3, "big")) * self._width * self._height
+        for (x, y), color in pixels.items():
+            pos = 3 * (y * self._width + x)
+            data[pos : pos + 3] = color.to_bytes(3, "big")
+        return bytes(data)
+
+    def _get_image_locked(self) -> bytes:
+        return self._render(self.default_color, self.screenshot_pixels)
+
     def _get_image(self) -> bytes:
         # This call is made from the Speculos API thread
         # Protect screenshot_pixels for concurrent Write during this Read
         with self.screenshot_pixels_lock:
-            data = bytearray(self.default_color.to_bytes(3, "big")) * self._width * self._height
-            for (x, y), color in self.screenshot_pixels.items():
-                pos = 3 * (y * self._width + x)
-                data[pos : pos + 3] = color.to_bytes(3, "big")
-        return bytes(data)
+            return self._get_image_locked()
 
-    def _get_screenshot_iobytes_value(self) -> bytes:
+    def get_image(self) -> Image.Image:
+        """Return the screenshot as a PIL image."""
         # Get the pixels object once, as it may be replaced during the loop.
         data = self._get_image()
 
-        image = Image.frombytes("RGB", self.current_screen_size, data)
+        # PIL is only needed for screenshots
+        from PIL import Image
+
+        return Image.frombytes("RGB", self.current_screen_size, data)
+
+    def _get_screenshot_iobytes_value(self) -> bytes:
+        image = self.get_image()
         iobytes = io.BytesIO()
         image.save(iobytes, format="PNG")
         return iobytes.getvalue()
@@ -154,10 +197,151 @@ class FrameBuffer:
         # This call is made from the MCU/Seproxyhal thread
         # Protect screenshot_pixels for concurrent Read during this Write
         with self.screenshot_pixels_lock:
+            reset = self.reset_screeshot_pixels
+            # Not a new frame if nothing was drawn on the screen since the previous update, as on the status which
+            # follows a NBGL refresh. The frame observers and streams only see the frames which changed something.
+            if not reset and not any(0 <= x < self._width and 0 <= y < self._height for x, y in self.pixels):
+                return
             if self.reset_screeshot_pixels:
                 self.screenshot_pixels = {}
                 self.reset_screeshot_pixels = False
             self.screenshot_pixels.update(self.pixels)
+            self.frame_seq += 1
+            self.frame_condition.notify_all()
+            if self._frame_listeners:
+                self._notify_frame_listeners(reset)
+
+    def _crop_frame_rgb(self, x: int, y: int, w: int, h: int) -> bytes:
+        stride = 3 * self._width
+        return b"".join(self._frame_rgb[row * stride + 3 * x : row * stride + 3 * (x + w)] for row in range(y, y + h))
+
+    def full_frame_update(self) -> FrameUpdate:
+        """The whole screen as an update. Must be called with screenshot_pixels_lock held, as in a frame listener."""
+        self._frame_rgb = bytearray(self._get_image_locked())
+        data = bytes(self._frame_rgb)
+        return FrameUpdate(self.frame_seq, time.time(), 0, 0, self._width, self._height, data)
+
+    def _notify_frame_listeners(self, reset: bool) -> None:
+        # Must be called with screenshot_pixels_lock held
+        if reset:
+            update = self.full_frame_update()
+        else:
+            # Only the pixels drawn since the previous update changed, there is at least one
+            changed = [(x, y) for (x, y) in self.pixels if 0 <= x < self._width and 0 <= y < self._height]
+            for x, y in changed:
+                pos = 3 * (y * self._width + x)
+                self._frame_rgb[pos : pos + 3] = self.pixels[(x, y)].to_bytes(3, "big")
+            x0 = min(x for x, _ in changed)
+            y0 = min(y for _, y in changed)
+            w = max(x for x, _ in changed) - x0 + 1
+            h = max(y for _, y in changed) - y0 + 1
+            update = FrameUpdate(self.frame_seq, time.time(), x0, y0, w, h, self._crop_frame_rgb(x0, y0, w, h))
+        for listener in self._frame_listeners:
+            listener(update)
+
+    def add_frame_listener(self, listener: Callable[[FrameUpdate], None]) -> None:
+        """
+        Call listener with the whole screen, then with the rectangle which
+        changed on each screenshot update. The listener is called from the
+        MCU thread and must return quickly.
+        """
+        with self.screenshot_pixels_lock:
+            listener(self.full_frame_update())
+            self._frame_listeners.append(listener)
+
+    def remove_frame_listener(self, listener: Callable[[FrameUpdate], None]) -> None:
+        with self.screenshot_pixels_lock:
+            self._frame_listeners.remove(listener)
+            if not self._frame_listeners:
+                self._frame_rgb = bytearray()
+
+    def get_frame(self) -> tuple[int, str]:
+        """Return the sequence number and the content hash of the current frame."""
+        # The hash is only computed when requested, and at most once per frame
+        with self.screenshot_pixels_lock:
+            seq = self.frame_seq
+            if self._frame_hash_seq == seq:
+                return seq, self._frame_hash
+            default_color = self.default_color
+            pixels = self.screenshot_pixels.copy()
+
+        # Rendered without the lock, not to delay the screenshot updates of the MCU thread. The hash of the RGB pixels
+        # doesn't depend on how the screen was drawn.
+        frame_hash = hashlib.blake2b(self._render(default_color, pixels), digest_size=16).hexdigest()
+        with self.screenshot_pixels_lock:
+            if self._frame_hash_seq < seq:
+                self._frame_hash_seq = seq
+                self._frame_hash = frame_hash
+        return seq, frame_hash
+
+    def wait_frame(
+        self, hash_: str | None = None, not_hash: str | None = None, timeout: float | None = None
+    ) -> tuple[bool, int, str]:
+        """
+        Wait until the content hash of the frame is hash_ (if set) and differs
+        from not_hash (if set). Return whether the condition holds before the
+        timeout, and the sequence number and hash of the current frame.
+        """
+
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while True:
+            seq, frame_hash = self.get_frame()
+            if (hash_ is None or frame_hash == hash_) and (not_hash is None or frame_hash != not_hash):
+                return True, seq, frame_hash
+            with self.frame_condition:
+                remaining = None if deadline is None else deadline - time.monotonic()
+                if remaining is not None and remaining <= 0:
+                    return False, seq, frame_hash
+                self.frame_condition.wait_for(lambda: self.frame_seq != seq, remaining)
+
+    def register_frame_observer(self) -> tuple[int, int]:
+        """
+        Register an observer which acknowledges the frames with ack_frame().
+        The app waits for every registered observer to acknowledge each new
+        frame before receiving its next event. Return the observer id and the
+        current frame sequence number.
+        """
+        with self.frame_condition:
+            observer = self._next_frame_observer
+            self._next_frame_observer += 1
+            self._frame_observers[observer] = self.frame_seq
+            return observer, self.frame_seq
+
+    def unregister_frame_observer(self, observer: int) -> bool:
+        with self.frame_condition:
+            if self._frame_observers.pop(observer, None) is None:
+                return False
+            self.frame_condition.notify_all()
+            return True
+
+    def ack_frame(self, observer: int, seq: int) -> bool:
+        """Acknowledge the frames up to seq, return False for an unknown observer."""
+        with self.frame_condition:
+            if observer not in self._frame_observers:
+                return False
+            self._frame_observers[observer] = max(self._frame_observers[observer], seq)
+            self.frame_condition.notify_all()
+            return True
+
+    @property
+    def has_frame_observers(self) -> bool:
+        return bool(self._frame_observers)
+
+    def wait_frame_acks(self, seq: int, timeout: float | None = None) -> bool:
+        """
+        Wait until every observer acknowledged the frame seq. The observers
+        which didn't in time are unregistered, so that an observer which is
+        gone doesn't hold every later frame.
+        """
+        with self.frame_condition:
+            if self.frame_condition.wait_for(
+                lambda: all(acked >= seq for acked in self._frame_observers.values()), timeout
+            ):
+                return True
+            for observer, acked in list(self._frame_observers.items()):
+                if acked < seq:
+                    del self._frame_observers[observer]
+            return False
 
     def update_public_screenshot(self) -> None:
         # Stax/Flex only
@@ -1,7 +1,6 @@
 import gzip
 import logging
 import sys
-import time
 from enum import IntEnum
 
 from construct import Int8ul, Int16sl, Int16ul, Struct
@@ -79,8 +78,6 @@ class NBGL(GraphicLibrary):
         )
 
     def refresh(self, data: bytes) -> bool:
-        if self.model == "apex_p":
-            time.sleep(0.1)  # Let ragger win the race with speculos
         area = nbgl_area_t.parse(data)
         self.__assert_area(area)
         # for an unknown reason, partial refreshes are not supported on NanoSP and NanoX
@@ -109,23 +109,62 @@ def _get_font_map(font: bagl_font.Font) -> Mapping[Char, BitMapChar]:
     return font_map
 
 
-class OCR:
-    # Maximum space for a letter to be considered part of the same word
-    MAX_BLANK_SPACE_NANO = 12
-    MAX_BLANK_SPACE_STAX = 24
-    MAX_BLANK_SPACE_FLEX = 26
+class GlyphIndex:
+    """
+    Reverse index of every glyph of a set of fonts, keyed by bitmap.
+
+    A bitmap sent by the app matches a glyph when the glyph bitmap starts with it and the remaining
+    bytes are all zero: sometimes (but not always) the bitmap being passed is shortened by one '\x00'
+    byte. Both conditions boil down to "same bitmap once trailing zero bytes are trimmed, and the glyph
+    is at least as long", so a lookup is a single dict access instead of a scan of every character of
+    every font.
+    """
+
+    def __init__(self, fonts: list[bagl_font.Font]):
+        # trimmed bitmap -> [(font rank, glyph length, character)], sorted by font rank
+        self._glyphs: dict[bytes, list[tuple[int, int, Char]]] = {}
+        for rank, font in enumerate(fonts):
+            for character_value, bitmap_struct in get_font_map(font).items():
+                key = bitmap_struct.bitmap.rstrip(b"\x00")
+                self._glyphs.setdefault(key, []).append((rank, len(bitmap_struct.bitmap), character_value))
+
+    def lookup(self, bitmap: BitMap) -> Char:
+        candidates = self._glyphs.get(bytes(bitmap).rstrip(b"\x00"))
+        if not candidates:
+            return ""
+
+        # The first font having at least one matching glyph wins, then the highest character in it
+        found_rank = -1
+        char = ""
+        for rank, length, character_value in candidates:
+            if length < len(bitmap):
+                continue
+            if found_rank not in (-1, rank):
+                break
+            found_rank = rank
+            char = max(char, character_value)
+
+        if char == "\x80":
+            char = " "
+        return char
+
+
+__GLYPH_INDEX: dict[tuple[int, ...], GlyphIndex] = {}
+
+
+def get_glyph_index(fonts: list[bagl_font.Font]) -> GlyphIndex:
+    """Return the glyph index of a font set, built once and shared by every OCR instance."""
+    key = tuple(font.font_id for font in fonts)
+    if key not in __GLYPH_INDEX:
+        __GLYPH_INDEX[key] = GlyphIndex(fonts)
+    return __GLYPH_INDEX[key]
 
+
+class OCR:
     def __init__(self, model: str):
         self.events: list[TextEvent] = []
         # Store the model of the device
         self.model = model
-        # Maximum space for a letter to be considered part of the same word
-        if model == "stax":
-            self.max_blank_space = OCR.MAX_BLANK_SPACE_STAX
-        elif model == "flex":
-            self.max_blank_space = OCR.MAX_BLANK_SPACE_FLEX
-        else:
-            self.max_blank_space = OCR.MAX_BLANK_SPACE_NANO
 
     @staticmethod
     def find_char_from_bitmap(bitmap: BitMap) -> str:
@@ -136,23 +175,7 @@ class OCR:
         >>> find_char_from_bitmap(char.bitmap)
         'c'
         """
-        all_values = []
-        for font in bagl_font.FONTS:
-            font_map = get_font_map(font)
-            for character_value, bitmap_struct in font_map.items():
-                if bitmap_struct.bitmap.startswith(bitmap):
-                    # sometimes (but not always) the bitmap being passed is shortened
-                    # by one '\x00' byte, not matching the exact bitmap
-                    # provided in the font. Hence the 'residual' computation
-                    residual_bytes: bytes = bitmap_struct.bitmap[len(bitmap) :]
-                    if all(b == 0 for b in residual_bytes):
-                        all_values.append(character_value)
-            if all_values:
-                char = max([x for x in all_values])
-                if char == "\x80":
-                    char = " "
-                return char
-        return ""
+        return get_glyph_index(bagl_font.FONTS).lookup(bitmap)
 
     def find_bitmap(self, x: int, y: int, w: int, h: int, bitmap: bytes) -> None:
         char = self.find_char_from_bitmap(bitmap)
@@ -164,45 +187,6 @@ class OCR:
                 # or if there is a new line
                 self.events.append(TextEvent(char, x, y, w, h, False))
 
-    def store_char_in_last_event(self, x: int, y: int, w: int, h: int, char: str) -> None:
-        """
-        Add current character to last event
-        """
-        self.events[-1].text += char
-        # Update w for all chars in self.events[-1]
-        x2 = x + w - 1
-        self.events[-1].w = x2 - self.events[-1].x + 1
-        # Update y & h, if needed, for all chars in self.events[-1]
-        y1 = y
-        if y1 > self.events[-1].y:
-            # Keep the lowest Y in Y1
-            y1 = self.events[-1].y
-        y2 = y + h - 1
-        if y2 < (self.events[-1].y + self.events[-1].h):
-            # Keep the highest Y in Y2
-            y2 = self.events[-1].y + self.events[-1].h - 1
-        self.events[-1].y = y1
-        self.events[-1].h = y2 - y1 + 1
-
-    def add_character(self, x: int, y: int, w: int, h: int, char: str) -> None:
-        """
-        Add the provided character to previous event or create a new one
-        """
-        # Compute difference with X coord from previous event
-        # if x_diff > self.max_blank_space the char is not on same sentence
-        if self.events:
-            x_diff = x - (self.events[-1].x + self.events[-1].w)
-            if x_diff < 0:
-                x_diff = -x_diff
-            # Try to find if that char can be added to previous event
-            if y < (self.events[-1].y + self.events[-1].h) and x_diff < self.max_blank_space:
-                # Add this character to previous event
-                self.store_char_in_last_event(x, y, w, h, char)
-                return
-
-        # create a new TextEvent if there are no events yet or if there is a new line
-        self.events.append(TextEvent(char, x, y, w, h, False))
-
     def add_text(self, text: str, x: int, y: int, w: int, h: int) -> None:
         """
         Add a line of text as a TextEvent, to be sent to the client
@@ -212,9 +196,10 @@ class OCR:
     def analyze_bitmap(self, data: bytes, use_bagl: bool) -> None:
         """
         data contain information about the latest displayed bitmap.
-        Since unified SDK, speculos added the displayed character to data.
-        For older SKD versions, legacy behaviour is used: parsing internal
-        fonts to find a matching bitmap.
+        Since unified SDK, the launcher resolves the displayed character itself
+        and sends whole lines of text (SephTag.SPECULOS_TEXT_EVENT): nothing to
+        do here. For older SKD versions, legacy behaviour is used: parsing
+        internal fonts to find a matching bitmap.
         """
         if not use_bagl:
             # Can be called via SephTag.NBGL_DRAW_IMAGE or SephTag.NBGL_DRAW_IMAGE_RLE
@@ -245,16 +230,12 @@ class OCR:
             if (len(bitmap) * 8) % w:
                 h += 1
 
-        # Space is now encoded as an empty character (no 'space' wasted :)
-        if len(bitmap) == 0:
-            character = 32
+        # Space is encoded as an empty character, and characters found by the
+        # launcher are already part of its text events
+        if len(bitmap) == 0 or character != 0:
+            return
 
-        # If data contains a character, don't bother doing OCR, just store it!
-        if character != 0:
-            char = chr(character)
-            self.add_character(x, y, w, h, char)
-        else:
-            self.find_bitmap(x, y, w, h, bitmap)
+        self.find_bitmap(x, y, w, h, bitmap)
 
     def get_events(self) -> list[TextEvent]:
         events = self.events.copy()
@@ -4,7 +4,7 @@ from dataclasses import dataclass
 from enum import IntEnum
 
 from PyQt6.QtCore import QEvent, QRect, QSettings, QSocketNotifier, Qt
-from PyQt6.QtGui import QColor, QIcon, QKeyEvent, QMouseEvent, QPainter, QPixmap
+from PyQt6.QtGui import QColor, QIcon, QImage, QKeyEvent, QMouseEvent, QPainter, QPaintEvent
 from PyQt6.QtWidgets import QApplication, QMainWindow, QWidget
 from PyQt6.sip import voidptr
 
@@ -106,55 +106,73 @@ class PaintWidget(FrameBuffer, QWidget):
         QWidget.__init__(self, parent)
         FrameBuffer.__init__(self, model)
         self.pixel_size = pixel_size
-        self.mPixmap = QPixmap()
+        # Content of the screen, the pixels drawn are written in place on update
+        self.image = QImage(self._width, self._height, QImage.Format.Format_RGB32)
+        self.image.fill(Qt.GlobalColor.white)
         self.vnc = vnc
 
-    def paintEvent(self, event: QEvent):
-        if self.pixels or self.draw_default_color:
-            pixmap = QPixmap(self.size() / self.pixel_size)
-            pixmap.fill(Qt.GlobalColor.white)
-            painter = QPainter(pixmap)
-            painter.drawPixmap(0, 0, self.mPixmap)
-            self._redraw(painter)
-            self.mPixmap = pixmap
-            self.pixels = {}
-            self.draw_default_color = False
+    def paintEvent(self, event: QPaintEvent):
+        # Only blit the exposed part of the screen, scaled without filtering
+        rect = event.rect()
+        x0 = rect.left() // self.pixel_size
+        y0 = rect.top() // self.pixel_size
+        x1 = min(rect.right() // self.pixel_size + 1, self._width)
+        y1 = min(rect.bottom() // self.pixel_size + 1, self._height)
+        if x0 >= x1 or y0 >= y1:
+            return
 
+        source = QRect(x0, y0, x1 - x0, y1 - y0)
+        target = QRect(source.topLeft() * self.pixel_size, source.size() * self.pixel_size)
         qp = QPainter(self)
-        copied_pixmap = self.mPixmap
-        if self.pixel_size != 1:
-            # Only call scaled if needed.
-            copied_pixmap = self.mPixmap.scaled(
-                self.mPixmap.width() * self.pixel_size,
-                self.mPixmap.height() * self.pixel_size,
-            )
-        qp.drawPixmap(0, 0, copied_pixmap)
+        qp.drawImage(target, self.image, source)
 
     def update(
         self,  # type: ignore[override]
-        x: int | None = None,
-        y: int | None = None,
-        w: int | None = None,
-        h: int | None = None,
+        _0: int | None = None,
+        _1: int | None = None,
+        _2: int | None = None,
+        _3: int | None = None,
     ) -> bool:
-        if x and y and w and h:
-            QWidget.update(self, QRect(x, y, w, h))
-        else:
-            QWidget.update(self)
-        return self.pixels != {}
-
-    def _redraw(self, qp):
+        if not self.pixels and not self.draw_default_color:
+            return False
+
+        dirty = self._redraw()
+        self.pixels = {}
+        self.draw_default_color = False
+        if dirty is not None:
+            x, y, w, h = dirty
+            QWidget.update(self, QRect(x * self.pixel_size, y * self.pixel_size, w * self.pixel_size, h * self.pixel_size))
+        return True
+
+    def _redraw(self) -> tuple[int, int, int, int] | None:
+        """Write the pixels drawn into the image, and return the rectangle which changed."""
+        dirty = None
         if self.draw_default_color:
-            qp.fillRect(0, 0, self._width, self._height, QColor.fromRgb(self.default_color))
-
-        for (x, y), color in self.pixels.items():
-            qp.setPen(QColor.fromRgb(color))
-            qp.drawPoint(x, y)
+            self.image.fill(0xFF000000 | self.default_color)
+            dirty = (0, 0, self._width, self._height)
+
+        changed = [(x, y) for (x, y) in self.pixels if 0 <= x < self._width and 0 <= y < self._height]
+        if changed:
+            bits = self.image.bits()
+            bits.setsize(self.image.sizeInBytes())
+            image = memoryview(bits).cast("I")
+            stride = self.image.bytesPerLine() // 4
+            for x, y in changed:
+                image[y * stride + x] = 0xFF000000 | self.pixels[(x, y)]
+            image.release()
+
+            if dirty is None:
+                x0 = min(x for x, _ in changed)
+                y0 = min(y for _, y in changed)
+                w = max(x for x, _ in changed) - x0 + 1
+                h = max(y for _, y in changed) - y0 + 1
+                dirty = (x0, y0, w, h)
 
         if self.vnc is not None:
             self.vnc.redraw(self.pixels, self.default_color)
 
         self.update_screenshot()
+        return dirty
 
 
 class App(QMainWindow):
@@ -0,0 +1,56 @@
+"""
+Capture of the display packets sent by the app, enabled with --seph-capture.
+
+The capture can be replayed without the app, for instance to benchmark the
+rendering (see tools/render-bench.py). The file starts with a header (magic,
+model name) followed by the packets, integers being big-endian:
+
+- header: magic (8 bytes), model name length (u8), model name,
+- packet: tag (u8), length (u32), payload.
+"""
+
+import struct
+from pathlib import Path
+
+CAPTURE_MAGIC = b"SPECSEPH"
+CAPTURE_HEADER = struct.Struct(">8sB")
+PACKET_HEADER = struct.Struct(">BI")
+
+
+class SephCapture:
+    def __init__(self, path: str | Path, model: str) -> None:
+        self._file = open(path, "wb")  # noqa: SIM115
+        self._file.write(CAPTURE_HEADER.pack(CAPTURE_MAGIC, len(model)) + model.encode())
+
+    def write(self, tag: int, data: bytes | memoryview) -> None:
+        self._file.write(PACKET_HEADER.pack(tag, len(data)))
+        self._file.write(data)
+        # speculos is usually stopped with a signal, don't lose the last frames
+        self._file.flush()
+
+    def close(self) -> None:
+        self._file.close()
+
+
+def read_capture(path: str | Path) -> tuple[str, list[tuple[int, bytes]]]:
+    """Return the model and the (tag, payload) packets of a capture."""
+
+    data = Path(path).read_bytes()
+    magic, model_len = CAPTURE_HEADER.unpack_from(data)
+    if magic != CAPTURE_MAGIC:
+        raise ValueError(f"{path} isn't a SEPH capture")
+    offset = CAPTURE_HEADER.size
+    model = data[offset : offset + model_len].decode()
+    offset += model_len
+
+    packets = []
+    # The last packet is incomplete if speculos was killed while writing it
+    while offset + PACKET_HEADER.size <= len(data):
+        tag, size = PACKET_HEADER.unpack_from(data, offset)
+        offset += PACKET_HEADER.size
+        if offset + size > len(data):
+            break
+        packets.append((tag, data[offset : offset + size]))
+        offset += size
+
+    return model, packets
@@ -1,25 +1,33 @@
+from __future__ import annotations
+
 import logging
 import os
 import struct
 import sys
 import threading
 import time
-from collections import namedtuple
+from collections import deque, namedtuple
 from collections.abc import Callable
 from enum import IntEnum
 from pathlib import Path
 from socket import socket
+from typing import TYPE_CHECKING
 
 from speculos.observer import BroadcastInterface, TextEvent
+from speculos.startup_profile import profile as startup_profile
 
-from .automation import Automation
-from .display import DisplayNotifier, IODevice
+from .apdu import ApduArbiter
+from .display import Display, DisplayNotifier, IODevice
 from .nbgl import NBGL
 from .nbgl_serialize import deserialize_nbgl_bytes
 from .ocr import OCR
 from .readerror import ReadError
 from .transport import TransportType, build_transport
 
+if TYPE_CHECKING:
+    from .automation import Automation
+    from .seph_capture import SephCapture
+
 
 class SephTag(IntEnum):
     BUTTON_PUSH_EVENT = 0x05
@@ -60,6 +68,9 @@ class SephTag(IntEnum):
     BAGL_DRAW_RECT = 0xF1
     BAGL_DRAW_BITMAP = 0xF2
 
+    # Speculos only, defined in speculos/src/bolos/text_events.c
+    SPECULOS_TEXT_EVENT = 0xF3
+
     # Speculos only, defined in speculos/src/bolos/nbgl.c
     NBGL_DRAW_HORIZONTAL_LINE = 0xF9
     NBGL_DRAW_RECT = 0xFA
@@ -71,8 +82,30 @@ class SephTag(IntEnum):
     NBGL_SERIALIZED_EVENT = 0x5C
 
 
+# Packets drawing on the screen, handled by DisplayPackets
+DISPLAY_TAGS = {
+    SephTag.SCREEN_DISPLAY_STATUS,
+    SephTag.DBG_SCREEN_DISPLAY_STATUS,
+    SephTag.SCREEN_DISPLAY_RAW_STATUS,
+    SephTag.BAGL_DRAW_RECT,
+    SephTag.BAGL_DRAW_BITMAP,
+    SephTag.NBGL_DRAW_HORIZONTAL_LINE,
+    SephTag.NBGL_DRAW_RECT,
+    SephTag.NBGL_REFRESH,
+    SephTag.NBGL_DRAW_LINE,
+    SephTag.NBGL_DRAW_IMAGE,
+    SephTag.NBGL_DRAW_IMAGE_FILE,
+    SephTag.NBGL_DRAW_IMAGE_RLE,
+}
+
+# Packets recorded by --seph-capture: everything needed to replay the display
+CAPTURED_TAGS = DISPLAY_TAGS | {SephTag.GENERAL_STATUS}
+
 TICKER_DELAY = 0.1
 
+# Maximum time the app waits for the frame observers to acknowledge a frame
+FRAME_ACK_TIMEOUT = 5.0
+
 RenderMethods = namedtuple("RenderMethods", "PROGRESSIVE FLUSHED")
 RENDER_METHOD = RenderMethods(0, 1)
 
@@ -105,31 +138,41 @@ class TimeTickerDaemon(threading.Thread):
         """
         Pause time emulation done by the daemon, no ticker event will be sent until resume
         """
-        self.paused = True
+        with self._resume_cond:
+            self.paused = True
+
+        # Not started yet (the app isn't ready): no tick has been sent, and the
+        # thread will honor the pause as soon as it starts
+        if not self.is_alive():
+            return
 
         # Wait until the daemon is really paused before returning.
         # To make sure last daemon tick has been sent and fully processed.
-        while not self._paused:
-            time.sleep(0.1)
+        with self._resume_cond:
+            while self.paused and not self._paused:
+                self._resume_cond.wait()
 
     def resume(self):
         """
         Resume time emulation done by the daemon
         """
-        self.paused = False
         with self._resume_cond:
-            self._resume_cond.notify()
+            self.paused = False
+            self._resume_cond.notify_all()
 
     def _wait_if_time_paused(self):
         """
         Internal function to handle the pause
         """
-        while self.paused:
-            self.wait_until_tick_is_processed()
-            self._paused = True
-            with self._resume_cond:
+        if not self.paused:
+            return
+        self.wait_until_tick_is_processed()
+        with self._resume_cond:
+            while self.paused:
+                self._paused = True
+                self._resume_cond.notify_all()
                 self._resume_cond.wait()
-        self._paused = False
+            self._paused = False
 
     def run(self):
         """
@@ -141,52 +184,120 @@ class TimeTickerDaemon(threading.Thread):
             time.sleep(TICKER_DELAY)
 
 
+# A packet is a tag (1 byte), a big-endian size (2 bytes) and a payload
+PACKET_HEADER_SIZE = 3
+MAX_PACKET_SIZE = PACKET_HEADER_SIZE + 0xFFFF
+
+
+class PacketReader:
+    """
+    Read the packets sent by the app through a buffer allocated once.
+
+    Data is received with recv_into() straight into the buffer, and each packet
+    is handed out as a memoryview of its payload. A view is only valid until the
+    next call to read_packets().
+    """
+
+    def __init__(self, sock: socket, size: int = 4 * MAX_PACKET_SIZE):
+        self.socket = sock
+        self.buffer = bytearray(size)
+        self.view = memoryview(self.buffer)
+        # Received data which wasn't handed out yet is buffer[start:end]
+        self.start = 0
+        self.end = 0
+        self.logger = logging.getLogger("seproxyhal.packet")
+
+    def _fill(self) -> bool:
+        """Receive available data, return False once the socket is closed."""
+
+        if self.start == self.end:
+            self.start = self.end = 0
+        elif len(self.buffer) - self.end < MAX_PACKET_SIZE:
+            # Move the incomplete packet to the beginning of the buffer
+            size = self.end - self.start
+            self.view[:size] = self.view[self.start : self.end]
+            self.start, self.end = 0, size
+
+        try:
+            size = self.socket.recv_into(self.view[self.end :])
+        except ConnectionResetError:
+            size = 0
+
+        if size == 0:
+            self.logger.debug("fd closed")
+            return False
+        self.end += size
+        return True
+
+    def _next_packet(self) -> tuple[int, memoryview] | None:
+        available = self.end - self.start
+        if available < PACKET_HEADER_SIZE:
+            return None
+        tag = self.buffer[self.start]
+        size = int.from_bytes(self.view[self.start + 1 : self.start + PACKET_HEADER_SIZE], "big")
+        if available < PACKET_HEADER_SIZE + size:
+            return None
+        offset = self.start + PACKET_HEADER_SIZE
+        self.start = offset + size
+        return tag, self.view[offset : self.start]
+
+    def read_packets(self) -> list[tuple[int, memoryview]] | None:
+        """
+        Return every complete packet received so far, waiting for at least one.
+        Return None once the socket is closed.
+        """
+
+        packets: list[tuple[int, memoryview]] = []
+        while not packets:
+            if not self._fill():
+                return None
+            while (packet := self._next_packet()) is not None:
+                packets.append(packet)
+        return packets
+
+
+# Maximum number of packets in the input lane. Other threads queuing packets
+# wait for the app to catch up beyond that.
+MAX_QUEUED_INPUTS = 4096
+
+
 class SocketHelper(threading.Thread):
-    def __init__(self, sock: socket, status_event: threading.Event, *args, **kwargs):
+    """
+    Send the packets queued by the other threads to the app, one after each
+    status received from the app.
+
+    Packets are taken from 3 lanes, in this order: the priority lane (events
+    which must be answered before any other), the input lane (buttons, fingers
+    and APDUs, in the order they were queued) and the tick lane (a single
+    pending ticker event).
+    """
+
+    def __init__(self, sock: socket, *args, **kwargs):
         super().__init__(name="packet", daemon=True)
         self.socket = sock
+        self.reader = PacketReader(sock)
         self.sending_lock = threading.Lock()
+        # Protects the lanes, status_received and tick_requested
         self.queue_condition = threading.Condition()
-        self.queue: list[tuple[SephTag, bytes]] = []
-        self.status_event = status_event
+        self.priority_lane: deque[tuple[SephTag, bytes]] = deque()
+        self.input_lane: deque[tuple[SephTag, bytes]] = deque()
+        self.tick_requested = False
+        # The app is waiting for an event
+        self.status_received = False
+        # Called before sending the next event, to hold the app meanwhile
+        self.barrier: Callable[[], None] | None = None
+        # Thread reading the packets of the app, which must never wait for it
+        self.reader_thread: int | None = None
         self.logger = logging.getLogger("seproxyhal.packet")
         self.stop = False
         self.ticks_count = 0
-        self.tick_requested = False
-
-    def _recvall(self, size: int):
-        data = b""
-        while size > 0:
-            try:
-                tmp = self.socket.recv(size)
-            except ConnectionResetError:
-                tmp = b""
-
-            if len(tmp) == 0:
-                self.logger.debug("fd closed")
-                return None
-            data += tmp
-            size -= len(tmp)
-        return data
 
     def get_tick_count(self):
         return self.ticks_count
 
-    def read_packet(self):
-        data = self._recvall(3)
-        if data is None:
-            return None, None, None
-
-        tag = data[0]
-        size = int.from_bytes(data[1:3], "big")
-
-        data = self._recvall(size)
-        if data is None:
-            return None, None, None
-        if len(data) != size:
-            raise ValueError("Data length does not match expected size")
-
-        return tag, size, data
+    def read_packets(self) -> list[tuple[int, memoryview]] | None:
+        self.reader_thread = threading.get_ident()
+        return self.reader.read_packets()
 
     def send_packet(self, tag: SephTag, data: bytes = b""):
         """Send a packet to the app."""
@@ -206,64 +317,193 @@ class SocketHelper(threading.Thread):
         """
         Append a packet to the queue of packets to be sent.
 
-        This function is meant to called by other threads.
+        This function is meant to called by other threads. If the app doesn't
+        keep up, they wait until the input lane has room again, except for the
+        thread reading the packets of the app (which must keep handling them).
         """
 
-        if not priority:
-            self.queue.append((tag, data))
-        else:
-            # Some status packets expect a specific event to be answered before
-            # any other events. Put it at the beginning of the queue.
-            self.queue.insert(0, (tag, data))
+        with self.queue_condition:
+            if priority:
+                # Some status packets expect a specific event to be answered before
+                # any other events.
+                self.priority_lane.append((tag, data))
+            else:
+                if threading.get_ident() != self.reader_thread:
+                    while len(self.input_lane) >= MAX_QUEUED_INPUTS and not self.stop:
+                        self.queue_condition.wait()
+                self.input_lane.append((tag, data))
+
+            # notify this thread that a new packet is available
+            self.queue_condition.notify_all()
+
+    def on_status(self, barrier: Callable[[], None] | None = None):
+        """
+        Called when the app sent a status: it is waiting for the next event.
+        If set, barrier is called by this thread before sending that event.
+        """
 
-        # notify this thread that a new packet is available
         with self.queue_condition:
-            self.queue_condition.notify()
+            self.status_received = True
+            self.barrier = barrier
+            self.queue_condition.notify_all()
 
     def wait_until_tick_is_processed(self):
         # Wait until the app has finished processing the tick
-        while self.tick_requested or self.queue or not self.status_event.is_set():
-            self.status_event.wait()
+        with self.queue_condition:
+            while self.tick_requested or self.priority_lane or self.input_lane or not self.status_received:
+                self.queue_condition.wait()
+
+    def wait_ticks(self, count: int):
+        """Wait until count more ticks have been sent to the app."""
+
+        with self.queue_condition:
+            end = self.ticks_count + count
+            while self.ticks_count < end and not self.stop:
+                self.queue_condition.wait()
 
     def add_tick(self, wait_until_tick_is_processed=False):
         """Request sending of a ticker event to the app"""
-        self.tick_requested = True
 
-        # notify this thread that a new event is available
         with self.queue_condition:
-            self.queue_condition.notify()
+            self.tick_requested = True
+            # notify this thread that a new event is available
+            self.queue_condition.notify_all()
 
         if wait_until_tick_is_processed:
             self.wait_until_tick_is_processed()
 
-    def run(self):
-        while not self.stop:
-            # wait for a event in the queue or a tick to be available
-            with self.queue_condition:
-                while len(self.queue) == 0 and not self.tick_requested:
-                    self.queue_condition.wait()
-
-            # wait for a status notification
-            while not self.status_event.is_set():
-                self.status_event.wait()
-            self.status_event.clear()
-
-            if len(self.queue):
-                tag, data = self.queue.pop(0)
-            elif self.tick_requested:
-                tag, data = SephTag.TICKER_EVENT, b""
-            else:
-                raise RuntimeError("Unexpected state: no ticker nor event to send on socket")
+    def _next_packet(self) -> tuple[SephTag, bytes]:
+        """Wait for the app to be ready and for a packet, and dequeue it."""
 
-            self.send_packet(tag, data)
+        with self.queue_condition:
+            while not (self.status_received and (self.priority_lane or self.input_lane or self.tick_requested)):
+                self.queue_condition.wait()
+            barrier, self.barrier = self.barrier, None
 
-            if tag == SephTag.TICKER_EVENT:
-                self.ticks_count += 1
+        if barrier is not None:
+            barrier()
+
+        with self.queue_condition:
+            self.status_received = False
+
+            if self.priority_lane:
+                packet = self.priority_lane.popleft()
+            elif self.input_lane:
+                packet = self.input_lane.popleft()
+            else:
+                packet = SephTag.TICKER_EVENT, b""
                 self.tick_requested = False
+                self.ticks_count += 1
+            # wake up the threads waiting for room in the input lane
+            self.queue_condition.notify_all()
+            return packet
+
+    def run(self):
+        while not self.stop:
+            tag, data = self._next_packet()
+            self.send_packet(tag, data)
 
+        # don't leave threads waiting for room in the input lane
+        with self.queue_condition:
+            self.queue_condition.notify_all()
         self.logger.debug("exiting")
 
 
+class DisplayPackets:
+    """
+    Draw the display packets sent by the app. Shared by SeProxyHal.handle_packet() and the replay of captured
+    packets (tools/render-bench.py), which doesn't analyze the text of the screen (ocr is None).
+    """
+
+    def __init__(self, ocr: OCR | None = None) -> None:
+        self.ocr = ocr
+        self.need_nbgl_refresh = False
+        self.is_last_draw_nbgl = False
+        self.nbgl_speculos_text_lines_enabled = False
+
+    def status(self, display: Display) -> list[TextEvent]:
+        """Update the screen once the app is done drawing, and return the text events of the new screen."""
+
+        if self.need_nbgl_refresh:
+            self.need_nbgl_refresh = False
+
+            # Update the screenshot, we'll upload its associated events shortly
+            display.nbgl_gl.update_screenshot()
+            display.nbgl_gl.update_public_screenshot()
+
+        if self.is_last_draw_nbgl is False and display.screen_update():
+            if self.ocr is not None and display.model in ["nanox", "nanosp"]:
+                return self.ocr.get_events()
+        elif self.is_last_draw_nbgl and self.ocr is not None:
+            return self.ocr.get_events()
+        return []
+
+    def draw(self, display: Display, tag: int, data: bytes) -> list[TextEvent]:
+        """Handle one of DISPLAY_TAGS, and return the text events drawn."""
+
+        if tag in [
+            SephTag.SCREEN_DISPLAY_STATUS,
+            SephTag.DBG_SCREEN_DISPLAY_STATUS,
+            SephTag.BAGL_DRAW_RECT,
+        ]:
+            self.is_last_draw_nbgl = False
+            if display.model not in ["nanox", "nanosp"] or tag == SephTag.BAGL_DRAW_RECT:
+                return display.display_status(data)
+
+        elif tag in [SephTag.SCREEN_DISPLAY_RAW_STATUS, SephTag.BAGL_DRAW_BITMAP]:
+            display.display_raw_status(data)
+            self.is_last_draw_nbgl = False
+            if self.ocr is not None and display.model in ["nanox", "nanosp"]:
+                self.ocr.analyze_bitmap(data, True)
+            if display.rendering == RENDER_METHOD.PROGRESSIVE:
+                display.screen_update()
+
+        elif tag == SephTag.NBGL_REFRESH:
+            display.nbgl_gl.refresh(data)
+            # Stax/Flex only
+            # We have need_nbgl_refresh the screen, remember it for the next time we have SephTag.GENERAL_STATUS
+            # then we'll perform a screen update and make public the resulting screenshot
+            self.need_nbgl_refresh = True
+            self.is_last_draw_nbgl = True
+
+        else:
+            nbgl = display.nbgl_gl
+            if not isinstance(nbgl, NBGL):
+                raise ValueError("Display is not an instance of NBGL")
+
+            if tag == SephTag.NBGL_DRAW_RECT:
+                return nbgl.hal_draw_rect(data)
+
+            elif tag == SephTag.NBGL_DRAW_HORIZONTAL_LINE:
+                nbgl.hal_draw_horizontal_line(data)
+
+            elif tag == SephTag.NBGL_DRAW_LINE:
+                nbgl.hal_draw_line(data)
+
+            elif tag in [SephTag.NBGL_DRAW_IMAGE, SephTag.NBGL_DRAW_IMAGE_RLE]:
+                # Do not analyze raw image,
+                # if the text was already sent through a NBGL text line event.
+                if self.ocr is not None and self.nbgl_speculos_text_lines_enabled is False:
+                    self.ocr.analyze_bitmap(data, False)
+                if tag == SephTag.NBGL_DRAW_IMAGE:
+                    nbgl.hal_draw_image(data)
+                else:
+                    nbgl.hal_draw_image_rle(data)
+
+            elif tag == SephTag.NBGL_DRAW_IMAGE_FILE:
+                nbgl.hal_draw_image_file(data)
+
+        return []
+
+    def replay(self, display: Display, tag: int, data: bytes) -> None:
+        """Handle a packet recorded with --seph-capture (see CAPTURED_TAGS)."""
+
+        if tag != SephTag.GENERAL_STATUS:
+            self.draw(display, tag, data)
+        elif int.from_bytes(data[:2], "big") == SephTag.GENERAL_STATUS_LAST_COMMAND:
+            self.status(display)
+
+
 class SeProxyHal(IODevice):
     def __init__(
         self,
@@ -282,26 +522,31 @@ class SeProxyHal(IODevice):
         self.automation = automation
         self.automation_server = automation_server
         self.events: list[TextEvent] = []
-        self.need_nbgl_refresh = False
-        self.is_last_draw_nbgl = False
-        self.nbgl_speculos_text_lines_enabled = False
         self.current_nbgl_text_line = ""
         self.verbose = verbose
         self.sound = sound
+        # Last frame the frame observers were waited for
+        self.barrier_frame_seq = 0
 
-        self.status_event = threading.Event()
-        self.socket_helper = SocketHelper(self._socket, self.status_event)
+        self.socket_helper = SocketHelper(self._socket)
         self.socket_helper.start()
 
+        # Started once the app is ready, on its first status
         self.time_ticker_thread = TimeTickerDaemon(self.socket_helper.add_tick, self.socket_helper.wait_until_tick_is_processed)
-        self.time_ticker_thread.start()
+        self.time_ticker_started = False
 
         self.transport = build_transport(self.socket_helper.queue_packet, transport)
 
         self.ocr = OCR(model)
+        self.display_packets = DisplayPackets(self.ocr)
 
         # A list of callback methods when an APDU response is received
         self.apdu_callbacks: list[Callable[[bytes], None]] = []
+        # Shared by the APDU transports, which exchange APDUs with the app in turn
+        self.apdu_arbiter = ApduArbiter()
+
+        # Display packets are recorded there if set
+        self.capture: SephCapture | None = None
 
     @property
     def file(self):
@@ -311,8 +556,10 @@ class SeProxyHal(IODevice):
         if self.automation_server:
             self.automation_server.broadcast(event)
 
-        if self.automation:
-            actions = self.automation.get_actions(event.text, event.x, event.y)
+        # The rules may be replaced through the REST API at any time
+        automation = self.automation
+        if automation:
+            actions = automation.get_actions(event.text, event.x, event.y)
             for action in actions:
                 self.logger.debug(f"applying automation {action}")
                 key, args = action[0], action[1:]
@@ -321,13 +568,30 @@ class SeProxyHal(IODevice):
                 elif key == "finger":
                     self.handle_finger(*args)
                 elif key == "setbool":
-                    self.automation.set_bool(*args)
+                    automation.set_bool(*args)
                 elif key == "exit":
                     self.file.close()
                     sys.exit(0)
                 else:
                     raise AssertionError()
 
+    def _frame_barrier(self, screen: DisplayNotifier) -> Callable[[], None] | None:
+        """
+        Return a function waiting for the frame observers to acknowledge the
+        frame committed since the previous status, if any.
+        """
+        fb = screen.display.m
+        seq = fb.frame_seq
+        if seq == self.barrier_frame_seq or not fb.has_frame_observers:
+            return None
+        self.barrier_frame_seq = seq
+
+        def barrier() -> None:
+            if not fb.wait_frame_acks(seq, FRAME_ACK_TIMEOUT):
+                self.logger.warning(f"frame {seq} wasn't acknowledged by every observer, the late ones were unregistered")
+
+        return barrier
+
     def apply_automation(self):
         for event in self.events:
             self.apply_automation_helper(event)
@@ -343,27 +607,30 @@ class SeProxyHal(IODevice):
 
         This function is called thanks to a screen QSocketNotifier.
         """
-        tag, size, data = self.socket_helper.read_packet()
-        if data is None:
+        packets = self.socket_helper.read_packets()
+        if packets is None:
             self._cleanup(screen)
             raise ReadError("fd closed")
 
-        self.logger.debug(f"received (tag: {tag:#04x}, size: {size:#04x}): {data!r}")
+        # Handle every packet received since the last wakeup
+        for tag, view in packets:
+            if self.capture is not None and tag in CAPTURED_TAGS:
+                self.capture.write(tag, view)
+            # The handlers may keep the payload, copy it out of the reader buffer
+            self.handle_packet(screen, tag, bytes(view))
+
+    def handle_packet(self, screen: DisplayNotifier, tag: int, data: bytes):
+        # Don't format large payloads unless debug logs are enabled
+        self.logger.debug("received (tag: %#04x, size: %#04x): %r", tag, len(data), data)
 
         if tag == SephTag.GENERAL_STATUS:
             if int.from_bytes(data[:2], "big") == SephTag.GENERAL_STATUS_LAST_COMMAND:
-                if self.need_nbgl_refresh:
-                    self.need_nbgl_refresh = False
+                if not self.time_ticker_started:
+                    self.time_ticker_started = True
+                    startup_profile.mark("app_ready")
+                    self.time_ticker_thread.start()
 
-                    # Update the screenshot, we'll upload its associated events shortly
-                    screen.display.nbgl_gl.update_screenshot()
-                    screen.display.nbgl_gl.update_public_screenshot()
-
-                if self.is_last_draw_nbgl is False and screen.display.screen_update():
-                    if screen.display.model in ["nanox", "nanosp"]:
-                        self.events += self.ocr.get_events()
-                elif self.is_last_draw_nbgl:
-                    self.events += self.ocr.get_events()
+                self.events += self.display_packets.status(screen.display)
 
                 # Apply automation rules after having received a GENERAL_STATUS_LAST_COMMAND tag. It allows the
                 # screen to be updated before broadcasting the events.
@@ -371,38 +638,20 @@ class SeProxyHal(IODevice):
                     self.apply_automation()
 
                 # signal the sending thread that a status has been received
-                self.status_event.set()
+                self.socket_helper.on_status(self._frame_barrier(screen))
 
             else:
                 self.logger.error(f"unknown subtag: {data[:2]!r}")
                 sys.exit(0)
 
-        elif tag in [
-            SephTag.SCREEN_DISPLAY_STATUS,
-            SephTag.DBG_SCREEN_DISPLAY_STATUS,
-            SephTag.BAGL_DRAW_RECT,
-        ]:
-            self.logger.debug(f"DISPLAY_STATUS {data!r}")
-            self.is_last_draw_nbgl = False
-            if screen.display.model not in ["nanox", "nanosp"] or tag == SephTag.BAGL_DRAW_RECT:
-                events = screen.display.display_status(data)
-                self.events += events
-            if tag != SephTag.BAGL_DRAW_RECT:
-                self.socket_helper.send_packet(SephTag.DISPLAY_PROCESSED_EVENT)
-
-        elif tag in [SephTag.SCREEN_DISPLAY_RAW_STATUS, SephTag.BAGL_DRAW_BITMAP]:
-            self.logger.debug("SephTag.SCREEN_DISPLAY_RAW_STATUS")
-            screen.display.display_raw_status(data)
-            self.is_last_draw_nbgl = False
-            if screen.display.model in ["nanox", "nanosp"]:
-                self.ocr.analyze_bitmap(data, True)
-            if tag != SephTag.BAGL_DRAW_BITMAP:
+        elif tag in DISPLAY_TAGS:
+            self.events += self.display_packets.draw(screen.display, tag, data)
+            # The app waits for this event after each element, unlike the Speculos only tags
+            if tag in [SephTag.SCREEN_DISPLAY_STATUS, SephTag.DBG_SCREEN_DISPLAY_STATUS, SephTag.SCREEN_DISPLAY_RAW_STATUS]:
                 self.socket_helper.send_packet(SephTag.DISPLAY_PROCESSED_EVENT)
-            if screen.display.rendering == RENDER_METHOD.PROGRESSIVE:
-                screen.display.screen_update()
 
         elif tag == SephTag.NBGL_SEND_SPECULOS_TEXT_LINE:
-            self.nbgl_speculos_text_lines_enabled = True
+            self.display_packets.nbgl_speculos_text_lines_enabled = True
             # Extract text content
             text = data[:-8].decode()
             # Extract coordinates
@@ -410,6 +659,12 @@ class SeProxyHal(IODevice):
             x, y, w, h = struct.unpack(">4H", coordinates)
             self.ocr.add_text(text, x, y, w, h)
 
+        elif tag == SephTag.SPECULOS_TEXT_EVENT:
+            # Line of text built by the launcher from the characters drawn by the app
+            text = data[:-8].decode()
+            x, y, w, h = struct.unpack(">2h2H", data[-8:])
+            self.ocr.add_text(text, x, y, w, h)
+
         elif tag == SephTag.PRINTF_STATUS or tag == SephTag.PRINTC_STATUS:
             for b in [chr(b) for b in data]:
                 if b == "\n":
@@ -500,52 +755,6 @@ class SeProxyHal(IODevice):
             event = deserialize_nbgl_bytes(is_stax, data)
             self.logger.info(event)
 
-        elif tag == SephTag.NBGL_DRAW_RECT:
-            if not isinstance(screen.display.nbgl_gl, NBGL):
-                raise ValueError("Display is not an instance of NBGL")
-            self.events += screen.display.nbgl_gl.hal_draw_rect(data)
-
-        elif tag == SephTag.NBGL_REFRESH:
-            screen.display.nbgl_gl.refresh(data)
-            # Stax/Flex only
-            # We have need_nbgl_refresh the screen, remember it for the next time we have SephTag.GENERAL_STATUS
-            # then we'll perform a screen update and make public the resulting screenshot
-            self.need_nbgl_refresh = True
-            self.is_last_draw_nbgl = True
-
-        elif tag == SephTag.NBGL_DRAW_HORIZONTAL_LINE:
-            if not isinstance(screen.display.nbgl_gl, NBGL):
-                raise ValueError("Display is not an instance of NBGL")
-            screen.display.nbgl_gl.hal_draw_horizontal_line(data)
-
-        elif tag == SephTag.NBGL_DRAW_LINE:
-            if not isinstance(screen.display.nbgl_gl, NBGL):
-                raise ValueError("Display is not an instance of NBGL")
-            screen.display.nbgl_gl.hal_draw_line(data)
-
-        elif tag == SephTag.NBGL_DRAW_IMAGE:
-            if not isinstance(screen.display.nbgl_gl, NBGL):
-                raise ValueError("Display is not an instance of NBGL")
-            # Do not analyze raw image,
-            # if the text was already sent through a NBGL text line event.
-            if self.nbgl_speculos_text_lines_enabled is False:
-                self.ocr.analyze_bitmap(data, False)
-            screen.display.nbgl_gl.hal_draw_image(data)
-
-        elif tag == SephTag.NBGL_DRAW_IMAGE_RLE:
-            if not isinstance(screen.display.nbgl_gl, NBGL):
-                raise ValueError("Display is not an instance of NBGL")
-            # Do not analyze raw image,
-            # if the text was already sent through a NBGL text line event.
-            if self.nbgl_speculos_text_lines_enabled is False:
-                self.ocr.analyze_bitmap(data, False)
-            screen.display.nbgl_gl.hal_draw_image_rle(data)
-
-        elif tag == SephTag.NBGL_DRAW_IMAGE_FILE:
-            if not isinstance(screen.display.nbgl_gl, NBGL):
-                raise ValueError("Display is not an instance of NBGL")
-            screen.display.nbgl_gl.hal_draw_image_file(data)
-
         elif tag == SephTag.NFC_RAPDU:
             data = self.transport.handle_rapdu(data)
             if data is not None:
@@ -597,9 +806,7 @@ class SeProxyHal(IODevice):
         """Wait for a specified delay, taking account real time seen by the app."""
         expected_ticks = int(delay / TICKER_DELAY)
         if not self.time_ticker_thread.paused:
-            start = self.socket_helper.ticks_count
-            while (self.socket_helper.ticks_count - start) < expected_ticks:
-                time.sleep(TICKER_DELAY)
+            self.socket_helper.wait_ticks(expected_ticks)
         else:
             for _ in range(expected_ticks):
                 self.time_ticker_thread.add_tick(wait_until_tick_is_processed=True)
@@ -0,0 +1,587 @@
+"""
+Pool of warm emulators, started with `speculos pool`.
+
+The daemon keeps a number of ready instances for each (app, model, seed) which
+has been requested, each with its own API and APDU ports, and leases them to
+clients over a small HTTP API (JSON):
+
+- POST /leases {"app", "model", "seed", "timeout", "ttl"}: lease an instance,
+  waiting up to timeout seconds for one to be ready. Returns the lease id and
+  the ports of the instance.
+- PUT /leases/<id>: renew a lease for another ttl seconds.
+- DELETE /leases/<id>: release a lease.
+- GET /leases: list the leases.
+- GET /metrics: health of the pools (instances by state, startup and wait
+  times, failures).
+
+The state of an app (NVM, settings) can't be restored, so released instances
+are stopped and replaced with fresh ones. Leases which aren't renewed in time
+are released automatically, and instances which die are replaced. A pool whose
+instances keep failing to start is retried later, with an exponential backoff.
+"""
+
+import argparse
+import json
+import logging
+import os
+import shlex
+import signal
+import socket
+import subprocess
+import sys
+import threading
+import time
+import uuid
+from collections import deque
+from collections.abc import Callable
+from dataclasses import dataclass, field
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from pathlib import Path
+from typing import IO, Any, Protocol
+
+logger = logging.getLogger("pool")
+
+# A pool stops starting instances after this many consecutive failures, then
+# starts a single one after a delay doubled on each new failure
+MAX_START_FAILURES = 3
+START_RETRY_DELAY = 5.0
+MAX_START_RETRY_DELAY = 300.0
+
+STATS_SIZE = 1000
+
+
+class PoolError(Exception):
+    pass
+
+
+@dataclass(frozen=True)
+class PoolKey:
+    app: str
+    model: str | None = None
+    seed: str | None = None
+
+    def __str__(self) -> str:
+        return ",".join(value for value in (self.app, self.model, self.seed) if value is not None)
+
+
+class Process(Protocol):
+    def start(self) -> None: ...
+
+    def stop(self) -> None: ...
+
+    def is_alive(self) -> bool: ...
+
+
+class PortAllocator:
+    """Hand out ports of a range which are free on this host."""
+
+    def __init__(self, first: int, last: int) -> None:
+        self._ports = range(first, last + 1)
+        self._next = 0
+        self._used: set[int] = set()
+        self._lock = threading.Lock()
+
+    @staticmethod
+    def _is_free(port: int) -> bool:
+        with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as s:
+            try:
+                s.bind(("127.0.0.1", port))
+            except OSError:
+                return False
+        return True
+
+    def allocate(self, count: int) -> list[int]:
+        """Return count ports, or none at all."""
+
+        ports: list[int] = []
+        with self._lock:
+            for _ in range(len(self._ports)):
+                port = self._ports[self._next]
+                self._next = (self._next + 1) % len(self._ports)
+                if port not in self._used and self._is_free(port):
+                    ports.append(port)
+                    if len(ports) == count:
+                        self._used.update(ports)
+                        return ports
+        raise PoolError(f"not enough free ports in {self._ports.start}-{self._ports.stop - 1}")
+
+    def release(self, port: int) -> None:
+        with self._lock:
+            self._used.discard(port)
+
+
+class SpeculosProcess:
+    """An emulator started in the background, ready once its API port accepts connections."""
+
+    def __init__(
+        self,
+        key: PoolKey,
+        api_port: int,
+        apdu_port: int,
+        extra_args: list[str],
+        startup_timeout: float,
+        log: IO[bytes] | None = None,
+    ) -> None:
+        self.api_port = api_port
+        self.startup_timeout = startup_timeout
+        self.log = log
+        self.cmd = [sys.executable or "python3", "-m", "speculos", "--display", "headless"]
+        self.cmd += ["--api-port", str(api_port), "--apdu-port", str(apdu_port)]
+        if key.model is not None:
+            self.cmd += ["--model", key.model]
+        if key.seed is not None:
+            self.cmd += ["--seed", key.seed]
+        self.cmd += [*extra_args, key.app]
+        self.process: subprocess.Popen | None = None
+
+    def start(self) -> None:
+        output = self.log if self.log is not None else subprocess.DEVNULL
+        self.process = subprocess.Popen(self.cmd, stdout=output, stderr=subprocess.STDOUT)  # noqa: S603
+        deadline = time.monotonic() + self.startup_timeout
+        while time.monotonic() < deadline:
+            if self.process.poll() is not None:
+                raise PoolError(f"speculos exited with status {self.process.returncode}")
+            try:
+                socket.create_connection(("127.0.0.1", self.api_port), timeout=1).close()
+                return
+            except OSError:
+                time.sleep(0.1)
+        self.stop()
+        raise PoolError(f"speculos wasn't ready after {self.startup_timeout} seconds")
+
+    def stop(self) -> None:
+        if self.process is not None and self.process.poll() is None:
+            self.process.terminate()
+            try:
+                self.process.wait(timeout=2)
+            except subprocess.TimeoutExpired:
+                self.process.kill()
+                self.process.wait()
+        if self.log is not None:
+            self.log.close()
+
+    def is_alive(self) -> bool:
+        return self.process is not None and self.process.poll() is None
+
+
+@dataclass
+class Instance:
+    key: PoolKey
+    api_port: int
+    apdu_port: int
+    process: Process
+    state: str = "starting"
+    lease_id: str | None = None
+    lease_deadline: float = 0.0
+
+
+@dataclass
+class PoolStats:
+    starts: int = 0
+    failures: int = 0
+    consecutive_failures: int = 0
+    crashes: int = 0
+    leases: int = 0
+    expired_leases: int = 0
+    # Time before which no instance is started, after too many failures
+    retry_at: float = 0.0
+    # Only the latest durations are kept
+    startup_seconds: deque[float] = field(default_factory=lambda: deque(maxlen=STATS_SIZE))
+    wait_seconds: deque[float] = field(default_factory=lambda: deque(maxlen=STATS_SIZE))
+    last_error: str | None = None
+
+
+def _summary(values: deque[float]) -> dict[str, float]:
+    if not values:
+        return {}
+    return {"mean": round(sum(values) / len(values), 3), "max": round(max(values), 3), "last": round(values[-1], 3)}
+
+
+class Pool:
+    def __init__(
+        self,
+        launcher: Callable[[PoolKey, int, int], Process],
+        ports: PortAllocator,
+        warm: int = 2,
+        max_instances: int = 32,
+        default_ttl: float = 600.0,
+        retry_delay: float = START_RETRY_DELAY,
+    ) -> None:
+        self._launcher = launcher
+        self._ports = ports
+        self.warm = warm
+        self.max_instances = max_instances
+        self.default_ttl = default_ttl
+        self.retry_delay = retry_delay
+        self._instances: list[Instance] = []
+        self._stats: dict[PoolKey, PoolStats] = {}
+        self._condition = threading.Condition()
+        self._stopped = False
+
+    def _count(self, key: PoolKey, *states: str) -> int:
+        return sum(1 for i in self._instances if i.key == key and i.state in states)
+
+    @staticmethod
+    def _backing_off(stats: PoolStats) -> bool:
+        return stats.consecutive_failures >= MAX_START_FAILURES and time.monotonic() < stats.retry_at
+
+    def _fill(self, key: PoolKey, waiting: int = 0) -> None:
+        """Start instances until there are enough ready ones for key. Must be called with the lock held."""
+
+        stats = self._stats.setdefault(key, PoolStats())
+        if self._stopped or self._backing_off(stats):
+            return
+        missing = self.warm + waiting - self._count(key, "starting", "ready")
+        if stats.consecutive_failures >= MAX_START_FAILURES:
+            # Check that the app starts again before filling the pool
+            missing = min(missing, 1 - self._count(key, "starting"))
+        for _ in range(missing):
+            if len(self._instances) >= self.max_instances:
+                break
+            try:
+                api_port, apdu_port = self._ports.allocate(2)
+            except PoolError as e:
+                logger.error(str(e))
+                break
+            instance = Instance(key, api_port, apdu_port, self._launcher(key, api_port, apdu_port))
+            self._instances.append(instance)
+            threading.Thread(target=self._start, args=(instance,), name=f"pool-start-{api_port}", daemon=True).start()
+
+    def _start(self, instance: Instance) -> None:
+        start = time.monotonic()
+        try:
+            instance.process.start()
+        except Exception as e:
+            logger.error(f"failed to start {instance.key}: {e}")
+            with self._condition:
+                stats = self._stats[instance.key]
+                stats.failures += 1
+                stats.consecutive_failures += 1
+                stats.last_error = str(e)
+                if stats.consecutive_failures >= MAX_START_FAILURES:
+                    retries = stats.consecutive_failures - MAX_START_FAILURES
+                    delay = min(self.retry_delay * 2**retries, MAX_START_RETRY_DELAY)
+                    stats.retry_at = time.monotonic() + delay
+                    logger.warning(f"not starting {instance.key} for {delay:g} seconds")
+                self._remove(instance)
+                self._fill(instance.key)
+                self._condition.notify_all()
+            return
+
+        with self._condition:
+            if self._stopped:
+                instance.process.stop()
+                return
+            stats = self._stats[instance.key]
+            stats.starts += 1
+            stats.consecutive_failures = 0
+            stats.startup_seconds.append(time.monotonic() - start)
+            if instance.state == "starting":
+                instance.state = "ready"
+            self._condition.notify_all()
+        logger.info(f"{instance.key} ready on port {instance.api_port}")
+
+    def _remove(self, instance: Instance) -> None:
+        # Must be called with the lock held
+        if instance in self._instances:
+            self._instances.remove(instance)
+            self._ports.release(instance.api_port)
+            self._ports.release(instance.apdu_port)
+
+    def _recycle(self, instance: Instance) -> None:
+        """Stop an instance in the background and start a fresh one. Must be called with the lock held."""
+
+        instance.state = "stopping"
+        instance.lease_id = None
+
+        def stop() -> None:
+            instance.process.stop()
+            with self._condition:
+                self._remove(instance)
+                self._fill(instance.key)
+
+        threading.Thread(target=stop, name=f"pool-stop-{instance.api_port}", daemon=True).start()
+
+    def preload(self, key: PoolKey) -> None:
+        with self._condition:
+            self._fill(key)
+
+    def lease(self, key: PoolKey, timeout: float = 60.0, ttl: float | None = None) -> dict[str, Any]:
+        start = time.monotonic()
+        deadline = start + timeout
+        with self._condition:
+            stats = self._stats.setdefault(key, PoolStats())
+            waiting = 1
+            while True:
+                ready = [i for i in self._instances if i.key == key and i.state == "ready"]
+                if ready:
+                    break
+                if self._backing_off(stats):
+                    raise PoolError(f"failed to start {key}: {stats.last_error}")
+                # Start one more instance than the warm ones for this request
+                self._fill(key, waiting)
+                waiting = 0
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    raise TimeoutError(f"no instance of {key} ready after {timeout} seconds")
+                self._condition.wait(remaining)
+
+            instance = ready[0]
+            instance.state = "leased"
+            instance.lease_id = uuid.uuid4().hex
+            instance.lease_deadline = time.monotonic() + (ttl or self.default_ttl)
+            stats.leases += 1
+            stats.wait_seconds.append(time.monotonic() - start)
+            self._fill(key)
+            return self._lease_info(instance)
+
+    def _lease_info(self, instance: Instance) -> dict[str, Any]:
+        return {
+            "id": instance.lease_id,
+            "app": instance.key.app,
+            "model": instance.key.model,
+            "seed": instance.key.seed,
+            "api_port": instance.api_port,
+            "apdu_port": instance.apdu_port,
+            "expires_in": round(instance.lease_deadline - time.monotonic(), 1),
+        }
+
+    def _leased(self, lease_id: str) -> Instance:
+        for instance in self._instances:
+            if instance.state == "leased" and instance.lease_id == lease_id:
+                return instance
+        raise KeyError(lease_id)
+
+    def renew(self, lease_id: str, ttl: float | None = None) -> dict[str, Any]:
+        with self._condition:
+            instance = self._leased(lease_id)
+            instance.lease_deadline = time.monotonic() + (ttl or self.default_ttl)
+            return self._lease_info(instance)
+
+    def release(self, lease_id: str) -> None:
+        with self._condition:
+            self._recycle(self._leased(lease_id))
+
+    def leases(self) -> list[dict[str, Any]]:
+        with self._condition:
+            return [self._lease_info(i) for i in self._instances if i.state == "leased"]
+
+    def check(self) -> None:
+        """Release the expired leases and replace the instances which died."""
+
+        now = time.monotonic()
+        with self._condition:
+            for instance in list(self._instances):
+                stats = self._stats[instance.key]
+                if instance.state == "leased" and now > instance.lease_deadline:
+                    logger.warning(f"lease {instance.lease_id} of {instance.key} expired")
+                    stats.expired_leases += 1
+                    self._recycle(instance)
+                elif instance.state in ("ready", "leased") and not instance.process.is_alive():
+                    logger.warning(f"{instance.key} on port {instance.api_port} died")
+                    stats.crashes += 1
+                    self._recycle(instance)
+
+            # Refill the pools which failed to start, once their delay is over
+            for key, stats in self._stats.items():
+                if stats.consecutive_failures >= MAX_START_FAILURES and not self._backing_off(stats):
+                    self._fill(key)
+
+    def metrics(self) -> dict[str, Any]:
+        with self._condition:
+            pools = []
+            for key, stats in self._stats.items():
+                pools.append(
+                    {
+                        "app": key.app,
+                        "model": key.model,
+                        "seed": key.seed,
+                        "instances": {
+                            state: self._count(key, state) for state in ("starting", "ready", "leased", "stopping")
+                        },
+                        "starts": stats.starts,
+                        "failures": stats.failures,
+                        "crashes": stats.crashes,
+                        "leases": stats.leases,
+                        "expired_leases": stats.expired_leases,
+                        "healthy": stats.consecutive_failures < MAX_START_FAILURES,
+                        "last_error": stats.last_error,
+                        "startup_seconds": _summary(stats.startup_seconds),
+                        "lease_wait_seconds": _summary(stats.wait_seconds),
+                    }
+                )
+            return {"instances": len(self._instances), "max_instances": self.max_instances, "pools": pools}
+
+    def shutdown(self) -> None:
+        with self._condition:
+            self._stopped = True
+            instances = list(self._instances)
+        for instance in instances:
+            instance.process.stop()
+        with self._condition:
+            for instance in instances:
+                self._remove(instance)
+
+
+class PoolRequestHandler(BaseHTTPRequestHandler):
+    server: "PoolServer"
+
+    def _reply(self, status: int, body: Any) -> None:
+        data = json.dumps(body).encode()
+        self.send_response(status)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(data)))
+        self.end_headers()
+        self.wfile.write(data)
+
+    def _body(self) -> dict[str, Any]:
+        length = int(self.headers.get("Content-Length", 0))
+        body = json.loads(self.rfile.read(length) or b"{}")
+        if not isinstance(body, dict):
+            raise ValueError("expected a JSON object")
+        return body
+
+    def _lease_id(self) -> str | None:
+        parts = self.path.strip("/").split("/")
+        return parts[1] if len(parts) == 2 and parts[0] == "leases" else None
+
+    def do_GET(self) -> None:
+        if self.path == "/leases":
+            self._reply(200, {"leases": self.server.pool.leases()})
+        elif self.path == "/metrics":
+            self._reply(200, self.server.pool.metrics())
+        else:
+            self._reply(404, {"error": "not found"})
+
+    def do_POST(self) -> None:
+        if self.path != "/leases":
+            self._reply(404, {"error": "not found"})
+            return
+        try:
+            body = self._body()
+            app = body["app"]
+            if not Path(app).is_file():
+                raise ValueError(f"no such app: {app}")
+            key = PoolKey(os.path.abspath(app), body.get("model"), body.get("seed"))
+            timeout = float(body.get("timeout", 60.0))
+            ttl = body.get("ttl")
+            lease = self.server.pool.lease(key, timeout, None if ttl is None else float(ttl))
+        except (KeyError, TypeError, ValueError) as e:
+            self._reply(400, {"error": f"invalid request: {e}"})
+        except (PoolError, TimeoutError) as e:
+            self._reply(503, {"error": str(e)})
+        else:
+            self._reply(200, lease)
+
+    def do_PUT(self) -> None:
+        lease_id = self._lease_id()
+        try:
+            if lease_id is None:
+                raise KeyError(self.path)
+            ttl = self._body().get("ttl")
+            lease = self.server.pool.renew(lease_id, None if ttl is None else float(ttl))
+        except KeyError:
+            self._reply(404, {"error": "unknown lease"})
+        except (TypeError, ValueError) as e:
+            self._reply(400, {"error": f"invalid request: {e}"})
+        else:
+            self._reply(200, lease)
+
+    def do_DELETE(self) -> None:
+        lease_id = self._lease_id()
+        try:
+            if lease_id is None:
+                raise KeyError(self.path)
+            self.server.pool.release(lease_id)
+        except KeyError:
+            self._reply(404, {"error": "unknown lease"})
+        else:
+            self._reply(200, {})
+
+    def log_message(self, format: str, *args: Any) -> None:
+        logger.debug(format, *args)
+
+
+class PoolServer(ThreadingHTTPServer):
+    daemon_threads = True
+
+    def __init__(self, address: tuple[str, int], pool: Pool) -> None:
+        self.pool = pool
+        super().__init__(address, PoolRequestHandler)
+
+
+def parse_preload(value: str) -> PoolKey:
+    """Parse APP[,MODEL[,SEED]]."""
+
+    values = value.split(",", 2)
+    app = os.path.abspath(values[0])
+    model = values[1] if len(values) > 1 and values[1] else None
+    seed = values[2] if len(values) > 2 else None
+    return PoolKey(app, model, seed)
+
+
+def port_range(value: str) -> tuple[int, int]:
+    first, last = (int(port) for port in value.split("-"))
+    if not 0 < first <= last < 65536:
+        raise ValueError("invalid port range")
+    return first, last
+
+
+def main(argv: list[str] | None = None, prog: str = "speculos pool") -> int:
+    parser = argparse.ArgumentParser(prog=prog, description="Keep warm emulators and lease them to clients.")
+    parser.add_argument("--host", default="127.0.0.1", help="Address of the pool API (default: 127.0.0.1)")
+    parser.add_argument("--port", type=int, default=7000, help="Port of the pool API (default: 7000)")
+    parser.add_argument("--warm", type=int, default=2, help="Ready instances kept for each app, model and seed")
+    parser.add_argument("--max-instances", type=int, default=32, help="Maximum number of instances")
+    parser.add_argument(
+        "--port-range",
+        type=port_range,
+        default=(20000, 29999),
+        help="Ports given to the instances (default: 20000-29999)",
+    )
+    parser.add_argument("--lease-ttl", type=float, default=600.0, help="Default lease duration, in seconds")
+    parser.add_argument("--startup-timeout", type=float, default=30.0, help="Maximum startup time of an instance")
+    parser.add_argument(
+        "--preload",
+        type=parse_preload,
+        action="append",
+        default=[],
+        metavar="APP[,MODEL[,SEED]]",
+        help="Start warm instances of this app at startup, can be repeated",
+    )
+    parser.add_argument("--log-dir", type=Path, help="Write the output of each instance to this directory")
+    parser.add_argument("--speculos-args", default="", help="Extra arguments given to every instance")
+    args = parser.parse_args(argv)
+
+    logging.basicConfig(level=logging.INFO, format="%(asctime)s.%(msecs)03d:%(name)s: %(message)s", datefmt="%H:%M:%S")
+
+    extra_args = shlex.split(args.speculos_args)
+    if args.log_dir is not None:
+        args.log_dir.mkdir(parents=True, exist_ok=True)
+
+    def launcher(key: PoolKey, api_port: int, apdu_port: int) -> Process:
+        log = None
+        if args.log_dir is not None:
+            log = open(args.log_dir / f"speculos-{api_port}.log", "ab")  # noqa: SIM115
+        return SpeculosProcess(key, api_port, apdu_port, extra_args, args.startup_timeout, log)
+
+    pool = Pool(launcher, PortAllocator(*args.port_range), args.warm, args.max_instances, args.lease_ttl)
+    for key in args.preload:
+        pool.preload(key)
+
+    server = PoolServer((args.host, args.port), pool)
+    threading.Thread(target=server.serve_forever, name="pool-api", daemon=True).start()
+    logger.info(f"pool API listening on http://{args.host}:{args.port}")
+
+    # Stop the instances on SIGTERM too
+    signal.signal(signal.SIGTERM, lambda *_: sys.exit(0))
+    try:
+        while True:
+            time.sleep(1)
+            pool.check()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        server.shutdown()
+        pool.shutdown()
+    return 0
@@ -0,0 +1,77 @@
+"""
+Startup profiling, enabled with --startup-profile.
+
+Milestones of the startup sequence are timestamped relatively to the start of the process, interpreter startup and
+imports included, and reported as a single JSON object once the first APDU response is received from the app, so that
+CI can track the time to first APDU.
+"""
+
+import json
+import logging
+import os
+import sys
+import time
+from typing import IO
+
+
+def _process_age() -> float:
+    """Seconds since the process started, or 0 if unknown: only Linux provides it, in /proc/self/stat."""
+    try:
+        with open("/proc/self/stat") as fp:
+            stat = fp.read()
+        # starttime is the 22nd field, in clock ticks since boot. The 2nd one is the command name, in parentheses, which
+        # may contain spaces.
+        starttime = int(stat[stat.rindex(")") + 2 :].split()[19])
+        age = time.clock_gettime(time.CLOCK_BOOTTIME) - starttime / os.sysconf("SC_CLK_TCK")
+    except (AttributeError, OSError, ValueError, IndexError):
+        return 0.0
+    return max(age, 0.0)
+
+
+# This module is only imported once speculos.main imported the other modules
+_START = time.monotonic() - _process_age()
+
+MILESTONES = ["qemu_spawned", "app_ready", "first_apdu"]
+
+logger = logging.getLogger("startup")
+
+
+class StartupProfile:
+    def __init__(self):
+        self.enabled = False
+        self.output: str = "-"
+        self.marks: dict[str, float] = {}
+
+    def enable(self, output: str = "-") -> None:
+        """Enable profiling. The report is written to output, or to stderr if output is '-'."""
+        self.enabled = True
+        self.output = output
+
+    def mark(self, milestone: str) -> None:
+        """Record the first occurrence of a milestone."""
+        if not self.enabled or milestone in self.marks:
+            return
+
+        self.marks[milestone] = time.monotonic() - _START
+        if milestone == MILESTONES[-1]:
+            self.report()
+
+    def report(self) -> None:
+        data = {name: round(self.marks[name], 4) for name in MILESTONES if name in self.marks}
+        line = json.dumps({"startup_profile": data})
+        if self.output == "-":
+            self._write(sys.stderr, line)
+        else:
+            try:
+                with open(self.output, "a") as fp:
+                    self._write(fp, line)
+            except OSError as e:
+                logger.error(f"failed to write startup profile to {self.output}: {e}")
+
+    @staticmethod
+    def _write(fp: IO[str], line: str) -> None:
+        fp.write(line + "\n")
+        fp.flush()
+
+
+profile = StartupProfile()
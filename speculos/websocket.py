@@ -0,0 +1,281 @@
+"""
+Minimal RFC 6455 WebSocket implementation, shared by the API server and the
+Python client, and the binary message format of the /ws channel.
+
+Every message of the channel is a single binary WebSocket message (the
+WebSocket framing already carries its length), made of a one-byte type
+followed by a type-specific payload. Integers are big-endian.
+
+Client to server, each request is answered by a message of the same type
+(or by an ERROR message). Requests of a type are answered in order, but APDUs
+are exchanged in the background: an APDU response can come after the answers
+to BUTTON and FINGER requests sent later.
+
+- APDU: tick timeout (u32, 0 for no timeout), APDU. Answered with the
+  response of the app.
+- BUTTON: buttons (u8, bit 0 is left and bit 1 is right), action (u8),
+  delay in milliseconds (u16). Answered with an empty payload.
+- FINGER: x (u16), y (u16), action (u8), delay in milliseconds (u16),
+  release position x2 (u16), y2 (u16). Answered with an empty payload.
+
+Server to client, sent as soon as they happen:
+
+- TEXT_EVENT: x (i16), y (i16), w (u16), h (u16), UTF-8 text.
+- SCREEN_CHANGE: empty payload, sent when the screen content is cleared.
+- ERROR: type of the failed request (u8), UTF-8 message.
+"""
+
+import base64
+import hashlib
+import os
+import socket
+import struct
+import threading
+from enum import IntEnum
+from urllib.parse import urlsplit
+
+from speculos.observer import TextEvent
+
+WEBSOCKET_GUID = b"258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+# Reject messages larger than this, an APDU is at most 64 KiB
+MAX_MESSAGE_SIZE = 1024 * 1024
+
+OP_CONTINUATION = 0x0
+OP_TEXT = 0x1
+OP_BINARY = 0x2
+OP_CLOSE = 0x8
+OP_PING = 0x9
+OP_PONG = 0xA
+
+CLOSE_NORMAL = 1000
+CLOSE_PROTOCOL_ERROR = 1002
+CLOSE_UNSUPPORTED_DATA = 1003
+CLOSE_TOO_BIG = 1009
+
+
+class ProtocolError(Exception):
+    def __init__(self, message: str, code: int = CLOSE_PROTOCOL_ERROR) -> None:
+        super().__init__(message)
+        self.code = code
+
+
+class ChannelMessage(IntEnum):
+    APDU = 0x01
+    BUTTON = 0x02
+    FINGER = 0x03
+    TEXT_EVENT = 0x10
+    SCREEN_CHANGE = 0x11
+    ERROR = 0x7F
+
+
+class ChannelAction(IntEnum):
+    RELEASE = 0
+    PRESS = 1
+    PRESS_AND_RELEASE = 2
+
+
+CHANNEL_ACTIONS = {
+    ChannelAction.RELEASE: "release",
+    ChannelAction.PRESS: "press",
+    ChannelAction.PRESS_AND_RELEASE: "press-and-release",
+}
+
+APDU_HEADER = struct.Struct(">I")
+BUTTON_PAYLOAD = struct.Struct(">BBH")
+FINGER_PAYLOAD = struct.Struct(">HHBHHH")
+TEXT_EVENT_HEADER = struct.Struct(">hhHH")
+
+
+def encode_text_event(event: TextEvent) -> bytes:
+    header = TEXT_EVENT_HEADER.pack(event.x, event.y, event.w, event.h)
+    return bytes([ChannelMessage.TEXT_EVENT]) + header + event.text.encode()
+
+
+def decode_text_event(payload: bytes) -> TextEvent:
+    x, y, w, h = TEXT_EVENT_HEADER.unpack_from(payload)
+    text = payload[TEXT_EVENT_HEADER.size :].decode()
+    return TextEvent(text, x, y, w, h, False)
+
+
+def accept_key(key: str) -> str:
+    digest = hashlib.sha1(key.encode() + WEBSOCKET_GUID).digest()  # noqa: S324
+    return base64.b64encode(digest).decode()
+
+
+def handshake_response(key: str) -> bytes:
+    return (
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        f"Sec-WebSocket-Accept: {accept_key(key)}\r\n"
+        "\r\n"
+    ).encode()
+
+
+def _xor_mask(payload: bytes, key: bytes) -> bytes:
+    if not payload:
+        return payload
+    n = len(payload)
+    mask = (key * (n // 4 + 1))[:n]
+    return (int.from_bytes(payload, "big") ^ int.from_bytes(mask, "big")).to_bytes(n, "big")
+
+
+class WebSocket:
+    """
+    A WebSocket over a connected socket, once the handshake is done.
+
+    Clients mask the frames they send and servers don't (RFC 6455 section
+    5.1). Sending is thread-safe, receiving must be done from a single thread.
+    """
+
+    def __init__(self, sock: socket.socket, client: bool) -> None:
+        self._sock = sock
+        self._rfile = sock.makefile("rb")
+        self._client = client
+        self._send_lock = threading.Lock()
+        self.closed = False
+
+    def _read(self, size: int) -> bytes:
+        data = self._rfile.read(size)
+        if len(data) != size:
+            raise ConnectionError("WebSocket connection closed")
+        return data
+
+    def _recv_frame(self) -> tuple[bool, int, bytes]:
+        b0, b1 = self._read(2)
+        fin = bool(b0 & 0x80)
+        opcode = b0 & 0x0F
+        masked = bool(b1 & 0x80)
+        length = b1 & 0x7F
+
+        if b0 & 0x70:
+            raise ProtocolError("reserved bits set")
+        if masked == self._client:
+            raise ProtocolError("invalid frame masking")
+        if length == 126:
+            (length,) = struct.unpack(">H", self._read(2))
+        elif length == 127:
+            (length,) = struct.unpack(">Q", self._read(8))
+        if opcode >= OP_CLOSE and (length > 125 or not fin):
+            raise ProtocolError("invalid control frame")
+        if length > MAX_MESSAGE_SIZE:
+            raise ProtocolError("message too big", CLOSE_TOO_BIG)
+
+        key = self._read(4) if masked else b""
+        payload = self._read(length)
+        if masked:
+            payload = _xor_mask(payload, key)
+        return fin, opcode, payload
+
+    def _send_frame(self, opcode: int, payload: bytes) -> None:
+        header = bytearray([0x80 | opcode])
+        mask_bit = 0x80 if self._client else 0
+        length = len(payload)
+        if length < 126:
+            header.append(mask_bit | length)
+        elif length < 0x10000:
+            header.append(mask_bit | 126)
+            header += struct.pack(">H", length)
+        else:
+            header.append(mask_bit | 127)
+            header += struct.pack(">Q", length)
+        if self._client:
+            key = os.urandom(4)
+            header += key
+            payload = _xor_mask(payload, key)
+        with self._send_lock:
+            self._sock.sendall(bytes(header) + payload)
+
+    def recv(self) -> tuple[int, bytes] | None:
+        """
+        Return the next data message as (opcode, payload), answering pings on
+        the way. Return None once the peer closed the connection.
+        """
+
+        message = bytearray()
+        message_opcode = None
+        while True:
+            fin, opcode, payload = self._recv_frame()
+            if opcode == OP_CLOSE:
+                self.close(CLOSE_NORMAL)
+                return None
+            if opcode == OP_PING:
+                self._send_frame(OP_PONG, payload)
+                continue
+            if opcode == OP_PONG:
+                continue
+            if opcode == OP_CONTINUATION:
+                if message_opcode is None:
+                    raise ProtocolError("unexpected continuation frame")
+            elif opcode in (OP_TEXT, OP_BINARY):
+                if message_opcode is not None:
+                    raise ProtocolError("expected a continuation frame")
+                message_opcode = opcode
+            else:
+                raise ProtocolError(f"unknown opcode {opcode:#x}")
+
+            message += payload
+            if len(message) > MAX_MESSAGE_SIZE:
+                raise ProtocolError("message too big", CLOSE_TOO_BIG)
+            if fin:
+                return message_opcode, bytes(message)
+
+    def send(self, payload: bytes, opcode: int = OP_BINARY) -> None:
+        self._send_frame(opcode, payload)
+
+    def close(self, code: int = CLOSE_NORMAL) -> None:
+        if self.closed:
+            return
+        self.closed = True
+        try:
+            self._send_frame(OP_CLOSE, struct.pack(">H", code))
+        except OSError:
+            pass
+
+
+def connect(url: str, timeout: float | None = None) -> WebSocket:
+    """Open a client WebSocket to a ws:// URL."""
+
+    parts = urlsplit(url)
+    if parts.scheme != "ws" or parts.hostname is None:
+        raise ValueError(f"Unsupported WebSocket URL: {url}")
+    port = parts.port or 80
+    path = parts.path or "/"
+    if parts.query:
+        path += f"?{parts.query}"
+
+    sock = socket.create_connection((parts.hostname, port), timeout=timeout)
+    sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    key = base64.b64encode(os.urandom(16)).decode()
+    request = (
+        f"GET {path} HTTP/1.1\r\n"
+        f"Host: {parts.hostname}:{port}\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        f"Sec-WebSocket-Key: {key}\r\n"
+        "Sec-WebSocket-Version: 13\r\n"
+        "\r\n"
+    )
+    sock.sendall(request.encode())
+
+    # Read the response byte by byte, not to consume the first frames
+    response = b""
+    while not response.endswith(b"\r\n\r\n"):
+        data = sock.recv(1)
+        if not data:
+            sock.close()
+            raise ConnectionError("WebSocket handshake failed: connection closed")
+        response += data
+
+    status_line, *header_lines = response.decode("latin-1").split("\r\n")
+    headers = {}
+    for line in header_lines:
+        if ":" in line:
+            name, value = line.split(":", 1)
+            headers[name.strip().lower()] = value.strip()
+    if status_line.split(" ")[1:2] != ["101"] or headers.get("sec-websocket-accept") != accept_key(key):
+        sock.close()
+        raise ConnectionError(f"WebSocket handshake failed: {status_line}")
+
+    return WebSocket(sock, client=True)
@@ -4,6 +4,7 @@
 #include "bagl.h"
 #include "emulate.h"
 #include "fonts.h"
+#include "text_events.h"
 
 #define SEPROXYHAL_TAG_SCREEN_DISPLAY_RAW_STATUS_START 0x00
 #define SEPROXYHAL_TAG_SCREEN_DISPLAY_RAW_STATUS_CONT  0x01
@@ -81,17 +82,15 @@ unsigned long sys_bagl_hal_draw_rect(unsigned int color, int x, int y,
     dst[offset++] = value & 0xff;                                              \
   } while (0)
 
-size_t build_chunk(uint8_t *buf, size_t *offset, size_t size,
-                   const uint8_t *bitmap, const size_t bitmap_length)
-{
-  size_t len = MIN(size, bitmap_length - *offset);
-
-  memcpy(buf, bitmap + *offset, len);
-  *offset += len;
-
-  return len;
-}
+/* Largest payload of a SEPH packet, whose length is encoded on 16 bits. */
+#define SEPH_MAX_PAYLOAD 0xffff
 
+/*
+ * The bitmap is sent in a single packet, after its header: this tag is only
+ * handled by speculos, which doesn't acknowledge the packet, so there's no
+ * need to split it into chunks and wait for an event between them like
+ * SCREEN_DISPLAY_RAW_STATUS. Only bitmaps larger than a packet are continued.
+ */
 unsigned long sys_bagl_hal_draw_bitmap_within_rect(
     int x, int y, unsigned int width, unsigned int height,
     unsigned int color_count, const unsigned int *colors,
@@ -99,7 +98,7 @@ unsigned long sys_bagl_hal_draw_bitmap_within_rect(
     unsigned int bitmap_length_bits)
 {
   size_t i, len, size;
-  uint8_t buf[300 - 4]; /* size limit in io_seph_send */
+  uint8_t buf[300 - 4];
   uint8_t header[4];
   uint32_t character = get_character_from_bitmap(bitmap);
   size = 0;
@@ -126,9 +125,18 @@ unsigned long sys_bagl_hal_draw_bitmap_within_rect(
   if (bitmap_length_bits % 8 != 0) {
     bitmap_length += 1;
   }
-  size_t offset = 0;
-  len = build_chunk(buf + size, &offset, sizeof(buf) - size, bitmap,
-                    bitmap_length);
+
+  // Space is encoded as an empty character. height may not reflect the real
+  // height: use the number of lines displayed.
+  if (bitmap_length == 0) {
+    character = ' ';
+  }
+  if (width != 0) {
+    unsigned int lines = (bitmap_length * 8 + width - 1) / width;
+    text_event_add_character(x, y, width, lines, character);
+  }
+
+  len = MIN(bitmap_length, SEPH_MAX_PAYLOAD - 1 - size);
 
   header[0] = SEPROXYHAL_TAG_BAGL_DRAW_BITMAP;
   header[1] = ((size + len + 1) >> 8) & 0xff;
@@ -136,17 +144,11 @@ unsigned long sys_bagl_hal_draw_bitmap_within_rect(
   header[3] = SEPROXYHAL_TAG_BAGL_DRAW_BITMAP_START;
 
   sys_io_seph_send(header, sizeof(header));
-  sys_io_seph_send(buf, size + len);
-
-  while (true) {
-    len = build_chunk(buf, &offset, sizeof(buf), bitmap, bitmap_length);
-    if (len == 0) {
-      break;
-    }
+  sys_io_seph_send(buf, size);
+  sys_io_seph_send(bitmap, len);
 
-    // wait for displayed event
-    uint8_t tmp[64];
-    sys_io_seproxyhal_spi_recv(tmp, sizeof(tmp), 0);
+  for (size_t offset = len; offset < bitmap_length; offset += len) {
+    len = MIN(bitmap_length - offset, SEPH_MAX_PAYLOAD - 1);
 
     header[0] = SEPROXYHAL_TAG_BAGL_DRAW_BITMAP;
     header[1] = ((len + 1) >> 8) & 0xff;
@@ -154,7 +156,7 @@ unsigned long sys_bagl_hal_draw_bitmap_within_rect(
     header[3] = SEPROXYHAL_TAG_BAGL_DRAW_BITMAP_CONT;
 
     sys_io_seph_send(header, sizeof(header));
-    sys_io_seph_send(buf, len);
+    sys_io_seph_send(bitmap + offset, len);
   }
 
   return 0x9000; // SWO_SUCCESS
@@ -1,6 +1,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "fonts.h"
 #include "sdk.h"
@@ -16,6 +17,11 @@ typedef struct {
 BITMAP_CHAR bitmap_char[MAX_BITMAP_CHAR_12];
 uint32_t nb_bitmap_char;
 
+struct fonts_index {
+  uint32_t nb_bitmap_char;
+  BITMAP_CHAR bitmap_char[];
+};
+
 // Return the real addr depending on where the app was loaded
 static void *remap_bagl_addr(void *code, uint32_t addr, uint32_t text_load_addr)
 {
@@ -196,3 +202,28 @@ void parse_fonts(void *code, unsigned long text_load_addr,
   qsort(bitmap_char, nb_bitmap_char, sizeof(bitmap_char[0]),
         compare_bitmap_char);
 }
+
+// Return a copy of the current table, or NULL if it can't be allocated
+struct fonts_index *save_fonts_index(void)
+{
+  struct fonts_index *index;
+
+  index = malloc(sizeof(*index) + nb_bitmap_char * sizeof(bitmap_char[0]));
+  if (index == NULL) {
+    return NULL;
+  }
+
+  index->nb_bitmap_char = nb_bitmap_char;
+  memcpy(index->bitmap_char, bitmap_char,
+         nb_bitmap_char * sizeof(bitmap_char[0]));
+
+  return index;
+}
+
+// Make a table saved by save_fonts_index() the current one
+void restore_fonts_index(const struct fonts_index *index)
+{
+  memcpy(bitmap_char, index->bitmap_char,
+         index->nb_bitmap_char * sizeof(bitmap_char[0]));
+  nb_bitmap_char = index->nb_bitmap_char;
+}
@@ -6,6 +6,8 @@
 #include <unistd.h>
 
 #include "bolos/io/io.h"
+#include "bolos/seph_reader.h"
+#include "bolos/text_events.h"
 #include "bolos/touch.h"
 #include "emulate.h"
 #include "os_utils.h"
@@ -42,28 +44,6 @@ static seph_info_t G_seph_info = {
   .rx_packet_max_length = OS_IO_SEPH_BUFFER_SIZE,
 };
 
-static ssize_t readall(int fd, void *buf, size_t count)
-{
-  ssize_t n;
-
-  while (count > 0) {
-    n = read(fd, buf, count);
-    if (n == 0) {
-      warnx("read from seph fd failed: fd closed");
-      return -1;
-    } else if (n < 0) {
-      if (errno == EINTR) {
-        continue;
-      }
-      warn("read from seph fd failed");
-      return -1;
-    }
-    count -= n;
-  }
-
-  return 0;
-}
-
 static ssize_t writeall(int fd, const void *buf, size_t count)
 {
   const char *p;
@@ -155,6 +135,8 @@ int sys_os_io_seph_tx(const unsigned char *buffer, unsigned short length,
       goto end;
     }
 
+    catch_text_event_from_app(buffer[0]);
+
     G_seph_info.tx_packet_length = U2BE(buffer, 1) + 3;
     if (G_seph_info.tx_packet_length > G_seph_info.tx_packet_max_length) {
       G_seph_info.tx_packet_length = 0;
@@ -217,28 +199,20 @@ int sys_os_io_seph_se_rx_event(unsigned char *buffer, unsigned short max_length,
     goto end;
   }
 
-  ssize_t res = readall(SEPH_FILENO, G_seph_info.rx_packet, 3);
+  ssize_t res = seph_read_packet(G_seph_info.rx_packet,
+                                 G_seph_info.rx_packet_max_length);
   if (res < 0) {
     printf("Readall error\n");
     _exit(1);
   }
 
-  // Header of the seph packet has been received, wait for the packet's body
-  G_seph_info.rx_packet_length =
-      (G_seph_info.rx_packet[1] << 8) | G_seph_info.rx_packet[2];
-  if (G_seph_info.rx_packet_length > (G_seph_info.rx_packet_max_length - 3)) {
+  // Packets too large for the buffer are dropped
+  if (res > G_seph_info.rx_packet_max_length) {
     rx_length = -12; // ENOMEM
     goto end;
   }
 
-  G_seph_info.rx_packet_length += 3;
-
-  res = readall(SEPH_FILENO, &G_seph_info.rx_packet[3],
-                G_seph_info.rx_packet_length - 3);
-  if (res < 0) {
-    printf("Readall error\n");
-    _exit(1);
-  }
+  G_seph_info.rx_packet_length = res;
 
   buffer[0] = OS_IO_PACKET_TYPE_SEPH;
   memcpy(&buffer[1], G_seph_info.rx_packet, G_seph_info.rx_packet_length);
@@ -6,6 +6,7 @@
 #include "fonts.h"
 #include "nbgl.h"
 #include "nbgl_rle.h"
+#include "text_events.h"
 
 #define SEPROXYHAL_TAG_NBGL_DRAW_HORIZONTAL_LINE 0xF9
 #define SEPROXYHAL_TAG_NBGL_DRAW_RECT            0xFA
@@ -67,6 +68,13 @@ nbgl_front_draw_img_character(nbgl_area_t *area, uint8_t *buffer,
   uint32_t buffer_len = (nb_pixs / 8) + ((nb_pixs % 8) > 0);
   size_t len = sizeof(nbgl_area_t) + buffer_len + 1 + 1 + 4;
 
+  // Space is encoded as an empty character
+  if (buffer_len == 0) {
+    character = ' ';
+  }
+  text_event_add_character(area->x0, area->y0, area->width, area->height,
+                           character);
+
   header[0] = SEPROXYHAL_TAG_NBGL_DRAW_IMAGE;
   header[1] = (len >> 8) & 0xff;
   header[2] = len & 0xff;
@@ -228,6 +236,13 @@ unsigned long sys_nbgl_front_draw_img_rle(nbgl_area_t *area, uint8_t *buffer,
   uint8_t header[3];
   size_t len = sizeof(nbgl_area_t) + buffer_len + 1 + 1 + 4;
 
+  // Space is encoded as an empty character
+  if (buffer_len == 0) {
+    character = ' ';
+  }
+  text_event_add_character(area->x0, area->y0, area->width, area->height,
+                           character);
+
   header[0] = SEPROXYHAL_TAG_NBGL_DRAW_IMAGE_RLE;
   header[1] = (len >> 8) & 0xff;
   header[2] = len & 0xff;
@@ -0,0 +1,73 @@
+#include <err.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "emulate.h"
+#include "seph_reader.h"
+
+// Room for a whole packet, plus the beginning of the next ones
+#define SEPH_RX_BUFFER_SIZE (SEPH_MAX_PACKET_SIZE + 4096)
+
+// Events sent by the MCU are read ahead: every read() issues a syscall which
+// is forwarded to the host, so each one gets as many packets as available
+// instead of reading the header and the payload of each packet separately.
+static uint8_t rx_buffer[SEPH_RX_BUFFER_SIZE];
+static size_t rx_start;
+static size_t rx_end;
+
+static int fill_rx_buffer(size_t count)
+{
+  ssize_t n;
+
+  if (rx_start + count > sizeof(rx_buffer)) {
+    memmove(rx_buffer, rx_buffer + rx_start, rx_end - rx_start);
+    rx_end -= rx_start;
+    rx_start = 0;
+  }
+
+  while (rx_end - rx_start < count) {
+    n = read(SEPH_FILENO, rx_buffer + rx_end, sizeof(rx_buffer) - rx_end);
+    if (n == 0) {
+      warnx("read from seph fd failed: fd closed");
+      return -1;
+    } else if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      warn("read from seph fd failed");
+      return -1;
+    }
+    rx_end += n;
+  }
+
+  return 0;
+}
+
+/*
+ * Read the next packet into buffer and return its whole length (header
+ * included), or -1 if the connection is closed. Packets larger than
+ * max_length are truncated, the rest of the packet being dropped.
+ */
+ssize_t seph_read_packet(uint8_t *buffer, size_t max_length)
+{
+  size_t length;
+
+  if (fill_rx_buffer(3) < 0) {
+    return -1;
+  }
+
+  length = 3 + ((rx_buffer[rx_start + 1] << 8) | rx_buffer[rx_start + 2]);
+  if (fill_rx_buffer(length) < 0) {
+    return -1;
+  }
+
+  memcpy(buffer, rx_buffer + rx_start,
+         length < max_length ? length : max_length);
+  rx_start += length;
+  if (rx_start == rx_end) {
+    rx_start = rx_end = 0;
+  }
+
+  return length;
+}
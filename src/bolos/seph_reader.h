@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+// Largest SEPH packet: 3-byte header (tag, 16-bit length) and its payload
+#define SEPH_MAX_PACKET_SIZE (3 + 0xffff)
+
+ssize_t seph_read_packet(uint8_t *buffer, size_t max_length);
@@ -4,6 +4,8 @@
 #include <unistd.h>
 
 #include "bolos/exception.h"
+#include "bolos/seph_reader.h"
+#include "bolos/text_events.h"
 #include "bolos/touch.h"
 #include "emulate.h"
 
@@ -16,29 +18,6 @@ static uint32_t rx_length = 0;
 static uint8_t last_tag;
 static size_t next_length;
 
-static ssize_t readall(int fd, void *buf, size_t count)
-{
-  ssize_t n;
-
-  while (count > 0) {
-    /* actually issue a syscall which is forwarded to the host */
-    n = read(fd, buf, count);
-    if (n == 0) {
-      warnx("read from seph fd failed: fd closed");
-      return -1;
-    } else if (n < 0) {
-      if (errno == EINTR) {
-        continue;
-      }
-      warn("read from seph fd failed");
-      return -1;
-    }
-    count -= n;
-  }
-
-  return 0;
-}
-
 static ssize_t writeall(int fd, const void *buf, size_t count)
 {
   const char *p;
@@ -95,6 +74,8 @@ unsigned long sys_io_seproxyhal_spi_send(const uint8_t *buffer, uint16_t length)
       return 0;
     }
 
+    catch_text_event_from_app(buffer[0]);
+
     last_tag = buffer[0];
     next_length = (buffer[1] << 8) | buffer[2];
     next_length += 3;
@@ -134,19 +115,16 @@ unsigned long sys_io_seproxyhal_spi_recv(uint8_t *buffer, uint16_t maxlength,
     errx(1, "invalid size given to sys_io_seproxyhal_spi_recv");
   }
 
-  if (readall(SEPH_FILENO, buffer, 3) < 0) {
+  ssize_t length = seph_read_packet(buffer, maxlength);
+  if (length < 0) {
     _exit(1);
   }
 
-  uint16_t packet_size = (buffer[1] << 8) | buffer[2];
+  uint16_t packet_size = length - 3;
   if (packet_size > maxlength - 3) {
     packet_size = maxlength - 3;
   }
 
-  if (readall(SEPH_FILENO, buffer + 3, packet_size) < 0) {
-    _exit(1);
-  }
-
   tx_status = false;
   rx_length = 3 + packet_size;
 
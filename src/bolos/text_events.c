@@ -0,0 +1,194 @@
+#include <string.h>
+
+#include "emulate.h"
+#include "text_events.h"
+
+// Only consider 0x6X tags as status one
+#define SEPROXYHAL_TAG_STATUS_MASK    0xF0
+#define SEPROXYHAL_TAG_GENERAL_STATUS 0x60
+
+#define SEPROXYHAL_TAG_NBGL_SEND_SPECULOS_TEXT_LINE 0x5A
+// Speculos only, text line built from the characters drawn by the app
+#define SEPROXYHAL_TAG_SPECULOS_TEXT_EVENT 0xF3
+
+#define MAX_TEXT_SIZE 256
+
+// Maximum space for a letter to be considered part of the same word
+#define MAX_BLANK_SPACE_NANO 12
+#define MAX_BLANK_SPACE_STAX 24
+#define MAX_BLANK_SPACE_FLEX 26
+
+typedef struct {
+  int x;
+  int y;
+  unsigned int w;
+  unsigned int h;
+  size_t text_len;
+  char text[MAX_TEXT_SIZE];
+} text_line_t;
+
+// Line being built from the latest characters drawn by the app. It is sent as
+// soon as a character doesn't belong to it anymore, or right before the next
+// status. Nothing is sent anymore once the SDK sends its own text lines.
+static text_line_t pending_line;
+static bool sdk_text_lines;
+
+static int max_blank_space(void)
+{
+  switch (hw_model) {
+  case MODEL_STAX:
+    return MAX_BLANK_SPACE_STAX;
+  case MODEL_FLEX:
+    return MAX_BLANK_SPACE_FLEX;
+  default:
+    return MAX_BLANK_SPACE_NANO;
+  }
+}
+
+static size_t encode_utf8(uint32_t character, char *buf)
+{
+  if (character < 0x80) {
+    buf[0] = character;
+    return 1;
+  } else if (character < 0x800) {
+    buf[0] = 0xc0 | (character >> 6);
+    buf[1] = 0x80 | (character & 0x3f);
+    return 2;
+  } else if (character < 0x10000) {
+    buf[0] = 0xe0 | (character >> 12);
+    buf[1] = 0x80 | ((character >> 6) & 0x3f);
+    buf[2] = 0x80 | (character & 0x3f);
+    return 3;
+  } else if (character < 0x110000) {
+    buf[0] = 0xf0 | (character >> 18);
+    buf[1] = 0x80 | ((character >> 12) & 0x3f);
+    buf[2] = 0x80 | ((character >> 6) & 0x3f);
+    buf[3] = 0x80 | (character & 0x3f);
+    return 4;
+  }
+
+  return 0;
+}
+
+static bool can_be_merged(int x, int y)
+{
+  int x_diff;
+
+  if (pending_line.text_len == 0) {
+    return false;
+  }
+
+  x_diff = x - (pending_line.x + (int)pending_line.w);
+  if (x_diff < 0) {
+    x_diff = -x_diff;
+  }
+
+  return y < (pending_line.y + (int)pending_line.h) &&
+         x_diff < max_blank_space();
+}
+
+static void store_char_in_pending_line(int x, int y, unsigned int w,
+                                       unsigned int h)
+{
+  int x2 = x + w - 1;
+  int y1 = y;
+  int y2 = y + h - 1;
+
+  pending_line.w = x2 - pending_line.x + 1;
+  if (y1 > pending_line.y) {
+    // Keep the lowest Y in Y1
+    y1 = pending_line.y;
+  }
+  if (y2 < (pending_line.y + (int)pending_line.h)) {
+    // Keep the highest Y in Y2
+    y2 = pending_line.y + pending_line.h - 1;
+  }
+  pending_line.y = y1;
+  pending_line.h = y2 - y1 + 1;
+}
+
+static void send_pending_line(void)
+{
+  uint8_t header[3];
+  uint8_t coordinates[8];
+  size_t len = pending_line.text_len + sizeof(coordinates);
+
+  if (pending_line.text_len == 0) {
+    return;
+  }
+
+  header[0] = SEPROXYHAL_TAG_SPECULOS_TEXT_EVENT;
+  header[1] = (len >> 8) & 0xff;
+  header[2] = len & 0xff;
+
+  coordinates[0] = (pending_line.x >> 8) & 0xff;
+  coordinates[1] = pending_line.x & 0xff;
+  coordinates[2] = (pending_line.y >> 8) & 0xff;
+  coordinates[3] = pending_line.y & 0xff;
+  coordinates[4] = (pending_line.w >> 8) & 0xff;
+  coordinates[5] = pending_line.w & 0xff;
+  coordinates[6] = (pending_line.h >> 8) & 0xff;
+  coordinates[7] = pending_line.h & 0xff;
+
+  pending_line.text_len = 0;
+
+  sys_io_seph_send(header, sizeof(header));
+  sys_io_seph_send((const uint8_t *)pending_line.text,
+                   len - sizeof(coordinates));
+  sys_io_seph_send(coordinates, sizeof(coordinates));
+}
+
+/*
+ * Add a drawn character to the pending line, using the same spacing rules as
+ * the former Python OCR: a character belongs to the current line if it starts
+ * above its bottom and close enough to its right edge. Otherwise the pending
+ * line is sent and a new one is started.
+ *
+ * Must not be called while a packet is being sent to seph.
+ */
+void text_event_add_character(int x, int y, unsigned int w, unsigned int h,
+                              uint32_t character)
+{
+  char utf8[4];
+  size_t len;
+
+  if (sdk_text_lines || character == 0) {
+    return;
+  }
+
+  len = encode_utf8(character, utf8);
+  if (len == 0) {
+    return;
+  }
+
+  if (can_be_merged(x, y) &&
+      pending_line.text_len + len <= sizeof(pending_line.text)) {
+    store_char_in_pending_line(x, y, w, h);
+  } else {
+    send_pending_line();
+    pending_line.x = x;
+    pending_line.y = y;
+    pending_line.w = w;
+    pending_line.h = h;
+  }
+
+  memcpy(pending_line.text + pending_line.text_len, utf8, len);
+  pending_line.text_len += len;
+}
+
+/*
+ * Called with the tag of each packet sent by the app, before it is written to
+ * seph: the pending line is sent before the status, so that it is part of the
+ * events of the current screen.
+ */
+void catch_text_event_from_app(uint8_t tag)
+{
+  if (tag == SEPROXYHAL_TAG_NBGL_SEND_SPECULOS_TEXT_LINE) {
+    // The SDK knows better: stop building lines
+    sdk_text_lines = true;
+    pending_line.text_len = 0;
+  } else if ((tag & SEPROXYHAL_TAG_STATUS_MASK) ==
+             SEPROXYHAL_TAG_GENERAL_STATUS) {
+    send_pending_line();
+  }
+}
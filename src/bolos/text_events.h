@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
+void text_event_add_character(int x, int y, unsigned int w, unsigned int h,
+                              uint32_t character);
+void catch_text_event_from_app(uint8_t tag);
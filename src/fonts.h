@@ -180,3 +180,10 @@ void parse_fonts(void *code, unsigned long text_load_addr,
                  bool use_nbgl);
 
 uint32_t get_character_from_bitmap(const uint8_t *bitmap);
+
+// Bitmap -> character table built by parse_fonts(), kept by the launcher to
+// switch back to an app without parsing its fonts again
+struct fonts_index;
+
+struct fonts_index *save_fonts_index(void);
+void restore_fonts_index(const struct fonts_index *index);
@@ -3,12 +3,14 @@
 #define _FILE_OFFSET_BITS 64
 #include <err.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -33,6 +35,12 @@ const char STORAGE_BACKUP[] = ".backup";
 
 #define DERIVATION_PATH_MAX_LEN 256
 
+#define SVC_SITES_MAGIC 0x53435653 /* "SVCS" */
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
 struct elf_info_s {
   unsigned long load_offset;
   unsigned long load_size;
@@ -58,6 +66,15 @@ struct app_s {
   int fd;
   bool use_nbgl;
   struct elf_info_s elf;
+  // SVC instructions offsets, cached in svc_sites_path if not NULL
+  char *svc_sites_path;
+  uint32_t *svc_sites;
+  size_t n_svc_sites;
+  // Code of the app once loaded (SVC patched, NVRAM set up), -1 if not
+  // available yet
+  int image_fd;
+  size_t image_size;
+  struct fonts_index *fonts_index;
 };
 
 struct memory_s {
@@ -146,6 +163,7 @@ static int open_app(char *name, char *filename, struct elf_info_s *elf,
   apps[napp].save_nvram = save_nvram;
 
   apps[napp].fd = fd;
+  apps[napp].image_fd = -1;
   apps[napp].use_nbgl = (elf->use_nbgl != 0);
   apps[napp].elf.load_offset = elf->load_offset;
   apps[napp].elf.load_size = elf->load_size;
@@ -219,188 +237,319 @@ unsigned long get_app_derivation_path(uint8_t **derivationPath)
   return apps[0].elf.derivation_path_len;
 }
 
-int replace_current_code(struct app_s *app)
+/* read the SVC sites cached by a previous run, if any */
+static void load_svc_sites(struct app_s *app)
 {
-  int flags, prot;
-  size_t page_size = sysconf(_SC_PAGESIZE);
+  uint32_t header[2];
+  uint32_t *sites;
+  struct stat st;
+  FILE *fp;
 
-  if (memory.code != MAP_FAILED) {
-    if (munmap(memory.code, memory.code_size) != 0) {
-      warn("munmap failed");
-      return -1;
-    }
+  fp = fopen(app->svc_sites_path, "rb");
+  if (fp == NULL) {
+    return;
   }
 
-  flags = MAP_PRIVATE | MAP_FIXED;
-  prot = PROT_READ | PROT_EXEC;
-  /* map an extra page in case the _install_params are mapped in the beginning
-   * of a new page so that they can still be accessed */
-  memory.code = mmap(LOAD_ADDR, app->elf.load_size + page_size, prot, flags,
-                     app->fd, app->elf.load_offset);
+  // The count comes from the file: check it against the file size before
+  // allocating, and against the code size since SVC instructions are 2 bytes
+  if (fstat(fileno(fp), &st) != 0 || st.st_size < (off_t)sizeof(header) ||
+      fread(header, sizeof(header), 1, fp) != 1 ||
+      header[0] != SVC_SITES_MAGIC || header[1] == 0 ||
+      header[1] != (st.st_size - sizeof(header)) / sizeof(uint32_t) ||
+      header[1] > app->elf.load_size / 2) {
+    warnx("ignoring invalid SVC sites file \"%s\"", app->svc_sites_path);
+    fclose(fp);
+    return;
+  }
 
-  if (memory.code == MAP_FAILED) {
-    warn("mmap code");
-    return -1;
+  sites = malloc(header[1] * sizeof(uint32_t));
+  if (sites == NULL) {
+    warn("ignoring SVC sites file \"%s\": malloc", app->svc_sites_path);
+    fclose(fp);
+    return;
   }
 
-  if (mprotect(memory.code, app->elf.load_size, PROT_READ | PROT_WRITE) != 0) {
-    warn("could not update mprotect in rw mode for app");
-    _exit(1);
+  if (fread(sites, sizeof(uint32_t), header[1], fp) != header[1]) {
+    warnx("ignoring truncated SVC sites file \"%s\"", app->svc_sites_path);
+    free(sites);
+    fclose(fp);
+    return;
+  }
+  fclose(fp);
+
+  app->svc_sites = sites;
+  app->n_svc_sites = header[1];
+}
+
+/* cache the SVC sites found by a scan, for the next runs */
+static void save_svc_sites(struct app_s *app)
+{
+  uint32_t header[2] = { SVC_SITES_MAGIC, app->n_svc_sites };
+  char tmp_path[PATH_MAX];
+  FILE *fp;
+
+  // Written to a temporary file first, so that concurrent emulators never read
+  // a partial file
+  if (snprintf(tmp_path, sizeof(tmp_path), "%s.%d", app->svc_sites_path,
+               getpid()) >= (int)sizeof(tmp_path)) {
+    return;
   }
 
+  fp = fopen(tmp_path, "wb");
+  if (fp == NULL) {
+    warn("failed to cache SVC sites to \"%s\"", tmp_path);
+    return;
+  }
+
+  if (fwrite(header, sizeof(header), 1, fp) != 1 ||
+      fwrite(app->svc_sites, sizeof(uint32_t), app->n_svc_sites, fp) !=
+          app->n_svc_sites) {
+    warnx("failed to cache SVC sites to \"%s\"", tmp_path);
+    fclose(fp);
+    unlink(tmp_path);
+    return;
+  }
+  fclose(fp);
+
+  if (rename(tmp_path, app->svc_sites_path) != 0) {
+    warn("rename(\"%s\")", tmp_path);
+    unlink(tmp_path);
+  }
+}
+
+/*
+ * Replace the SVC instructions of the app code with undefined instructions.
+ *
+ * The code is only scanned once: the offsets of the SVC instructions are kept
+ * to patch the code again when the app is reloaded, and cached on disk if
+ * requested.
+ */
+static int patch_app_svc(struct app_s *app, void *code)
+{
   // If the syscall functions are not inlined and their symbols have been found
   // in the elf file, patch the elf at this address to remove the SVC 1 call
   if (app->elf.svc_call_addr != 0 || app->elf.svc_cx_call_addr != 0) {
     if (app->elf.svc_call_addr != 0) {
       uint32_t start = app->elf.svc_call_addr - app->elf.text_load_addr;
 
-      if (patch_svc(memory.code + start, 2) != 0) {
-        /* this should never happen, because the svc were already patched
-         * without error during the first load */
-        _exit(1);
+      if (patch_svc(code + start, 2) != 0) {
+        return -1;
       }
     }
 
     if (app->elf.svc_cx_call_addr != 0) {
       uint32_t start = app->elf.svc_cx_call_addr - app->elf.text_load_addr;
 
-      if (patch_svc(memory.code + start, 2) != 0) {
-        /* this should never happen, because the svc were already patched
-         * without error during the first load */
-        _exit(1);
+      if (patch_svc(code + start, 2) != 0) {
+        return -1;
       }
     }
-  } else {
-    if (patch_svc(memory.code, app->elf.load_size) != 0) {
-      /* this should never happen, because the svc were already patched
-       * without error during the first load */
-      _exit(1);
+
+    return 0;
+  }
+
+  if (app->svc_sites != NULL) {
+    if (patch_svc_sites(code, app->elf.load_size, app->svc_sites,
+                        app->n_svc_sites) == 0) {
+      return 0;
     }
+    // Stale sites: scan the code again
+    free(app->svc_sites);
+    app->svc_sites = NULL;
+    app->n_svc_sites = 0;
   }
 
-  if (mprotect(memory.code, app->elf.load_size, PROT_READ | PROT_EXEC) != 0) {
-    warn("could not update mprotect in rx mode for app");
-    _exit(1);
+  if (patch_svc_get_sites(code, app->elf.load_size, &app->svc_sites,
+                          &app->n_svc_sites) != 0) {
+    return -1;
   }
 
-  memory.code_size = app->elf.load_size;
-  current_app = app;
+  if (app->svc_sites_path != NULL) {
+    save_svc_sites(app);
+    // Only save them once
+    app->svc_sites_path = NULL;
+  }
+
+  return 0;
+}
+
+/* parse the fonts of the app, or reuse the table built on its first load */
+static void load_app_fonts(struct app_s *app)
+{
+  if (app->fonts_index != NULL) {
+    restore_fonts_index(app->fonts_index);
+    return;
+  }
 
   // Parse fonts and build bitmap -> character table
   parse_fonts(memory.code, app->elf.text_load_addr, app->elf.fonts_addr,
               app->elf.fonts_size, app->use_nbgl);
+  app->fonts_index = save_fonts_index();
+}
 
-  return 0;
+static int create_memfd(const char *name)
+{
+#ifdef SYS_memfd_create
+  return syscall(SYS_memfd_create, name, MFD_CLOEXEC);
+#else
+  (void)name;
+  errno = ENOSYS;
+  return -1;
+#endif
 }
 
-void unload_running_app(bool unload_data)
+/*
+ * Copy the code of the app, once loaded, to an anonymous file and map it in
+ * place of the app file. Switching back to the app (os_lib_call(),
+ * os_lib_end()) then only maps this file again, without patching the code,
+ * setting up the NVRAM nor parsing the fonts again. The mapping is shared to
+ * keep the NVRAM writes of the app across switches.
+ *
+ * If the anonymous file can't be created, the app is loaded from its file on
+ * each switch instead.
+ */
+static int save_app_image(struct app_s *app, void *code, size_t size,
+                          size_t readable_size)
 {
-  if (munmap(memory.code, memory.code_size) != 0) {
-    warn("munmap code");
+  size_t offset;
+  ssize_t n;
+  void *p;
+  int fd;
+
+  fd = create_memfd(app->name);
+  if (fd == -1) {
+    warn("memfd_create");
+    return 0;
   }
 
-  if (unload_data) {
-    if (munmap(memory.data, memory.data_size) != 0) {
-      warn("munmap data");
+  // Only readable_size bytes are mapped from the app file, the rest stays zeroed
+  if (ftruncate(fd, size) != 0) {
+    warn("ftruncate");
+    close(fd);
+    return 0;
+  }
+
+  for (offset = 0; offset < readable_size; offset += n) {
+    n = write(fd, (uint8_t *)code + offset, readable_size - offset);
+    if (n <= 0) {
+      warn("write app image");
+      close(fd);
+      return 0;
     }
   }
 
-  reset_memory(unload_data);
+  p = mmap(code, size, PROT_READ | PROT_EXEC, MAP_SHARED | MAP_FIXED, fd, 0);
+  if (p == MAP_FAILED) {
+    warn("mmap app image");
+    close(fd);
+    return -1;
+  }
+
+  app->image_fd = fd;
+  app->image_size = size;
+
+  return 0;
 }
 
-/* map the app to memory */
-static void *load_app(char *name)
+static void *map_app_image(struct app_s *app)
 {
-  void *code, *data;
-  struct app_s *app;
-  struct stat st;
-  size_t size;
-  void *data_addr;
-  size_t data_size;
+  void *code;
+
+  code = mmap(LOAD_ADDR, app->image_size, PROT_READ | PROT_EXEC,
+              MAP_SHARED | MAP_FIXED, app->image_fd, 0);
+  if (code == MAP_FAILED) {
+    warn("mmap app image");
+  }
+
+  return code;
+}
+
+int replace_current_code(struct app_s *app)
+{
+  int flags, prot;
   size_t page_size = sysconf(_SC_PAGESIZE);
 
-  code = MAP_FAILED;
-  data = MAP_FAILED;
+  if (memory.code != MAP_FAILED) {
+    if (munmap(memory.code, memory.code_size) != 0) {
+      warn("munmap failed");
+      return -1;
+    }
+  }
 
-  app = search_app_by_name(name);
-  if (app == NULL) {
-    warnx("failed to find app \"%s\"", name);
-    goto error;
+  if (app->image_fd != -1) {
+    memory.code = map_app_image(app);
+    if (memory.code == MAP_FAILED) {
+      return -1;
+    }
+
+    memory.code_size = app->elf.load_size;
+    current_app = app;
+    load_app_fonts(app);
+
+    return 0;
   }
 
-  if (fstat(app->fd, &st) != 0) {
-    warn("fstat");
-    goto error;
+  flags = MAP_PRIVATE | MAP_FIXED;
+  prot = PROT_READ | PROT_EXEC;
+  /* map an extra page in case the _install_params are mapped in the beginning
+   * of a new page so that they can still be accessed */
+  memory.code = mmap(LOAD_ADDR, app->elf.load_size + page_size, prot, flags,
+                     app->fd, app->elf.load_offset);
+
+  if (memory.code == MAP_FAILED) {
+    warn("mmap code");
+    return -1;
   }
 
-  if (app->elf.load_offset > st.st_size) {
-    warnx("app load offset is larger than file size (%lu > %lld)\n",
-          app->elf.load_offset, st.st_size);
-    goto error;
+  if (mprotect(memory.code, app->elf.load_size, PROT_READ | PROT_WRITE) != 0) {
+    warn("could not update mprotect in rw mode for app");
+    _exit(1);
   }
 
-  size = app->elf.load_size;
-  if (size > st.st_size - app->elf.load_offset) {
-    warnx("app load size is larger than file size (%lu > %lld)\n",
-          app->elf.load_size, st.st_size);
-    goto error;
+  if (patch_app_svc(app, memory.code) != 0) {
+    /* this should never happen, because the svc were already patched
+     * without error during the first load */
+    _exit(1);
   }
 
-  data_addr = get_lower_page_aligned_addr(app->elf.stack_addr);
-  data_size = get_upper_page_aligned_size(
-      app->elf.stack_size + app->elf.stack_addr - (unsigned long)data_addr);
-  if (app->elf.stack_addr == LINK_RAM_ADDR) {
-    // Emulate RAM relocation
-    data_addr = (void *)LOAD_RAM_ADDR;
-    data_size = get_upper_page_aligned_size(app->elf.stack_size);
+  if (mprotect(memory.code, app->elf.load_size, PROT_READ | PROT_EXEC) != 0) {
+    warn("could not update mprotect in rx mode for app");
+    _exit(1);
   }
 
-  /* load code
-   * map an extra page in case the _install_params are mapped in the beginning
-   * of a new page so that they can still be accessed */
-  code = mmap(LOAD_ADDR, size + page_size, PROT_READ | PROT_EXEC,
-              MAP_PRIVATE | MAP_FIXED, app->fd, app->elf.load_offset);
-  if (code == MAP_FAILED) {
-    warn("mmap code");
-    goto error;
+  memory.code_size = app->elf.load_size;
+  current_app = app;
+
+  load_app_fonts(app);
+
+  return 0;
+}
+
+void unload_running_app(bool unload_data)
+{
+  if (munmap(memory.code, memory.code_size) != 0) {
+    warn("munmap code");
   }
 
-  /* setup data */
-  if (memory.data == MAP_FAILED) {
-    if (mmap(data_addr, data_size, PROT_READ | PROT_WRITE,
-             MAP_PRIVATE | MAP_FIXED | MAP_ANONYMOUS, -1, 0) == MAP_FAILED) {
-      warn("mmap data");
-      goto error;
+  if (unload_data) {
+    if (munmap(memory.data, memory.data_size) != 0) {
+      warn("munmap data");
     }
   }
 
+  reset_memory(unload_data);
+}
+
+/* patch the code of the app and set up its NVRAM, on its first load */
+static int setup_app_code(struct app_s *app, void *code, size_t size)
+{
   if (mprotect(code, size, PROT_READ | PROT_WRITE) != 0) {
     warn("could not update mprotect in rw mode for app");
-    goto error;
+    return -1;
   }
 
-  // If the syscall functions are not inlined and their symbols have been found
-  // in the elf file, patch the elf at this address to remove the SVC 1 call
-  if (app->elf.svc_call_addr != 0 || app->elf.svc_cx_call_addr != 0) {
-    if (app->elf.svc_call_addr != 0) {
-      uint32_t start = app->elf.svc_call_addr - app->elf.text_load_addr;
-
-      if (patch_svc(code + start, 2) != 0) {
-        goto error;
-      }
-    }
-
-    if (app->elf.svc_cx_call_addr != 0) {
-      uint32_t start = app->elf.svc_cx_call_addr - app->elf.text_load_addr;
-
-      if (patch_svc(code + start, 2) != 0) {
-        goto error;
-      }
-    }
-  } else {
-    if (patch_svc(code, app->elf.load_size) != 0) {
-      goto error;
-    }
+  if (patch_app_svc(app, code) != 0) {
+    return -1;
   }
 
   // App NVRAM data update
@@ -414,7 +563,7 @@ static void *load_app(char *name)
       FILE *fptr = fopen(app->nvram_file_name, "rb");
       if (fptr == NULL) {
         warnx("App NVRAM file %s is absent\n", app->nvram_file_name);
-        goto error;
+        return -1;
       }
       fseek(fptr, 0, SEEK_END);
       long lSize = ftell(fptr);
@@ -424,14 +573,14 @@ static void *load_app(char *name)
       if (buffer == NULL) {
         warnx("Error to allocate memory for app nvram read\n");
         fclose(fptr);
-        goto error;
+        return -1;
       }
       preload_file_size = fread(buffer, 1, lSize, fptr);
       if (preload_file_size != (size_t)lSize) {
         warnx("App nvram file size mismatch\n");
         free(buffer);
         fclose(fptr);
-        goto error;
+        return -1;
       }
 
       // The patch
@@ -469,9 +618,101 @@ static void *load_app(char *name)
 
   if (mprotect(code, size, PROT_READ | PROT_EXEC) != 0) {
     warn("could not update mprotect in rx mode for app");
+    return -1;
+  }
+
+  return 0;
+}
+
+/* map the app to memory */
+static void *load_app(char *name)
+{
+  void *code, *data;
+  struct app_s *app;
+  struct stat st;
+  size_t size, readable_size;
+  void *data_addr;
+  size_t data_size;
+  size_t page_size = sysconf(_SC_PAGESIZE);
+
+  code = MAP_FAILED;
+  data = MAP_FAILED;
+
+  app = search_app_by_name(name);
+  if (app == NULL) {
+    warnx("failed to find app \"%s\"", name);
+    goto error;
+  }
+
+  if (fstat(app->fd, &st) != 0) {
+    warn("fstat");
+    goto error;
+  }
+
+  if (app->elf.load_offset > st.st_size) {
+    warnx("app load offset is larger than file size (%lu > %lld)\n",
+          app->elf.load_offset, st.st_size);
+    goto error;
+  }
+
+  size = app->elf.load_size;
+  if (size > st.st_size - app->elf.load_offset) {
+    warnx("app load size is larger than file size (%lu > %lld)\n",
+          app->elf.load_size, st.st_size);
     goto error;
   }
 
+  data_addr = get_lower_page_aligned_addr(app->elf.stack_addr);
+  data_size = get_upper_page_aligned_size(
+      app->elf.stack_size + app->elf.stack_addr - (unsigned long)data_addr);
+  if (app->elf.stack_addr == LINK_RAM_ADDR) {
+    // Emulate RAM relocation
+    data_addr = (void *)LOAD_RAM_ADDR;
+    data_size = get_upper_page_aligned_size(app->elf.stack_size);
+  }
+
+  /* load code
+   * map an extra page in case the _install_params are mapped in the beginning
+   * of a new page so that they can still be accessed */
+  if (app->image_fd != -1) {
+    code = map_app_image(app);
+    if (code == MAP_FAILED) {
+      goto error;
+    }
+  } else {
+    code = mmap(LOAD_ADDR, size + page_size, PROT_READ | PROT_EXEC,
+                MAP_PRIVATE | MAP_FIXED, app->fd, app->elf.load_offset);
+    if (code == MAP_FAILED) {
+      warn("mmap code");
+      goto error;
+    }
+  }
+
+  /* setup data */
+  if (memory.data == MAP_FAILED) {
+    if (mmap(data_addr, data_size, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_FIXED | MAP_ANONYMOUS, -1, 0) == MAP_FAILED) {
+      warn("mmap data");
+      goto error;
+    }
+  }
+
+  if (app->image_fd == -1) {
+    if (setup_app_code(app, code, size) != 0) {
+      goto error;
+    }
+
+    readable_size =
+        get_upper_page_aligned_size(st.st_size - app->elf.load_offset);
+    if (readable_size > size + page_size) {
+      readable_size = size + page_size;
+    }
+
+    if (save_app_image(app, code, size + page_size, readable_size) != 0) {
+      goto error;
+    }
+  }
+
   memory.code = code;
   memory.code_size = size;
 
@@ -482,9 +723,7 @@ static void *load_app(char *name)
 
   current_app = app;
 
-  // Parse fonts and build bitmap -> character table
-  parse_fonts(memory.code, app->elf.text_load_addr, app->elf.fonts_addr,
-              app->elf.fonts_size, app->use_nbgl);
+  load_app_fonts(app);
 
   return code;
 
@@ -761,6 +1000,37 @@ static int load_apps(int argc, char *argv[])
   return 0;
 }
 
+/*
+ * SVC sites cache files are given with the following format: name:path. eg.
+ * main:/home/user/.cache/speculos/<sha256>.svc
+ */
+static int set_svc_sites_paths(int argc, char *argv[])
+{
+  struct app_s *app;
+  char *path;
+  int i;
+
+  for (i = 0; i < argc; i++) {
+    path = strchr(argv[i], ':');
+    if (path == NULL) {
+      warnx("invalid SVC sites argument (\"%s\")", argv[i]);
+      return -1;
+    }
+    *path++ = '\0';
+
+    app = search_app_by_name(argv[i]);
+    if (app == NULL) {
+      warnx("failed to find app \"%s\"", argv[i]);
+      return -1;
+    }
+
+    app->svc_sites_path = path;
+    load_svc_sites(app);
+  }
+
+  return 0;
+}
+
 static void usage(char *argv0)
 {
   fprintf(stderr,
@@ -770,7 +1040,9 @@ static void usage(char *argv0)
   fprintf(stderr, "\n\
   -m <model>:           Optional string representing the device model being emula-\n\
                         ted. Currently supports \"nanosp\", \"nanox\", \"stax\", \"flex\" and \"apex_p\".\n\
-  -a <api_level>:       A string representing the SDK api level to be used, like \"22\".\n");
+  -a <api_level>:       A string representing the SDK api level to be used, like \"22\".\n\
+  -S <name:path>:       File caching the SVC instructions offsets of an app, read\n\
+                        if it exists and written otherwise. Can be repeated.\n");
   exit(EXIT_FAILURE);
 }
 
@@ -778,6 +1050,8 @@ int main(int argc, char *argv[])
 {
   char *cxlib_path = NULL;
   char *fonts_path = NULL;
+  char *svc_sites_args[MAX_APP];
+  int n_svc_sites_args = 0;
 
   int opt;
 
@@ -787,7 +1061,7 @@ int main(int argc, char *argv[])
 
   fprintf(stderr, "[*] speculos launcher revision: " GIT_REVISION "\n");
 
-  while ((opt = getopt(argc, argv, "c:tr:s:m:k:a:f:pl:")) != -1) {
+  while ((opt = getopt(argc, argv, "c:tr:s:m:k:a:f:pl:S:")) != -1) {
     switch (opt) {
     case 'f':
       fonts_path = optarg;
@@ -823,6 +1097,12 @@ int main(int argc, char *argv[])
     case 'l':
       app_flags = atol(optarg);
       break;
+    case 'S':
+      if (n_svc_sites_args >= MAX_APP) {
+        errx(1, "too many SVC sites files");
+      }
+      svc_sites_args[n_svc_sites_args++] = optarg;
+      break;
     default:
       usage(argv[0]);
       break;
@@ -856,6 +1136,10 @@ int main(int argc, char *argv[])
     return 1;
   }
 
+  if (set_svc_sites_paths(n_svc_sites_args, svc_sites_args) != 0) {
+    return 1;
+  }
+
   if (load_cxlib(cxlib_path) != 0) {
     return 1;
   }
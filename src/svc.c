@@ -251,20 +251,46 @@ int setup_signals(void)
   return 0;
 }
 
+static void add_svc_addr(unsigned char *addr)
+{
+  svc_addr = realloc(svc_addr, (n_svc_call + 1) * sizeof(unsigned long));
+  if (svc_addr == NULL) {
+    err(1, "realloc");
+  }
+  svc_addr[n_svc_call] = (unsigned long)addr;
+
+  /* undefined instruction */
+  memcpy(addr, "\xff\xde", 2);
+
+  if (trace_syscalls) {
+    fprintf(stderr, "[*] patching svc instruction at %p\n", addr);
+  }
+
+  n_svc_call++;
+}
+
 /*
  * Replace the SVC instruction with an undefined instruction.
  *
  * It generates a SIGILL upon execution, which is caught to handle that
  * syscall.
+ *
+ * If sites isn't NULL, the offsets (relative to p) of the patched instructions
+ * are returned in a newly allocated array, so that the same code can be patched
+ * again later with patch_svc_sites() without scanning it.
  */
-int patch_svc(void *p, size_t size)
+int patch_svc_get_sites(void *p, size_t size, uint32_t **sites,
+                        size_t *n_sites)
 {
   unsigned char *addr, *end, *next;
-  int ret;
+
+  if (sites != NULL) {
+    *sites = NULL;
+    *n_sites = 0;
+  }
 
   addr = p;
   end = addr + size;
-  ret = 0;
   while (addr <= end - 2) {
     next = memmem(addr, end - addr, "\x01\xdf", 2);
     if (next == NULL) {
@@ -283,21 +309,16 @@ int patch_svc(void *p, size_t size)
       continue;
     }
 
-    svc_addr = realloc(svc_addr, (n_svc_call + 1) * sizeof(unsigned long));
-    if (svc_addr == NULL) {
-      err(1, "realloc");
-    }
-    svc_addr[n_svc_call] = (unsigned long)next;
-
-    /* undefined instruction */
-    memcpy(next, "\xff\xde", 2);
-
-    if (trace_syscalls) {
-      fprintf(stderr, "[*] patching svc instruction at %p\n", next);
+    if (sites != NULL) {
+      *sites = realloc(*sites, (*n_sites + 1) * sizeof(uint32_t));
+      if (*sites == NULL) {
+        err(1, "realloc");
+      }
+      (*sites)[(*n_sites)++] = next - (unsigned char *)p;
     }
 
+    add_svc_addr(next);
     addr = (unsigned char *)next + 2;
-    n_svc_call++;
   }
 
   if (n_svc_call == 0) {
@@ -305,7 +326,44 @@ int patch_svc(void *p, size_t size)
     return -1;
   }
 
-  return ret;
+  return 0;
+}
+
+int patch_svc(void *p, size_t size)
+{
+  return patch_svc_get_sites(p, size, NULL, NULL);
+}
+
+/*
+ * Patch the SVC instructions at the given offsets (relative to p), as returned
+ * by a previous patch_svc_get_sites() on the same code.
+ *
+ * Every site is checked before anything is patched: if they don't match the
+ * code, -1 is returned and the caller can fall back to patch_svc().
+ */
+int patch_svc_sites(void *p, size_t size, const uint32_t *sites,
+                    size_t n_sites)
+{
+  unsigned char *code = p;
+  size_t i;
+
+  if (n_sites == 0) {
+    return -1;
+  }
+
+  for (i = 0; i < n_sites; i++) {
+    if ((sites[i] & 1) || sites[i] > size - 2 ||
+        memcmp(code + sites[i], "\x01\xdf", 2) != 0) {
+      warnx("SVC site 0x%x doesn't match the code", sites[i]);
+      return -1;
+    }
+  }
+
+  for (i = 0; i < n_sites; i++) {
+    add_svc_addr(code + sites[i]);
+  }
+
+  return 0;
 }
 
 /*
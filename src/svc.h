@@ -3,10 +3,15 @@
 #include <signal.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 extern bool trace_syscalls;
 
 int patch_svc(void *p, size_t size);
+int patch_svc_get_sites(void *p, size_t size, uint32_t **sites,
+                        size_t *n_sites);
+int patch_svc_sites(void *p, size_t size, const uint32_t *sites,
+                    size_t n_sites);
 int patch_svc_instr(unsigned char *addr);
 void save_current_context(struct sigcontext *sigcontext);
 void replace_current_context(struct sigcontext *sigcontext);
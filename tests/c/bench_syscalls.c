@@ -0,0 +1,460 @@
+/*
+ * Throughput of the crypto syscalls, reported as JSON on stdout:
+ *
+ *   qemu-arm-static bench_syscalls [-t min_seconds] [name_filter]
+ *
+ * Each benchmark runs for at least min_seconds (default: 0.5), the number of
+ * iterations being doubled until then. Only the benchmarks whose name
+ * contains name_filter are run.
+ */
+
+#include <err.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bolos/cx.h"
+#include "bolos/cx_aes.h"
+#include "bolos/cx_bls.h"
+#include "bolos/cx_ec.h"
+#include "bolos/cx_hash.h"
+#include "bolos/cx_hmac.h"
+#include "bolos/cxlib.h"
+#include "emulate.h"
+#include "environment.h"
+
+#define MESSAGE_SIZE 1024
+
+#define CHECK(expr)                                                            \
+  do {                                                                         \
+    if (!(expr)) {                                                             \
+      errx(1, "%s:%d: %s failed", __FILE__, __LINE__, #expr);                  \
+    }                                                                          \
+  } while (0)
+
+typedef struct {
+  const char *name;
+  void (*setup)(void);
+  void (*run)(void);
+} benchmark_t;
+
+static uint8_t message[MESSAGE_SIZE];
+static uint8_t output[MESSAGE_SIZE];
+
+/* Hashes and HMAC, of a 1 KiB message */
+
+static void bench_sha256(void)
+{
+  CHECK(sys_cx_hash_sha256(message, sizeof(message), output, 32) == 32);
+}
+
+static void bench_sha512(void)
+{
+  CHECK(sys_cx_hash_sha512(message, sizeof(message), output, 64) == 64);
+}
+
+static void bench_sha3_256(void)
+{
+  cx_sha3_t ctx;
+
+  CHECK(cx_sha3_init(&ctx, 256) == CX_SHA3);
+  CHECK(sys_cx_hash((cx_hash_t *)&ctx, CX_LAST, message, sizeof(message),
+                    output, 32) == 32);
+}
+
+static void bench_blake2b_512(void)
+{
+  cx_blake2b_t ctx;
+
+  CHECK(cx_blake2b_init(&ctx, 512) == CX_BLAKE2B);
+  CHECK(sys_cx_hash((cx_hash_t *)&ctx, CX_LAST, message, sizeof(message),
+                    output, 64) == 64);
+}
+
+static void bench_ripemd160(void)
+{
+  CHECK(sys_cx_hash_ripemd160(message, sizeof(message), output, 20) == 20);
+}
+
+static void bench_hmac_sha256(void)
+{
+  CHECK(sys_cx_hmac_sha256(message, 32, message, sizeof(message), output,
+                           32) == 32);
+}
+
+static void bench_hmac_sha512(void)
+{
+  CHECK(sys_cx_hmac_sha512(message, 64, message, sizeof(message), output,
+                           64) == 64);
+}
+
+/* AES-128-CBC, of a 1 KiB message */
+
+static cx_aes_key_t aes_key;
+
+static void setup_aes(void)
+{
+  CHECK(sys_cx_aes_init_key(message, 16, &aes_key) == 16);
+}
+
+static void bench_aes_cbc_encrypt(void)
+{
+  CHECK(sys_cx_aes(&aes_key, CX_LAST | CX_ENCRYPT | CX_PAD_NONE | CX_CHAIN_CBC,
+                   message, sizeof(message), output,
+                   sizeof(output)) == sizeof(message));
+}
+
+static void bench_aes_cbc_decrypt(void)
+{
+  CHECK(sys_cx_aes(&aes_key, CX_LAST | CX_DECRYPT | CX_PAD_NONE | CX_CHAIN_CBC,
+                   message, sizeof(message), output,
+                   sizeof(output)) == sizeof(message));
+}
+
+/* Elliptic curves: signatures and ECDH */
+
+static cx_ecfp_640_private_key_t private_key;
+static cx_ecfp_640_public_key_t public_key;
+static cx_ecfp_640_public_key_t peer_public_key;
+static uint8_t signature[128];
+static unsigned int signature_len;
+
+static void setup_key_pair(cx_curve_t curve)
+{
+  const cx_curve_domain_t *domain = cx_ecfp_get_domain(curve);
+  cx_ecfp_640_private_key_t peer_private_key;
+  uint8_t raw_key[64];
+  size_t i;
+
+  CHECK(domain != NULL);
+  // Smaller than the order of every curve
+  for (i = 0; i < domain->length; i++) {
+    raw_key[i] = i + 1;
+  }
+
+  CHECK(sys_cx_ecfp_init_private_key(
+            curve, raw_key, domain->length,
+            (cx_ecfp_private_key_t *)&private_key) == (int)domain->length);
+  CHECK(sys_cx_ecfp_generate_pair(curve, (cx_ecfp_public_key_t *)&public_key,
+                                  (cx_ecfp_private_key_t *)&private_key,
+                                  1) == 0);
+
+  raw_key[0] = 0x42;
+  CHECK(sys_cx_ecfp_init_private_key(
+            curve, raw_key, domain->length,
+            (cx_ecfp_private_key_t *)&peer_private_key) ==
+        (int)domain->length);
+  CHECK(sys_cx_ecfp_generate_pair(
+            curve, (cx_ecfp_public_key_t *)&peer_public_key,
+            (cx_ecfp_private_key_t *)&peer_private_key, 1) == 0);
+}
+
+static void ecdsa_sign(void)
+{
+  unsigned int info = 0;
+  int len;
+
+  len = sys_cx_ecdsa_sign((cx_ecfp_private_key_t *)&private_key,
+                          CX_RND_RFC6979 | CX_LAST, CX_SHA256, message, 32,
+                          signature, sizeof(signature), &info);
+  CHECK(len > 0);
+  signature_len = len;
+}
+
+static void bench_ecdsa_verify(void)
+{
+  CHECK(sys_cx_ecdsa_verify((cx_ecfp_public_key_t *)&public_key, CX_LAST,
+                            CX_SHA256, message, 32, signature,
+                            signature_len) == 1);
+}
+
+static void bench_ecdh(void)
+{
+  CHECK(sys_cx_ecdh((cx_ecfp_private_key_t *)&private_key, CX_ECDH_X,
+                    peer_public_key.W, peer_public_key.W_len, output,
+                    sizeof(output)) > 0);
+}
+
+#define EC_SETUP(suffix, curve)                                                \
+  static void setup_##suffix(void)                                             \
+  {                                                                            \
+    setup_key_pair(curve);                                                     \
+  }                                                                            \
+  static void setup_signed_##suffix(void)                                      \
+  {                                                                            \
+    setup_key_pair(curve);                                                     \
+    ecdsa_sign();                                                              \
+  }
+
+EC_SETUP(secp256k1, CX_CURVE_SECP256K1)
+EC_SETUP(secp256r1, CX_CURVE_SECP256R1)
+EC_SETUP(secp384r1, CX_CURVE_SECP384R1)
+EC_SETUP(brainpoolp256r1, CX_CURVE_BrainPoolP256R1)
+
+static void setup_ed25519(void)
+{
+  setup_key_pair(CX_CURVE_Ed25519);
+  CHECK(sys_cx_eddsa_sign((cx_ecfp_private_key_t *)&private_key, 0,
+                          CX_SHA512, message, 64, NULL, 0, signature, 64,
+                          NULL) == 64);
+}
+
+static void bench_eddsa_sign(void)
+{
+  CHECK(sys_cx_eddsa_sign((cx_ecfp_private_key_t *)&private_key, 0,
+                          CX_SHA512, message, 64, NULL, 0, signature, 64,
+                          NULL) == 64);
+}
+
+static void bench_eddsa_verify(void)
+{
+  CHECK(sys_cx_eddsa_verify((cx_ecfp_public_key_t *)&public_key, 0, CX_SHA512,
+                            message, 64, NULL, 0, signature, 64) == 1);
+}
+
+/* BIP32 derivation from the default seed, on secp256k1 */
+
+static void setup_bip32(void)
+{
+  init_environment();
+}
+
+static void derive_bip32(size_t depth)
+{
+  const uint32_t path[] = { 0x8000002c, 0x80000000, 0x80000000, 0, 0,
+                            1,          2,          3 };
+  uint8_t key[64], chain[32];
+
+  CHECK(depth <= sizeof(path) / sizeof(path[0]));
+  CHECK(sys_os_perso_derive_node_bip32(CX_CURVE_SECP256K1, path, depth, key,
+                                       chain) == 0);
+}
+
+static void bench_bip32_depth3(void)
+{
+  derive_bip32(3);
+}
+
+static void bench_bip32_depth5(void)
+{
+  derive_bip32(5);
+}
+
+static void bench_bip32_depth8(void)
+{
+  derive_bip32(8);
+}
+
+/* BLS12-381 */
+
+#define BLS_DST "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_NUL_"
+
+static cx_ecfp_384_private_key_t bls_key;
+static uint8_t bls_hash[BLS_FIELD_EXT_LEN * 2];
+static uint8_t bls_signature[BLS_COMPRESSED_SIG_LEN];
+
+static void setup_bls(void)
+{
+  uint8_t raw_key[CX_BLS_BLS12381_KEY_LEN];
+  size_t i;
+
+  for (i = 0; i < sizeof(raw_key); i++) {
+    raw_key[i] = i + 1;
+  }
+  CHECK(sys_cx_ecfp_init_private_key(CX_CURVE_BLS12_381_G1, raw_key,
+                                     sizeof(raw_key),
+                                     (cx_ecfp_private_key_t *)&bls_key) ==
+        sizeof(raw_key));
+  CHECK(sys_cx_hash_to_field(message, 32, (const uint8_t *)BLS_DST,
+                             strlen(BLS_DST), bls_hash,
+                             sizeof(bls_hash)) == CX_OK);
+  CHECK(sys_ox_bls12381_sign(&bls_key, bls_hash, sizeof(bls_hash),
+                             bls_signature, sizeof(bls_signature)) == CX_OK);
+}
+
+static void bench_bls_sign(void)
+{
+  CHECK(sys_ox_bls12381_sign(&bls_key, bls_hash, sizeof(bls_hash), output,
+                             BLS_COMPRESSED_SIG_LEN) == CX_OK);
+}
+
+static void bench_bls_aggregate(void)
+{
+  // Aggregate 3 signatures
+  CHECK(sys_cx_bls12381_aggregate(bls_signature, sizeof(bls_signature), true,
+                                  output, BLS_COMPRESSED_SIG_LEN) == CX_OK);
+  CHECK(sys_cx_bls12381_aggregate(bls_signature, sizeof(bls_signature), false,
+                                  output, BLS_COMPRESSED_SIG_LEN) == CX_OK);
+  CHECK(sys_cx_bls12381_aggregate(bls_signature, sizeof(bls_signature), false,
+                                  output, BLS_COMPRESSED_SIG_LEN) == CX_OK);
+}
+
+/* Big numbers, 256-bit operands modulo the secp256k1 field prime */
+
+static const uint8_t bn_p[32] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x2f
+};
+
+static cx_bn_t bn_a, bn_b, bn_m, bn_r, bn_r2;
+
+static void setup_bn(void)
+{
+  if (sys_cx_bn_is_locked()) {
+    return;
+  }
+  CHECK(sys_cx_bn_lock(32, 0) == CX_OK);
+  CHECK(sys_cx_bn_alloc_init(&bn_a, 32, message + 32, 32) == CX_OK);
+  CHECK(sys_cx_bn_alloc_init(&bn_b, 32, message + 64, 32) == CX_OK);
+  CHECK(sys_cx_bn_alloc_init(&bn_m, 32, bn_p, sizeof(bn_p)) == CX_OK);
+  CHECK(sys_cx_bn_alloc(&bn_r, 32) == CX_OK);
+  CHECK(sys_cx_bn_alloc(&bn_r2, 64) == CX_OK);
+}
+
+static void bench_bn_add(void)
+{
+  CHECK(sys_cx_bn_add(bn_r, bn_a, bn_b) == CX_OK);
+}
+
+static void bench_bn_mul(void)
+{
+  CHECK(sys_cx_bn_mul(bn_r2, bn_a, bn_b) == CX_OK);
+}
+
+static void bench_bn_mod_add(void)
+{
+  CHECK(sys_cx_bn_mod_add(bn_r, bn_a, bn_b, bn_m) == CX_OK);
+}
+
+static void bench_bn_mod_mul(void)
+{
+  CHECK(sys_cx_bn_mod_mul(bn_r, bn_a, bn_b, bn_m) == CX_OK);
+}
+
+static void bench_bn_mod_pow(void)
+{
+  CHECK(sys_cx_bn_mod_pow(bn_r, bn_a, message + 96, 32, bn_m) == CX_OK);
+}
+
+static void bench_bn_mod_invert_nprime(void)
+{
+  CHECK(sys_cx_bn_mod_invert_nprime(bn_r, bn_a, bn_m) == CX_OK);
+}
+
+/* clang-format off */
+static const benchmark_t benchmarks[] = {
+  { "sha256/1024", NULL, bench_sha256 },
+  { "sha512/1024", NULL, bench_sha512 },
+  { "sha3_256/1024", NULL, bench_sha3_256 },
+  { "blake2b_512/1024", NULL, bench_blake2b_512 },
+  { "ripemd160/1024", NULL, bench_ripemd160 },
+  { "hmac_sha256/1024", NULL, bench_hmac_sha256 },
+  { "hmac_sha512/1024", NULL, bench_hmac_sha512 },
+  { "aes_cbc_encrypt/1024", setup_aes, bench_aes_cbc_encrypt },
+  { "aes_cbc_decrypt/1024", setup_aes, bench_aes_cbc_decrypt },
+  { "ecdsa_sign/secp256k1", setup_secp256k1, ecdsa_sign },
+  { "ecdsa_verify/secp256k1", setup_signed_secp256k1, bench_ecdsa_verify },
+  { "ecdsa_sign/secp256r1", setup_secp256r1, ecdsa_sign },
+  { "ecdsa_verify/secp256r1", setup_signed_secp256r1, bench_ecdsa_verify },
+  { "ecdsa_sign/secp384r1", setup_secp384r1, ecdsa_sign },
+  { "ecdsa_verify/secp384r1", setup_signed_secp384r1, bench_ecdsa_verify },
+  { "ecdsa_sign/brainpoolp256r1", setup_brainpoolp256r1, ecdsa_sign },
+  { "ecdsa_verify/brainpoolp256r1", setup_signed_brainpoolp256r1, bench_ecdsa_verify },
+  { "eddsa_sign/ed25519", setup_ed25519, bench_eddsa_sign },
+  { "eddsa_verify/ed25519", setup_ed25519, bench_eddsa_verify },
+  { "ecdh/secp256k1", setup_secp256k1, bench_ecdh },
+  { "ecdh/secp256r1", setup_secp256r1, bench_ecdh },
+  { "bip32/depth3", setup_bip32, bench_bip32_depth3 },
+  { "bip32/depth5", setup_bip32, bench_bip32_depth5 },
+  { "bip32/depth8", setup_bip32, bench_bip32_depth8 },
+  { "bls_sign/bls12381", setup_bls, bench_bls_sign },
+  { "bls_aggregate3/bls12381", setup_bls, bench_bls_aggregate },
+  { "bn_add/256", setup_bn, bench_bn_add },
+  { "bn_mul/256", setup_bn, bench_bn_mul },
+  { "bn_mod_add/256", setup_bn, bench_bn_mod_add },
+  { "bn_mod_mul/256", setup_bn, bench_bn_mod_mul },
+  { "bn_mod_pow/256", setup_bn, bench_bn_mod_pow },
+  { "bn_mod_invert_nprime/256", setup_bn, bench_bn_mod_invert_nprime },
+};
+/* clang-format on */
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void run_benchmark(const benchmark_t *b, double min_time, bool first)
+{
+  unsigned long iterations, i;
+  double start, elapsed;
+
+  if (b->setup != NULL) {
+    b->setup();
+  }
+
+  // Warm up, then double the number of iterations until min_time is reached
+  b->run();
+  for (iterations = 1;; iterations *= 2) {
+    start = now();
+    for (i = 0; i < iterations; i++) {
+      b->run();
+    }
+    elapsed = now() - start;
+    if (elapsed >= min_time) {
+      break;
+    }
+  }
+
+  printf("%s    {\"name\": \"%s\", \"iterations\": %lu, \"ns_per_op\": %.1f, "
+         "\"ops_per_sec\": %.1f}",
+         first ? "" : ",\n", b->name, iterations, elapsed * 1e9 / iterations,
+         iterations / elapsed);
+  fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *filter = NULL;
+  double min_time = 0.5;
+  bool first = true;
+  size_t i;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:")) != -1) {
+    switch (opt) {
+    case 't':
+      min_time = atof(optarg);
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-t min_seconds] [name_filter]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (optind < argc) {
+    filter = argv[optind];
+  }
+
+  for (i = 0; i < sizeof(message); i++) {
+    message[i] = i * 7 + 1;
+  }
+
+  printf("{\n  \"min_time\": %.3f,\n  \"benchmarks\": [\n", min_time);
+  for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+    if (filter != NULL && strstr(benchmarks[i].name, filter) == NULL) {
+      continue;
+    }
+    run_benchmark(&benchmarks[i], min_time, first);
+    first = false;
+  }
+  printf("\n  ]\n}\n");
+
+  return 0;
+}
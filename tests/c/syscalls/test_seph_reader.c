@@ -0,0 +1,91 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cmocka.h>
+
+#include "bolos/seph_reader.h"
+#include "emulate.h"
+
+static int seph_fd;
+
+static int setup(void **state __attribute__((unused)))
+{
+  int fds[2];
+
+  // Events are read from SEPH_FILENO: write them to a pipe
+  if (pipe(fds) != 0 || dup2(fds[0], SEPH_FILENO) < 0) {
+    return -1;
+  }
+  seph_fd = fds[1];
+
+  return 0;
+}
+
+static void send_packet(uint8_t tag, size_t size)
+{
+  uint8_t packet[3 + 4096];
+
+  packet[0] = tag;
+  packet[1] = (size >> 8) & 0xff;
+  packet[2] = size & 0xff;
+  memset(packet + 3, tag, size);
+
+  assert_true(size <= sizeof(packet) - 3);
+  assert_int_equal(write(seph_fd, packet, 3 + size), 3 + size);
+}
+
+static void assert_packet(uint8_t tag, size_t size, size_t max_length)
+{
+  uint8_t packet[3 + 4096];
+  size_t copied = size + 3 < max_length ? size + 3 : max_length;
+
+  memset(packet, 0, sizeof(packet));
+  assert_int_equal(seph_read_packet(packet, max_length), 3 + size);
+  assert_int_equal(packet[0], tag);
+  assert_int_equal((packet[1] << 8) | packet[2], size);
+  for (size_t i = 3; i < copied; i++) {
+    assert_int_equal(packet[i], tag);
+  }
+  for (size_t i = copied; i < sizeof(packet); i++) {
+    assert_int_equal(packet[i], 0);
+  }
+}
+
+void test_seph_reader(void **state __attribute__((unused)))
+{
+  // Several packets available at once, including an empty one
+  send_packet(0x05, 64);
+  send_packet(0x0e, 0);
+  send_packet(0x10, 4000);
+  assert_packet(0x05, 64, 4096);
+  assert_packet(0x0e, 0, 4096);
+  assert_packet(0x10, 4000, 4096);
+
+  // Truncated packets don't leave their end in the way of the next ones
+  send_packet(0x11, 100);
+  send_packet(0x12, 10);
+  assert_packet(0x11, 100, 16);
+  assert_packet(0x12, 10, 4096);
+
+  // Enough data to go around the read-ahead buffer several times
+  for (int round = 0; round < 40; round++) {
+    for (int i = 0; i < 8; i++) {
+      send_packet(0x20 + i, 1000 + round * 50 + i);
+    }
+    for (int i = 0; i < 8; i++) {
+      assert_packet(0x20 + i, 1000 + round * 50 + i, 4096);
+    }
+  }
+
+  close(seph_fd);
+  assert_int_equal(seph_read_packet((uint8_t[3]){ 0 }, 3), -1);
+}
+
+int main(void)
+{
+  const struct CMUnitTest tests[] = { cmocka_unit_test(test_seph_reader) };
+  return cmocka_run_group_tests(tests, setup, NULL);
+}
@@ -0,0 +1,106 @@
+#include <fcntl.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cmocka.h>
+
+#include "bolos/text_events.h"
+#include "emulate.h"
+
+#define SEPROXYHAL_TAG_SPECULOS_TEXT_EVENT 0xF3
+
+static int seph_fd;
+
+static int setup(void **state __attribute__((unused)))
+{
+  int fds[2];
+
+  // Packets sent by the launcher are written to SEPH_FILENO: read them back
+  // from a pipe
+  if (pipe(fds) != 0 || dup2(fds[1], SEPH_FILENO) < 0) {
+    return -1;
+  }
+  fcntl(fds[0], F_SETFL, O_NONBLOCK);
+  seph_fd = fds[0];
+
+  return 0;
+}
+
+static void assert_text_event(const char *text, int x, int y, unsigned int w,
+                              unsigned int h)
+{
+  uint8_t packet[3 + 256 + 8];
+  size_t text_len = strlen(text);
+  size_t len = text_len + 8;
+
+  assert_int_equal(read(seph_fd, packet, 3 + len), 3 + len);
+  assert_int_equal(packet[0], SEPROXYHAL_TAG_SPECULOS_TEXT_EVENT);
+  assert_int_equal((packet[1] << 8) | packet[2], len);
+  assert_memory_equal(packet + 3, text, text_len);
+  assert_int_equal((int16_t)((packet[3 + text_len] << 8) |
+                             packet[3 + text_len + 1]),
+                   x);
+  assert_int_equal((int16_t)((packet[3 + text_len + 2] << 8) |
+                             packet[3 + text_len + 3]),
+                   y);
+  assert_int_equal((packet[3 + text_len + 4] << 8) | packet[3 + text_len + 5],
+                   w);
+  assert_int_equal((packet[3 + text_len + 6] << 8) | packet[3 + text_len + 7],
+                   h);
+}
+
+static void assert_nothing_sent(void)
+{
+  uint8_t tmp;
+
+  assert_int_equal(read(seph_fd, &tmp, 1), -1);
+}
+
+void test_text_events(void **state __attribute__((unused)))
+{
+  hw_model = MODEL_NANO_X;
+
+  // Characters close enough to each other are merged
+  text_event_add_character(0, 0, 5, 10, 'a');
+  text_event_add_character(6, 0, 5, 10, 'b');
+  text_event_add_character(12, 1, 5, 12, ' ');
+  text_event_add_character(18, 0, 5, 10, 0xe9);
+  assert_nothing_sent();
+
+  // A character on another line sends the previous one
+  text_event_add_character(0, 20, 5, 10, 'c');
+  assert_text_event("ab \xc3\xa9", 0, 0, 23, 13);
+
+  // Same thing for a character too far on the right
+  text_event_add_character(40, 20, 5, 10, 'd');
+  assert_text_event("c", 0, 20, 5, 10);
+
+  // Unknown characters are ignored
+  text_event_add_character(46, 20, 5, 10, 0);
+  assert_nothing_sent();
+
+  // The pending line is sent before a status
+  catch_text_event_from_app(0x01);
+  assert_nothing_sent();
+  catch_text_event_from_app(0x60);
+  assert_text_event("d", 40, 20, 5, 10);
+  catch_text_event_from_app(0x60);
+  assert_nothing_sent();
+
+  // Nothing is sent anymore once the SDK sends its own text lines
+  text_event_add_character(0, 0, 5, 10, 'e');
+  catch_text_event_from_app(0x5A);
+  catch_text_event_from_app(0x60);
+  text_event_add_character(0, 40, 5, 10, 'f');
+  catch_text_event_from_app(0x60);
+  assert_nothing_sent();
+}
+
+int main(void)
+{
+  const struct CMUnitTest tests[] = { cmocka_unit_test(test_text_events) };
+  return cmocka_run_group_tests(tests, setup, NULL);
+}
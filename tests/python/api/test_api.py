@@ -6,6 +6,8 @@ import time
 import pytest
 import requests
 
+from speculos.client import Api
+
 API_URL = "http://127.0.0.1:5000"
 
 
@@ -143,6 +145,19 @@ class TestApi:
             if not response.content.startswith(b"\x89PNG"):
                 raise ValueError("Expected PNG image data")
 
+    def test_screen_compare(self):
+        with requests.get(f"{API_URL}/screenshot", timeout=10) as response:
+            screenshot = response.content
+        api = Api(API_URL)
+        result = api.compare_screen(screenshot)
+        if not result["match"] or result["bbox"] is not None:
+            raise AssertionError(f"Expected the screen to match its own screenshot, got {result}")
+
+        # Unknown golden image hash
+        with requests.post(f"{API_URL}/screen/compare", json={"hash": "0" * 64}, timeout=10) as response:
+            if response.status_code != 404:
+                raise AssertionError(f"Expected status code 404, got {response.status_code}")
+
     def test_apdu(self):
         # Send GET_VERSION to get 16 bytes of random
         with requests.post(f"{API_URL}/apdu", json={"data": "e003000000"}, timeout=10) as response:
@@ -152,6 +167,49 @@ class TestApi:
             if len(data) != 5 or data[-2:] != b"\x90\x00":
                 raise ValueError(f"Expected 5 bytes with status word 0x9000, got {data}")
 
+    def test_apdus(self):
+        payload = {"apdus": [{"data": "e003000000"}, {"data": "e003000000"}], "expected_sw": ["9000"]}
+        with requests.post(f"{API_URL}/apdus", json=payload, stream=True, timeout=10) as response:
+            if response.status_code != 200:
+                raise AssertionError(f"Expected status code 200, got {response.status_code}")
+            results = [json.loads(line) for line in response.iter_lines() if line]
+        if [result.get("index") for result in results] != [0, 1, None]:
+            raise AssertionError(f"Expected 2 responses and a summary, got {results}")
+        for result in results[:2]:
+            if not result["ok"] or result["sw"] != "9000" or len(bytes.fromhex(result["data"])) != 5:
+                raise ValueError(f"Expected 5 bytes with status word 0x9000, got {result}")
+        if results[2] != {"done": True, "count": 2, "errors": 0}:
+            raise ValueError(f"Unexpected batch summary {results[2]}")
+
+    def test_apdus_stop_on_error(self):
+        payload = {"apdus": [{"data": "e003000000", "expected_sw": ["6d00"]}, {"data": "e003000000"}]}
+        with requests.post(f"{API_URL}/apdus", json=payload, stream=True, timeout=10) as response:
+            results = [json.loads(line) for line in response.iter_lines() if line]
+        if len(results) != 2 or results[0]["ok"] or results[1] != {"done": True, "count": 1, "errors": 1}:
+            raise AssertionError(f"Expected the batch to stop after the first APDU, got {results}")
+
+    def test_apdus_invalid_data(self):
+        for payload in [{"apdus": []}, {"apdus": [{"data": "xyz"}]}, {"apdus": [{"data": "00"}], "expected_sw": ["90"]}]:
+            with requests.post(f"{API_URL}/apdus", json=payload, timeout=10) as response:
+                if response.status_code != 400:
+                    raise AssertionError(f"Expected status code 400, got {response.status_code}")
+
+    def test_channel(self):
+        api = Api(API_URL)
+        api.open_channel()
+        try:
+            # GET_VERSION returns 3 bytes and 0x9000
+            if len(api._apdu_exchange(bytes.fromhex("e003000000"))) != 3:
+                raise AssertionError("Expected 3 bytes of response")
+            api.press_and_release("right")
+        finally:
+            api.close_channel()
+
+    def test_channel_invalid_request(self):
+        with requests.get(f"{API_URL}/ws", timeout=10) as response:
+            if response.status_code != 400:
+                raise AssertionError(f"Expected status code 400, got {response.status_code}")
+
     def test_apdu_invalid_data(self):
         with requests.post(f"{API_URL}/apdu", json={"data": "xyz"}, timeout=10) as response:
             if response.status_code != 400:
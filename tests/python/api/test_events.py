@@ -0,0 +1,74 @@
+import re
+import threading
+
+from speculos.api import events
+from speculos.api.events import EventFilter, EventsBroadcaster
+from speculos.observer import TextEvent
+
+
+def text_event(text: str, x: int = 0, y: int = 0) -> TextEvent:
+    return TextEvent(text, x, y, 10, 10, False)
+
+
+class TestEventsBroadcaster:
+    def test_sequence_numbers(self):
+        broadcaster = EventsBroadcaster()
+        for text in ["a", "b", "c"]:
+            broadcaster.broadcast(text_event(text))
+
+        found, next_seq = broadcaster.get_events(1)
+        if [(seq, e.text) for seq, e in found] != [(1, "b"), (2, "c")] or next_seq != 3:
+            raise AssertionError(f"Unexpected events {found}, {next_seq}")
+
+        # Sequence numbers aren't reset along with the log
+        broadcaster.clear_log()
+        broadcaster.broadcast(text_event("d"))
+        found, next_seq = broadcaster.get_events(0)
+        if [(seq, e.text) for seq, e in found] != [(3, "d")] or next_seq != 4:
+            raise AssertionError(f"Unexpected events {found}, {next_seq}")
+
+    def test_ring_buffer(self, monkeypatch):
+        monkeypatch.setattr(events, "EVENT_LOG_SIZE", 4)
+        broadcaster = EventsBroadcaster()
+        for i in range(10):
+            broadcaster.broadcast(text_event(str(i)))
+
+        if [e.text for e in broadcaster.events] != ["6", "7", "8", "9"]:
+            raise AssertionError(f"Unexpected log {broadcaster.events}")
+        found, _ = broadcaster.get_events(8)
+        if [seq for seq, _ in found] != [8, 9]:
+            raise AssertionError(f"Unexpected events {found}")
+
+    def test_filters(self):
+        broadcaster = EventsBroadcaster()
+        broadcaster.broadcast(text_event("Review", 10, 10))
+        broadcaster.broadcast(text_event("Review transaction", 10, 30))
+        broadcaster.broadcast(text_event("Approve", 10, 50))
+
+        def texts(event_filter):
+            return [e.text for _, e in broadcaster.get_events(0, event_filter)[0]]
+
+        if texts(EventFilter(text="Review")) != ["Review"]:
+            raise AssertionError("Exact text filter failed")
+        if texts(EventFilter(regexp=re.compile("^Review"))) != ["Review", "Review transaction"]:
+            raise AssertionError("Regexp filter failed")
+        if texts(EventFilter(region=(0, 20, 100, 40))) != ["Review transaction", "Approve"]:
+            raise AssertionError("Region filter failed")
+        if texts(EventFilter(regexp=re.compile("Review"), region=(0, 20, 100, 20))) != ["Review transaction"]:
+            raise AssertionError("Combined filters failed")
+
+    def test_wait(self):
+        broadcaster = EventsBroadcaster()
+        broadcaster.broadcast(text_event("Hello"))
+
+        found, next_seq = broadcaster.wait_events(1, timeout=0.01)
+        if found or next_seq != 1:
+            raise AssertionError("Expected no event")
+
+        event_filter = EventFilter(text="Approve")
+        timer = threading.Timer(0.05, lambda: [broadcaster.broadcast(text_event(t)) for t in ["Reject", "Approve"]])
+        timer.start()
+        found, next_seq = broadcaster.wait_events(1, event_filter, timeout=5)
+        timer.join()
+        if [(seq, e.text) for seq, e in found] != [(2, "Approve")] or next_seq != 3:
+            raise AssertionError(f"Unexpected events {found}, {next_seq}")
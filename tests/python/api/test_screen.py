@@ -0,0 +1,62 @@
+import io
+
+from PIL import Image
+
+from speculos.api.screen import FrameUpdateQueue, GoldenImages
+from speculos.mcu.display import FrameBuffer
+
+
+def png(color: tuple[int, int, int], size: tuple[int, int] = (8, 4)) -> bytes:
+    data = io.BytesIO()
+    Image.new("RGB", size, color).save(data, format="PNG")
+    return data.getvalue()
+
+
+class TestGoldenImages:
+    def test_add_and_get(self):
+        golden_images = GoldenImages()
+        digest = golden_images.add(png((255, 0, 0)))
+        if golden_images.add(png((255, 0, 0))) != digest:
+            raise AssertionError("The same image should get the same hash")
+        image = golden_images.get(digest)
+        if image is None or image.getpixel((0, 0)) != (255, 0, 0):
+            raise AssertionError("Golden image not stored")
+        if golden_images.get("0" * 64) is not None:
+            raise AssertionError("Unknown hash should not be found")
+
+    def test_least_recently_used_are_dropped(self):
+        # Room for two 8x4 RGB images
+        golden_images = GoldenImages(max_size=2 * 8 * 4 * 3)
+        red = golden_images.add(png((255, 0, 0)))
+        green = golden_images.add(png((0, 255, 0)))
+        golden_images.get(red)
+        blue = golden_images.add(png((0, 0, 255)))
+        if golden_images.get(green) is not None:
+            raise AssertionError("The least recently used image should be dropped")
+        if golden_images.get(red) is None or golden_images.get(blue) is None:
+            raise AssertionError("The most recently used images should be kept")
+
+
+
+class TestFrameUpdateQueue:
+    def test_resync_when_full(self):
+        fb = FrameBuffer("nanosp")
+        updates = FrameUpdateQueue(fb, size=2)
+        fb.add_frame_listener(updates.put)
+        # The client doesn't read the first screen nor the next rectangles
+        for x in range(3):
+            fb.draw_point(x, 0, 0xFFFFFF)
+            fb.update_screenshot()
+            fb.pixels = {}
+
+        # The first screen and the first rectangle were replaced with the screen of the second rectangle
+        width, height = fb.current_screen_size
+        update = updates.get()
+        if (update.seq, update.x, update.y, update.w, update.h) != (fb.frame_seq - 1, 0, 0, width, height):
+            raise AssertionError(f"Expected a full frame resync, got {update.seq}, {update.x}, {update.y}, {update.w}x{update.h}")
+        if update.data[:3] != update.data[3:6] or update.data[6:9] == update.data[:3]:
+            raise AssertionError("The resync should contain the pixels drawn so far")
+        update = updates.get()
+        if (update.seq, update.x, update.y, update.w, update.h) != (fb.frame_seq, 2, 0, 1, 1):
+            raise AssertionError(f"Expected the last rectangle, got {update.seq}, {update.x}, {update.y}, {update.w}x{update.h}")
+        fb.remove_frame_listener(updates.put)
@@ -12,6 +12,10 @@ from enum import IntEnum
 import pytest
 
 import speculos.client
+from speculos.mcu.headless import Headless
+from speculos.mcu.seph_capture import read_capture
+from speculos.mcu.seproxyhal import RENDER_METHOD, DisplayPackets
+from speculos.mcu.struct import DisplayArgs, ServerArgs
 
 CLA = 0xE0
 
@@ -53,6 +57,9 @@ def test_boil_get_public_key_with_user_approval(client, app):
         path = importlib.resources.files(__package__) / "resources" / f"boil_getpubkey_{app.model}.png"
         if not speculos.client.screenshot_equal(path, io.BytesIO(screenshot)):
             raise ValueError("Screenshot does not match expected image")
+        # Same comparison, done by the server
+        if not client.compare_screen(path.read_bytes())["match"]:
+            raise ValueError("Screen does not match expected image")
 
         client.press_and_release("both")
 
@@ -70,3 +77,22 @@ def test_boil_automation(client, app):
 
     payload = bytes.fromhex("058000002c80000001800000000000000000000000")
     client.apdu_exchange(CLA, Ins.GET_PUBLIC_KEY, payload, p1=0x01, p2=0x00)
+
+
+def test_boil_seph_capture_replay(client_seph_capture):
+    """Replay the display packets recorded with --seph-capture, as tools/render-bench.py does."""
+
+    client, path = client_seph_capture
+    # The home screen is drawn before the app waits for an APDU
+    client.apdu_exchange(CLA, Ins.GET_VERSION, b"")
+
+    model, packets = read_capture(path)
+    display_args = DisplayArgs("MATTE_BLACK", model, False, RENDER_METHOD.FLUSHED, None, 1, None, None)
+    display = Headless(display_args, ServerArgs(None, None, None, None, None, None))
+    display_packets = DisplayPackets()
+    for tag, data in packets:
+        display_packets.replay(display, tag, data)
+
+    replayed = io.BytesIO(display.m.get_public_screenshot())
+    if not speculos.client.screenshot_equal(io.BytesIO(client.get_screenshot()), replayed):
+        raise ValueError("The replayed capture doesn't match the screen of the app")
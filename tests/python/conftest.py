@@ -89,6 +89,15 @@ def client_boil(request):
         yield _client
 
 
+@pytest.fixture(scope="function", params=default_boil_app(), ids=idfn)
+def client_seph_capture(request, tmp_path):
+    """Record the display packets of the app, see test_boil_seph_capture_replay()."""
+
+    path = tmp_path / f"{request.param.model}.seph"
+    with client_instance(request.param, ["--seph-capture", str(path)]) as _client:
+        yield _client, path
+
+
 @pytest.fixture(scope="function", params=default_boil_app(), ids=idfn)
 def client_vnc(request):
     # Pytest has changed its API in version 4: https://github.com/pytest-dev/pytest/pull/4564
@@ -0,0 +1,189 @@
+import socket
+import threading
+import time
+
+from speculos.api.apdu import APDUBridge
+from speculos.mcu.apdu import ApduArbiter, ApduServer
+
+
+class FakeDisplay:
+    def __init__(self) -> None:
+        self.sent: list[bytes] = []
+
+    def forward_to_app(self, packet: bytes) -> None:
+        self.sent.append(packet)
+
+
+class FakeNotifier:
+    def __init__(self) -> None:
+        self.display = FakeDisplay()
+        self.notifiers: dict = {}
+
+    def add_notifier(self, device) -> None:
+        self.notifiers[device.fileno] = device
+
+    def remove_notifier(self, fd: int) -> None:
+        self.notifiers.pop(fd)
+
+
+def send_apdu(sock: socket.socket, apdu: bytes) -> None:
+    sock.sendall(len(apdu).to_bytes(4, "big") + apdu)
+
+
+def recv_response(sock: socket.socket) -> bytes:
+    size = int.from_bytes(sock.recv(4), "big")
+    return sock.recv(size + 2)
+
+
+class TestApduServer:
+    def setup_method(self):
+        self.server = ApduServer(port=0)
+        self.screen = FakeNotifier()
+        self.peers = []
+        for _ in range(2):
+            self.peers.append(socket.create_connection(self.server.file.getsockname()))
+            self.server.can_read(self.screen)
+        self.clients = list(self.server.clients)
+
+    def teardown_method(self):
+        for client in self.clients:
+            client.file.close()
+        for peer in self.peers:
+            peer.close()
+        self.server.file.close()
+
+    def test_responses_are_routed_to_their_client(self):
+        a, b = self.peers
+        # Client 0 pipelines two APDUs, client 1 sends one
+        send_apdu(a, b"\xe0\x01")
+        send_apdu(a, b"\xe0\x02")
+        send_apdu(b, b"\xe0\x03")
+        for client in [self.clients[0], self.clients[0], self.clients[1]]:
+            client.can_read(self.screen)
+
+        # Only one APDU at a time is sent to the app
+        if self.screen.display.sent != [b"\xe0\x01"]:
+            raise AssertionError(f"Unexpected APDUs sent to the app: {self.screen.display.sent}")
+
+        self.server.forward_to_client(b"\x01\x90\x00")
+        self.server.forward_to_client(b"\x03\x90\x00")
+        self.server.forward_to_client(b"\x02\x90\x00")
+
+        # The clients are served in turn
+        if self.screen.display.sent != [b"\xe0\x01", b"\xe0\x03", b"\xe0\x02"]:
+            raise AssertionError(f"Unexpected order: {self.screen.display.sent}")
+        if [recv_response(a), recv_response(a)] != [b"\x01\x90\x00", b"\x02\x90\x00"]:
+            raise AssertionError("Unexpected responses for client 0")
+        if recv_response(b) != b"\x03\x90\x00":
+            raise AssertionError("Unexpected response for client 1")
+
+    def test_disconnected_client(self):
+        a, b = self.peers
+        send_apdu(a, b"\xe0\x01")
+        send_apdu(a, b"\xe0\x02")
+        send_apdu(b, b"\xe0\x03")
+        for client in [self.clients[0], self.clients[0], self.clients[1]]:
+            client.can_read(self.screen)
+
+        a.close()
+        self.clients[0].can_read(self.screen)
+        if self.clients[0] in self.server.clients:
+            raise AssertionError("Disconnected client not removed")
+
+        # The response to its pending APDU is dropped, and its queue too
+        self.server.forward_to_client(b"\x01\x90\x00")
+        if self.screen.display.sent != [b"\xe0\x01", b"\xe0\x03"]:
+            raise AssertionError(f"Unexpected APDUs sent to the app: {self.screen.display.sent}")
+        self.server.forward_to_client(b"\x03\x90\x00")
+        if recv_response(b) != b"\x03\x90\x00":
+            raise AssertionError("Unexpected response for client 1")
+
+
+class FakeSeph:
+    """The app, shared by the TCP server and the REST API"""
+
+    def __init__(self, server: ApduServer, sent: list[bytes]) -> None:
+        self.server = server
+        self.sent = sent
+        self.apdu_arbiter = server.arbiter
+        self.apdu_callbacks: list = []
+
+    def get_tick_count(self) -> int:
+        return 0
+
+    def to_app(self, packet: bytes) -> None:
+        self.sent.append(packet)
+
+    def respond(self, packet: bytes) -> None:
+        # As SeProxyHal does with a response of the app
+        self.server.forward_to_client(packet)
+        for callback in self.apdu_callbacks:
+            callback(packet)
+
+
+def wait_until(condition) -> None:
+    deadline = time.monotonic() + 5
+    while not condition():
+        if time.monotonic() > deadline:
+            raise AssertionError("Timeout")
+        time.sleep(0.01)
+
+
+class TestApduArbiter:
+    def setup_method(self):
+        self.server = ApduServer(port=0, arbiter=ApduArbiter())
+        self.screen = FakeNotifier()
+        self.peer = socket.create_connection(self.server.file.getsockname())
+        self.server.can_read(self.screen)
+        self.client = self.server.clients[0]
+        self.seph = FakeSeph(self.server, self.screen.display.sent)
+        self.bridge = APDUBridge(self.seph)
+
+    def teardown_method(self):
+        self.client.file.close()
+        self.peer.close()
+        self.server.file.close()
+
+    def transmit(self, data: bytes, responses: list[bytes]) -> threading.Thread:
+        thread = threading.Thread(target=lambda: responses.append(self.bridge.transmit(data)))
+        thread.start()
+        return thread
+
+    def test_tcp_apdu_waits_for_the_bridge(self):
+        responses: list[bytes] = []
+        thread = self.transmit(b"\xb0\x01", responses)
+        wait_until(lambda: self.seph.sent == [b"\xb0\x01"])
+
+        # Queued until the app answered the REST API
+        send_apdu(self.peer, b"\xe0\x01")
+        self.client.can_read(self.screen)
+        if self.seph.sent != [b"\xb0\x01"]:
+            raise AssertionError(f"TCP APDU sent while the app is busy: {self.seph.sent}")
+
+        self.seph.respond(b"\x01\x90\x00")
+        thread.join(timeout=5)
+        if responses != [b"\x01\x90\x00"] or self.seph.sent != [b"\xb0\x01", b"\xe0\x01"]:
+            raise AssertionError(f"Unexpected exchanges: {responses}, {self.seph.sent}")
+
+        self.seph.respond(b"\x02\x90\x00")
+        if recv_response(self.peer) != b"\x02\x90\x00":
+            raise AssertionError("The TCP client should get its own response")
+
+    def test_bridge_waits_for_tcp_apdu(self):
+        send_apdu(self.peer, b"\xe0\x01")
+        self.client.can_read(self.screen)
+
+        responses: list[bytes] = []
+        thread = self.transmit(b"\xb0\x01", responses)
+        time.sleep(0.05)
+        if self.seph.sent != [b"\xe0\x01"]:
+            raise AssertionError(f"REST APDU sent while the app is busy: {self.seph.sent}")
+
+        self.seph.respond(b"\x01\x90\x00")
+        if recv_response(self.peer) != b"\x01\x90\x00":
+            raise AssertionError("The TCP client should get its own response")
+        wait_until(lambda: self.seph.sent == [b"\xe0\x01", b"\xb0\x01"])
+        self.seph.respond(b"\x02\x90\x00")
+        thread.join(timeout=5)
+        if responses != [b"\x02\x90\x00"]:
+            raise AssertionError(f"Unexpected response: {responses}")
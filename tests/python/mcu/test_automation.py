@@ -1,5 +1,6 @@
 import importlib.resources
 import json
+import re
 
 import jsonschema
 import pytest
@@ -63,3 +64,48 @@ class TestAutomation:
 
         if auto.get_actions("1234", 35, 3) != regexp_actions:
             raise AssertionError("Actions do not match expected regexp actions")
+
+    def test_first_matching_rule_wins(self):
+        document = {
+            "version": 1,
+            "rules": [
+                {"regexp": "Review", "y": 10, "actions": [["button", 1, True]]},
+                {"text": "Review transaction", "actions": [["button", 2, True]]},
+                {"regexp": "^Rev", "actions": [["exit"]]},
+                {"regexp": "(a)\\1", "actions": [["setbool", "aa", True]]},
+            ],
+        }
+        auto = automation.Automation(json.dumps(document))
+        if auto.get_actions("Review transaction", 0, 10) != [["button", 1, True]]:
+            raise AssertionError("The first rule should match")
+        if auto.get_actions("Review transaction", 0, 0) != [["button", 2, True]]:
+            raise AssertionError("The text rule should match")
+        if auto.get_actions("Revoke", 0, 0) != [["exit"]]:
+            raise AssertionError("The regexp rule should match")
+        if auto.get_actions("aa", 0, 0) != [["setbool", "aa", True]]:
+            raise AssertionError("The regexp with a backreference should match")
+        if auto.get_actions("Approve", 0, 0) != []:
+            raise AssertionError("No rule should match")
+
+    def test_conditions(self):
+        document = {
+            "version": 1,
+            "rules": [
+                {"conditions": [["a", True], ["b", False]], "actions": [["exit"]]},
+                {"conditions": [["a", True], ["a", False]], "actions": [["button", 1, True]]},
+            ],
+        }
+        auto = automation.Automation(json.dumps(document))
+        if auto.get_actions("text", 0, 0) != []:
+            raise AssertionError("Unset variables should be false")
+        auto.set_bool("a", True)
+        if auto.get_actions("text", 0, 0) != [["exit"]]:
+            raise AssertionError("Conditions should be met")
+        auto.set_bool("b", True)
+        auto.set_bool("unknown", True)
+        if auto.get_actions("text", 0, 0) != []:
+            raise AssertionError("Conditions should not be met")
+
+    def test_invalid_regexp(self):
+        with pytest.raises(re.error):
+            automation.Automation('{"version": 1, "rules": [{"regexp": "(", "actions": []}]}')
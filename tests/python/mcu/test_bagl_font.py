@@ -0,0 +1,20 @@
+from speculos.mcu import bagl_font
+
+
+class TestBaglFont:
+    def test_get(self):
+        font = bagl_font.get(bagl_font.BAGL_FONT_OPEN_SANS_REGULAR_11_14PX | 0x8000)
+        if font is None or font.font_id != bagl_font.BAGL_FONT_OPEN_SANS_REGULAR_11_14PX:
+            raise AssertionError("Font id should be masked")
+        if bagl_font.get(bagl_font.BAGL_FONT_SYMBOLS_1) is not None:
+            raise AssertionError("Font not in the pack should not be found")
+
+    def test_font_pack(self):
+        if bagl_font.FONTS is not bagl_font.get_fonts():
+            raise AssertionError("Font pack should be loaded once")
+        for font in bagl_font.FONTS:
+            if len(font.characters) > font.last_char - font.first_char + 1:
+                raise AssertionError(f"Too many characters in font {font.font_id}")
+            for character in font.characters:
+                if character.bitmap_offset + character.bitmap_byte_count > len(font.bitmap):
+                    raise AssertionError(f"Character bitmap out of font {font.font_id} bitmap")
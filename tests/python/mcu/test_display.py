@@ -0,0 +1,137 @@
+import threading
+
+from speculos.mcu.display import FrameBuffer
+
+
+def draw(fb: FrameBuffer, x: int, y: int, color: int) -> None:
+    fb.draw_point(x, y, color)
+    fb.update_screenshot()
+    fb.pixels = {}
+
+
+class TestFrameHash:
+    def test_hash_follows_content(self):
+        fb = FrameBuffer("nanosp")
+        seq, initial = fb.get_frame()
+
+        draw(fb, 1, 2, 0xDDDDDD)
+        seq1, hash1 = fb.get_frame()
+        if seq1 != seq + 1 or hash1 == initial:
+            raise AssertionError("Frame sequence number and hash should change with the content")
+
+        # Same content again: new frame, same hash
+        draw(fb, 1, 2, 0xDDDDDD)
+        seq2, hash2 = fb.get_frame()
+        if seq2 != seq1 + 1 or hash2 != hash1:
+            raise AssertionError("Identical frames should have the same hash")
+
+        other = FrameBuffer("nanosp")
+        draw(other, 1, 2, 0xDDDDDD)
+        if other.get_frame()[1] != hash1:
+            raise AssertionError("The hash should only depend on the content")
+
+    def test_hash_of_rendered_pixels(self):
+        fb = FrameBuffer("nanosp")
+        _, initial = fb.get_frame()
+        # A pixel drawn with the background color doesn't change the image
+        draw(fb, 1, 2, fb.default_color)
+        if fb.get_frame()[1] != initial:
+            raise AssertionError("The hash should only depend on the rendered pixels")
+
+    def test_wait_frame(self):
+        fb = FrameBuffer("nanosp")
+        _, initial = fb.get_frame()
+
+        matched, _, frame_hash = fb.wait_frame(not_hash=initial, timeout=0.01)
+        if matched or frame_hash != initial:
+            raise AssertionError("Expected a timeout")
+
+        timer = threading.Timer(0.05, draw, args=(fb, 3, 4, 0xDDDDDD))
+        timer.start()
+        matched, seq, frame_hash = fb.wait_frame(not_hash=initial, timeout=5)
+        timer.join()
+        if not matched or seq != 1 or frame_hash == initial:
+            raise AssertionError("Expected the frame change to be noticed")
+
+        matched, _, _ = fb.wait_frame(hash_=frame_hash, timeout=0)
+        if not matched:
+            raise AssertionError("The current frame should match its own hash")
+
+
+class TestFrameListener:
+    def test_changed_rectangles(self):
+        fb = FrameBuffer("nanosp")
+        width, height = fb.current_screen_size
+        updates = []
+        fb.add_frame_listener(updates.append)
+
+        draw(fb, 5, 6, 0xDDDDDD)
+        fb.draw_point(7, 9, 0xDDDDDD)
+        fb.update_screenshot()
+        fb.pixels = {}
+        # Nothing drawn, nothing sent and no new frame
+        seq = fb.frame_seq
+        fb.update_screenshot()
+        if fb.frame_seq != seq:
+            raise AssertionError("An update without any change isn't a new frame")
+
+        rectangles = [(u.x, u.y, u.w, u.h) for u in updates]
+        if rectangles != [(0, 0, width, height), (5, 6, 1, 1), (7, 9, 1, 1)]:
+            raise AssertionError(f"Unexpected rectangles {rectangles}")
+        if updates[1].data != b"\xdd\xdd\xdd":
+            raise AssertionError("Unexpected pixels")
+
+        # A full screen clear sends the whole screen again
+        fb.draw_rect(0, 0, width, height, 0)
+        draw(fb, 1, 1, 0xDDDDDD)
+        update = updates[-1]
+        if (update.x, update.y, update.w, update.h) != (0, 0, width, height) or update.data != fb.take_screenshot()[1]:
+            raise AssertionError("Expected the whole screen")
+
+        fb.remove_frame_listener(updates.append)
+        draw(fb, 2, 2, 0xDDDDDD)
+        if updates[-1] is not update:
+            raise AssertionError("Removed listener called")
+
+
+class TestFrameObserver:
+    def test_wait_frame_acks(self):
+        fb = FrameBuffer("nanosp")
+        observer, seq = fb.register_frame_observer()
+        if not fb.has_frame_observers or not fb.wait_frame_acks(seq, timeout=0):
+            raise AssertionError("The current frame should already be acknowledged")
+
+        draw(fb, 1, 2, 0x000000)
+        timer = threading.Timer(0.05, fb.ack_frame, args=(observer, seq + 1))
+        timer.start()
+        acked = fb.wait_frame_acks(seq + 1, timeout=5)
+        timer.join()
+        if not acked:
+            raise AssertionError("Expected the acknowledgement to be noticed")
+
+        if fb.ack_frame(observer + 1, seq + 1):
+            raise AssertionError("Unknown observers can't acknowledge frames")
+
+        draw(fb, 3, 4, 0x000000)
+        if not fb.unregister_frame_observer(observer) or fb.has_frame_observers:
+            raise AssertionError("Expected the observer to be removed")
+        if not fb.wait_frame_acks(seq + 2, timeout=0):
+            raise AssertionError("Frames don't wait without observers")
+
+    def test_late_observer(self):
+        fb = FrameBuffer("nanosp")
+        late, seq = fb.register_frame_observer()
+        observer, _ = fb.register_frame_observer()
+
+        draw(fb, 1, 2, 0x000000)
+        fb.ack_frame(observer, seq + 1)
+        if fb.wait_frame_acks(seq + 1, timeout=0.01):
+            raise AssertionError("Expected a timeout")
+
+        # An observer which missed a frame no longer holds the next ones
+        if fb.ack_frame(late, seq + 1):
+            raise AssertionError("The late observer should be unregistered")
+        draw(fb, 3, 4, 0x000000)
+        fb.ack_frame(observer, seq + 2)
+        if not fb.wait_frame_acks(seq + 2, timeout=0):
+            raise AssertionError("Only the remaining observer should be waited for")
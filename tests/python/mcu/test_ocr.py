@@ -0,0 +1,39 @@
+from speculos.mcu import bagl_font, ocr
+
+
+def find_char_by_scanning_fonts(bitmap: bytes) -> str:
+    """Reference implementation: scan every character of every font."""
+    all_values = []
+    for font in bagl_font.FONTS:
+        for character_value, bitmap_struct in ocr.get_font_map(font).items():
+            if bitmap_struct.bitmap.startswith(bitmap):
+                residual_bytes = bitmap_struct.bitmap[len(bitmap) :]
+                if all(b == 0 for b in residual_bytes):
+                    all_values.append(character_value)
+        if all_values:
+            char = max(all_values)
+            return " " if char == "\x80" else char
+    return ""
+
+
+class TestGlyphIndex:
+    def test_index_is_shared(self):
+        if ocr.get_glyph_index(bagl_font.FONTS) is not ocr.get_glyph_index(bagl_font.FONTS):
+            raise AssertionError("Glyph index should be built once per font set")
+
+    def test_find_char_from_bitmap(self):
+        font = ocr.get_font(bagl_font.BAGL_FONT_OPEN_SANS_REGULAR_11_14PX)
+        char = ocr.get_char(font, "c")
+        if ocr.OCR.find_char_from_bitmap(char.bitmap) != "c":
+            raise AssertionError("Character 'c' not found from its bitmap")
+
+    def test_lookup_matches_font_scan(self):
+        for font in bagl_font.FONTS:
+            for bitmap_struct in ocr.get_font_map(font).values():
+                bitmap = bitmap_struct.bitmap
+                # exact, shortened by one byte (trailing '\x00' dropped by the app), and too long
+                for candidate in [bitmap, bitmap[:-1], bitmap + b"\x00"]:
+                    expected = find_char_by_scanning_fonts(candidate)
+                    found = ocr.OCR.find_char_from_bitmap(candidate)
+                    if found != expected:
+                        raise AssertionError(f"Lookup of {candidate.hex()} returned {found!r} instead of {expected!r}")
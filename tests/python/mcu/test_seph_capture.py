@@ -0,0 +1,43 @@
+from speculos.mcu.seph_capture import SephCapture, read_capture
+from speculos.mcu.seproxyhal import SephTag
+
+PACKETS = [
+    (SephTag.NBGL_DRAW_RECT, bytes(range(10))),
+    (SephTag.NBGL_REFRESH, b""),
+    (SephTag.GENERAL_STATUS, b"\x00\x00"),
+]
+
+
+class TestSephCapture:
+    def test_read_back(self, tmp_path):
+        path = tmp_path / "stax.seph"
+        capture = SephCapture(path, "stax")
+        for tag, data in PACKETS:
+            capture.write(tag, memoryview(data))
+        capture.close()
+
+        model, packets = read_capture(path)
+        if model != "stax" or packets != PACKETS:
+            raise AssertionError(f"Unexpected capture: {model}, {packets}")
+
+    def test_truncated(self, tmp_path):
+        path = tmp_path / "nanox.seph"
+        capture = SephCapture(path, "nanox")
+        for tag, data in PACKETS:
+            capture.write(tag, data)
+        capture.close()
+
+        # speculos was killed while writing the last packet
+        path.write_bytes(path.read_bytes()[:-1])
+        _, packets = read_capture(path)
+        if packets != PACKETS[:-1]:
+            raise AssertionError(f"The incomplete packet should be dropped: {packets}")
+
+    def test_invalid_magic(self, tmp_path):
+        path = tmp_path / "invalid.seph"
+        path.write_bytes(b"NOTSEPH!\x00")
+        try:
+            read_capture(path)
+        except ValueError:
+            return
+        raise AssertionError("Expected an invalid capture error")
@@ -0,0 +1,200 @@
+import socket
+import threading
+import time
+
+from speculos.mcu.headless import Headless
+from speculos.mcu.nbgl import nbgl_area_t
+from speculos.mcu.seproxyhal import (
+    MAX_PACKET_SIZE,
+    RENDER_METHOD,
+    TICKER_DELAY,
+    DisplayPackets,
+    PacketReader,
+    SeProxyHal,
+    SephTag,
+    SocketHelper,
+    TimeTickerDaemon,
+)
+from speculos.mcu.struct import MODELS, DisplayArgs, ServerArgs
+
+
+class TestTimeTickerDaemon:
+    def test_pause_before_start(self):
+        ticks = []
+        ticker = TimeTickerDaemon(lambda: ticks.append(time.monotonic()), lambda: None)
+
+        # The ticker is only started once the app is ready: pausing it before must not block
+        ticker.pause()
+        ticker.start()
+        time.sleep(3 * TICKER_DELAY)
+        if ticks:
+            raise AssertionError("No tick should be sent while paused")
+
+        ticker.resume()
+        time.sleep(3 * TICKER_DELAY)
+        if not ticks:
+            raise AssertionError("Ticks should be sent once resumed")
+
+
+class TestPacketReader:
+    @staticmethod
+    def packet(tag: int, data: bytes) -> bytes:
+        return bytes([tag]) + len(data).to_bytes(2, "big") + data
+
+    @staticmethod
+    def send_in_chunks(sock: socket.socket, data: bytes) -> None:
+        for i in range(0, len(data), 4096):
+            sock.sendall(data[i : i + 4096])
+            time.sleep(0.001)
+
+    def test_read_packets(self):
+        app, mcu = socket.socketpair()
+        reader = PacketReader(mcu, size=2 * MAX_PACKET_SIZE)
+
+        # Several packets received at once are all returned
+        app.sendall(self.packet(0x60, b"\x00\x00") + self.packet(0xF2, b"") + self.packet(0x53, b"\x90"))
+        packets = [(tag, bytes(view)) for tag, view in reader.read_packets()]
+        if packets != [(0x60, b"\x00\x00"), (0xF2, b""), (0x53, b"\x90")]:
+            raise AssertionError(f"Unexpected packets {packets}")
+
+        # A packet split across several recv() and the buffer end is reassembled
+        for size in [MAX_PACKET_SIZE - 3, 1000, MAX_PACKET_SIZE - 3]:
+            data = bytes(i & 0xFF for i in range(size))
+            packet = self.packet(0xFD, data)
+            writer = threading.Thread(target=self.send_in_chunks, args=(app, packet))
+            writer.start()
+            packets = reader.read_packets()
+            writer.join()
+            if len(packets) != 1 or packets[0][0] != 0xFD or bytes(packets[0][1]) != data:
+                raise AssertionError("Packet not reassembled")
+
+        # An incomplete packet left at the end of the buffer is moved to its beginning
+        first = self.packet(0xFD, bytes(MAX_PACKET_SIZE - 3))
+        second = self.packet(0xFE, b"image file")
+        writer = threading.Thread(target=self.send_in_chunks, args=(app, first + second[:5]))
+        writer.start()
+        packets = reader.read_packets()
+        writer.join()
+        if [tag for tag, _ in packets] != [0xFD]:
+            raise AssertionError("Only the complete packet should be returned")
+        app.sendall(second[5:])
+        packets = [(tag, bytes(view)) for tag, view in reader.read_packets()]
+        if packets != [(0xFE, b"image file")]:
+            raise AssertionError(f"Unexpected packets {packets}")
+
+        app.close()
+        if reader.read_packets() is not None:
+            raise AssertionError("None should be returned once the socket is closed")
+        mcu.close()
+
+
+class TestSocketHelper:
+    def test_lanes(self):
+        app, mcu = socket.socketpair()
+        helper = SocketHelper(mcu)
+        helper.start()
+
+        helper.add_tick()
+        helper.queue_packet(SephTag.BUTTON_PUSH_EVENT, b"\x02")
+        helper.queue_packet(SephTag.FINGER_EVENT, b"\x01\x00\x10\x00\x20")
+        helper.queue_packet(SephTag.CAPDU_EVENT, b"\xe0\x01", priority=True)
+
+        reader = PacketReader(app)
+        received = []
+        for _ in range(4):
+            # One packet is sent after each status of the app
+            helper.on_status()
+            packets = reader.read_packets()
+            received += [(tag, bytes(view)) for tag, view in packets]
+
+        expected = [
+            (SephTag.CAPDU_EVENT, b"\xe0\x01"),
+            (SephTag.BUTTON_PUSH_EVENT, b"\x02"),
+            (SephTag.FINGER_EVENT, b"\x01\x00\x10\x00\x20"),
+            (SephTag.TICKER_EVENT, b""),
+        ]
+        if received != expected:
+            raise AssertionError(f"Unexpected packets {received}")
+        if helper.get_tick_count() != 1:
+            raise AssertionError("One tick should have been sent")
+
+        helper.on_status()
+        helper.wait_until_tick_is_processed()
+        app.close()
+        mcu.close()
+
+
+class FakeScreen:
+    """Display notifier of a headless display, without any device to notify"""
+
+    def __init__(self, model: str) -> None:
+        display_args = DisplayArgs("MATTE_BLACK", model, False, RENDER_METHOD.FLUSHED, None, 1, None, None)
+        self.display = Headless(display_args, ServerArgs(None, None, None, None, None, None))
+
+
+class TestFrameBarrier:
+    def test_nbgl_refresh(self):
+        app, mcu = socket.socketpair()
+        seph = SeProxyHal(mcu, "stax")
+        # Don't start the ticker, and keep the barriers instead of sending the next events
+        seph.time_ticker_started = True
+        barriers = []
+        seph.socket_helper.on_status = barriers.append
+
+        screen = FakeScreen("stax")
+        fb = screen.display.m
+        streamed = []
+        fb.add_frame_listener(streamed.append)
+        observer, seq = fb.register_frame_observer()
+
+        width, height = MODELS["stax"].screen_size
+        fb.draw_rect(10, 20, 30, 40, 0x000000)
+        area = nbgl_area_t.build({"x0": 0, "y0": 0, "width": width, "height": height, "color": 0, "bpp": 0})
+        seph.handle_packet(screen, SephTag.NBGL_REFRESH, area)
+        seph.handle_packet(screen, SephTag.GENERAL_STATUS, SephTag.GENERAL_STATUS_LAST_COMMAND.to_bytes(2, "big"))
+
+        # A refresh followed by a status is a single frame
+        if fb.frame_seq != seq + 1 or streamed[-1].seq != seq + 1:
+            raise AssertionError(f"Expected a single frame, got {fb.frame_seq - seq}, streamed {streamed[-1].seq}")
+
+        # An observer acknowledging the frames it is streamed doesn't hold the app
+        fb.ack_frame(observer, streamed[-1].seq)
+        start = time.monotonic()
+        barriers[-1]()
+        if time.monotonic() - start > 1:
+            raise AssertionError("The app was held until the frame acknowledgement timeout")
+
+        seph.socket_helper.stop = True
+        app.close()
+        mcu.close()
+
+
+class TestDisplayPackets:
+    def test_replay(self):
+        app, mcu = socket.socketpair()
+        seph = SeProxyHal(mcu, "stax")
+        seph.time_ticker_started = True
+        seph.socket_helper.on_status = lambda barrier: None
+
+        width, height = MODELS["stax"].screen_size
+        packets = [
+            (SephTag.NBGL_DRAW_RECT, nbgl_area_t.build({"x0": 10, "y0": 20, "width": 30, "height": 40, "color": 0, "bpp": 0})),
+            (SephTag.NBGL_REFRESH, nbgl_area_t.build({"x0": 0, "y0": 0, "width": width, "height": height, "color": 0, "bpp": 0})),
+            (SephTag.GENERAL_STATUS, SephTag.GENERAL_STATUS_LAST_COMMAND.to_bytes(2, "big")),
+        ]
+
+        # Drawn by the app, and replayed from a capture without OCR
+        live, replayed = FakeScreen("stax"), FakeScreen("stax")
+        display_packets = DisplayPackets()
+        for tag, data in packets:
+            seph.handle_packet(live, tag, data)
+            display_packets.replay(replayed.display, tag, data)
+
+        if replayed.display.m.frame_seq != live.display.m.frame_seq:
+            raise AssertionError("The replay didn't update the screen as the app did")
+        if replayed.display.m._get_image() != live.display.m._get_image():
+            raise AssertionError("The replayed screen differs from the one drawn by the app")
+
+        seph.socket_helper.stop = True
+        app.close()
+        mcu.close()
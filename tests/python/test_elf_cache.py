@@ -0,0 +1,54 @@
+from speculos.elf_cache import ElfCache
+
+
+class TestElfCache:
+    def test_round_trip(self, tmp_path):
+        elf = tmp_path / "app.elf"
+        elf.write_bytes(b"\x7fELF" + bytes(100))
+        cache = ElfCache(tmp_path / "cache")
+
+        params = {"use_bagl": True}
+        if cache.load(str(elf), "app", params) is not None:
+            raise AssertionError("Cache should be empty")
+
+        cache.store(str(elf), "app", params, {"text_size": 100})
+        if cache.load(str(elf), "app", params) != {"text_size": 100}:
+            raise AssertionError("Entry should be cached")
+        if cache.load(str(elf), "app", {"use_bagl": False}) is not None:
+            raise AssertionError("Entries should be keyed by parameters")
+        if cache.load(str(elf), "sharedlib", params) is not None:
+            raise AssertionError("Entries should be keyed by kind")
+
+    def test_keyed_by_content(self, tmp_path):
+        elf = tmp_path / "app.elf"
+        elf.write_bytes(b"first")
+        cache = ElfCache(tmp_path / "cache")
+        cache.store(str(elf), "app", {}, {"text_size": 1})
+        first_sites = cache.svc_sites_path(str(elf), 25)
+
+        elf.write_bytes(b"second")
+        cache = ElfCache(tmp_path / "cache")
+        if cache.load(str(elf), "app", {}) is not None:
+            raise AssertionError("Modified file should not hit the cache")
+        if cache.svc_sites_path(str(elf), 25) == first_sites:
+            raise AssertionError("SVC sites should be keyed by content")
+
+    def test_svc_sites_keyed_by_api_level(self, tmp_path):
+        elf = tmp_path / "app.elf"
+        elf.write_bytes(b"\x7fELF")
+        cache = ElfCache(tmp_path / "cache")
+        # The launcher only patches the SVC followed by CMP R1 or BX LR from API level 23
+        if cache.svc_sites_path(str(elf), 22) == cache.svc_sites_path(str(elf), 23):
+            raise AssertionError("SVC sites should be keyed by API level")
+        if cache.svc_sites_path(str(elf), "25") != cache.svc_sites_path(str(elf), 25):
+            raise AssertionError("API levels should be normalized")
+
+    def test_disabled(self, tmp_path):
+        not_a_dir = tmp_path / "file"
+        not_a_dir.write_bytes(b"")
+        cache = ElfCache(not_a_dir / "cache")
+        if cache.enabled or cache.svc_sites_path(str(not_a_dir), 25) is not None:
+            raise AssertionError("Cache should be disabled")
+        cache.store(str(not_a_dir), "app", {}, {})
+        if cache.load(str(not_a_dir), "app", {}) is not None:
+            raise AssertionError("Nothing should be cached")
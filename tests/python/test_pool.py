@@ -0,0 +1,170 @@
+import time
+
+from speculos.pool import Pool, PoolError, PoolKey, PortAllocator
+
+KEY = PoolKey("/apps/boil.elf", "nanox")
+
+
+class FakeProcess:
+    def __init__(self, fail: bool = False) -> None:
+        self.fail = fail
+        self.alive = False
+        self.stopped = False
+
+    def start(self) -> None:
+        if self.fail:
+            raise PoolError("boom")
+        self.alive = True
+
+    def stop(self) -> None:
+        self.alive = False
+        self.stopped = True
+
+    def is_alive(self) -> bool:
+        return self.alive
+
+
+class FakeLauncher:
+    def __init__(self, fail: bool = False) -> None:
+        self.fail = fail
+        self.processes: list[FakeProcess] = []
+
+    def __call__(self, key: PoolKey, api_port: int, apdu_port: int) -> FakeProcess:
+        process = FakeProcess(self.fail)
+        self.processes.append(process)
+        return process
+
+
+def wait_until(condition, timeout: float = 5.0) -> None:
+    deadline = time.monotonic() + timeout
+    while not condition():
+        if time.monotonic() > deadline:
+            raise AssertionError("Timeout")
+        time.sleep(0.01)
+
+
+def instances(pool: Pool, state: str) -> int:
+    return pool.metrics()["pools"][0]["instances"][state]
+
+
+class TestPortAllocator:
+    def test_allocate_and_release(self):
+        ports = PortAllocator(41000, 41003)
+        first = ports.allocate(2)
+        second = ports.allocate(2)
+        if len(set(first + second)) != 4:
+            raise AssertionError(f"Ports should be unique: {first}, {second}")
+        try:
+            ports.allocate(1)
+        except PoolError:
+            pass
+        else:
+            raise AssertionError("The range should be exhausted")
+
+        for port in first:
+            ports.release(port)
+        if sorted(ports.allocate(2)) != sorted(first):
+            raise AssertionError("Released ports should be allocated again")
+
+
+class TestPool:
+    def test_lease_and_recycle(self):
+        launcher = FakeLauncher()
+        pool = Pool(launcher, PortAllocator(41100, 41199), warm=1)
+        pool.preload(KEY)
+        wait_until(lambda: instances(pool, "ready") == 1)
+
+        lease = pool.lease(KEY, timeout=5)
+        if lease["api_port"] == lease["apdu_port"] or [lease["app"], lease["model"]] != [KEY.app, KEY.model]:
+            raise AssertionError(f"Unexpected lease: {lease}")
+        # Another instance is started to keep one warm
+        wait_until(lambda: instances(pool, "ready") == 1)
+        if [lease["id"]] != [leased["id"] for leased in pool.leases()]:
+            raise AssertionError("The lease should be listed")
+
+        pool.release(lease["id"])
+        wait_until(lambda: launcher.processes[0].stopped and instances(pool, "stopping") == 0)
+        if pool.leases() or instances(pool, "ready") != 1:
+            raise AssertionError("The released instance should be stopped")
+        try:
+            pool.release(lease["id"])
+        except KeyError:
+            pass
+        else:
+            raise AssertionError("The lease should be unknown once released")
+
+        metrics = pool.metrics()["pools"][0]
+        if metrics["leases"] != 1 or metrics["starts"] != 2 or not metrics["healthy"]:
+            raise AssertionError(f"Unexpected metrics: {metrics}")
+        pool.shutdown()
+
+    def test_expired_lease_and_crash(self):
+        launcher = FakeLauncher()
+        pool = Pool(launcher, PortAllocator(41200, 41299), warm=1)
+        lease = pool.lease(KEY, timeout=5, ttl=0.01)
+        time.sleep(0.02)
+        pool.check()
+        wait_until(lambda: launcher.processes[0].stopped)
+        try:
+            pool.renew(lease["id"])
+        except KeyError:
+            pass
+        else:
+            raise AssertionError("The lease should have expired")
+
+        wait_until(lambda: instances(pool, "ready") == 1)
+        ready = [p for p in launcher.processes if p.alive]
+        ready[0].alive = False
+        pool.check()
+        wait_until(lambda: instances(pool, "ready") == 1 and len(launcher.processes) == 3)
+
+        metrics = pool.metrics()["pools"][0]
+        if metrics["expired_leases"] != 1 or metrics["crashes"] != 1:
+            raise AssertionError(f"Unexpected metrics: {metrics}")
+        pool.shutdown()
+
+    def test_startup_failures(self):
+        pool = Pool(FakeLauncher(fail=True), PortAllocator(41300, 41399), warm=1)
+        try:
+            pool.lease(KEY, timeout=5)
+        except PoolError as e:
+            if "boom" not in str(e):
+                raise AssertionError(f"Unexpected error: {e}") from e
+        else:
+            raise AssertionError("The lease should fail")
+
+        metrics = pool.metrics()["pools"][0]
+        if metrics["healthy"] or metrics["failures"] < 3 or metrics["last_error"] != "boom":
+            raise AssertionError(f"Unexpected metrics: {metrics}")
+
+    def test_retry_after_failures(self):
+        launcher = FakeLauncher(fail=True)
+        pool = Pool(launcher, PortAllocator(41400, 41499), warm=1, retry_delay=0.5)
+        try:
+            pool.lease(KEY, timeout=5)
+        except PoolError:
+            pass
+        else:
+            raise AssertionError("The lease should fail")
+
+        # No instance is started until the delay is over
+        started = len(launcher.processes)
+        try:
+            pool.lease(KEY, timeout=5)
+        except PoolError:
+            pass
+        else:
+            raise AssertionError("The lease should fail while backing off")
+        pool.check()
+        if len(launcher.processes) != started:
+            raise AssertionError("No instance should be started while backing off")
+
+        # The app was fixed: the pool is refilled once the delay is over
+        launcher.fail = False
+        time.sleep(0.5)
+        pool.check()
+        wait_until(lambda: instances(pool, "ready") == 1)
+        lease = pool.lease(KEY, timeout=5)
+        if not pool.metrics()["pools"][0]["healthy"] or lease["model"] != KEY.model:
+            raise AssertionError(f"The pool should be healthy again: {pool.metrics()}")
+        pool.shutdown()
@@ -0,0 +1,41 @@
+import json
+import sys
+
+from speculos.startup_profile import StartupProfile, _process_age
+
+
+class TestStartupProfile:
+    def test_disabled(self, tmp_path):
+        output = tmp_path / "profile.json"
+        profile = StartupProfile()
+        for milestone in ["qemu_spawned", "app_ready", "first_apdu"]:
+            profile.mark(milestone)
+        if profile.marks or output.exists():
+            raise AssertionError("Nothing should be recorded when disabled")
+
+    def test_report_on_first_apdu(self, tmp_path):
+        output = tmp_path / "profile.json"
+        profile = StartupProfile()
+        profile.enable(str(output))
+
+        profile.mark("qemu_spawned")
+        profile.mark("app_ready")
+        if output.exists():
+            raise AssertionError("Profile should only be reported on first APDU")
+
+        profile.mark("first_apdu")
+        profile.mark("first_apdu")
+        lines = output.read_text().splitlines()
+        if len(lines) != 1:
+            raise AssertionError("Profile should be reported once")
+
+        data = json.loads(lines[0])["startup_profile"]
+        if list(data) != ["qemu_spawned", "app_ready", "first_apdu"]:
+            raise AssertionError(f"Unexpected milestones: {data}")
+        if not data["qemu_spawned"] <= data["app_ready"] <= data["first_apdu"]:
+            raise AssertionError(f"Milestones should be ordered: {data}")
+
+    def test_process_age(self):
+        # The milestones include the interpreter startup and the imports, which took some time already
+        if sys.platform == "linux" and _process_age() <= 0:
+            raise AssertionError(f"Unexpected process age: {_process_age()}")
@@ -0,0 +1,118 @@
+import socket
+import struct
+import threading
+
+from speculos import websocket
+from speculos.client import Channel
+from speculos.observer import TextEvent
+from speculos.websocket import OP_BINARY, OP_PING, OP_PONG, OP_TEXT, ChannelMessage, ProtocolError, WebSocket
+
+
+def websocket_pair() -> tuple[WebSocket, WebSocket]:
+    client_sock, server_sock = socket.socketpair()
+    return WebSocket(client_sock, client=True), WebSocket(server_sock, client=False)
+
+
+class TestWebSocket:
+    def test_accept_key(self):
+        # Example from RFC 6455 section 1.3
+        if websocket.accept_key("dGhlIHNhbXBsZSBub25jZQ==") != "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=":
+            raise AssertionError("Invalid Sec-WebSocket-Accept value")
+
+    def test_messages(self):
+        client, server = websocket_pair()
+        # Lengths exercising the 7-bit, 16-bit and 64-bit length encodings
+        for size in [0, 1, 125, 126, 65535, 65536, 100000]:
+            payload = bytes(i & 0xFF for i in range(size))
+            sender = threading.Thread(target=client.send, args=(payload,))
+            sender.start()
+            if server.recv() != (OP_BINARY, payload):
+                raise AssertionError(f"Client message of {size} bytes corrupted")
+            sender.join()
+
+            sender = threading.Thread(target=server.send, args=(payload, OP_TEXT))
+            sender.start()
+            if client.recv() != (OP_TEXT, payload):
+                raise AssertionError(f"Server message of {size} bytes corrupted")
+            sender.join()
+
+    def test_fragmented_message(self):
+        client_sock, server_sock = socket.socketpair()
+        server = WebSocket(server_sock, client=False)
+        mask = b"\x00\x00\x00\x00"
+        client_sock.sendall(bytes([OP_BINARY, 0x82]) + mask + b"he")  # not final
+        client_sock.sendall(bytes([0x80 | OP_PING, 0x80]) + mask)  # ping between fragments
+        client_sock.sendall(bytes([0x80, 0x83]) + mask + b"llo")  # final continuation
+        if server.recv() != (OP_BINARY, b"hello"):
+            raise AssertionError("Fragmented message not reassembled")
+        client = WebSocket(client_sock, client=True)
+        if client._recv_frame() != (True, OP_PONG, b""):
+            raise AssertionError("Ping not answered")
+
+    def test_close(self):
+        client, server = websocket_pair()
+        client.close()
+        if server.recv() is not None:
+            raise AssertionError("Expected the connection to be closed")
+        if client.recv() is not None:
+            raise AssertionError("Expected the close frame to be echoed")
+
+    def test_unmasked_client_frame(self):
+        client_sock, server_sock = socket.socketpair()
+        server = WebSocket(server_sock, client=False)
+        client_sock.sendall(bytes([0x80 | OP_BINARY, 2]) + b"hi")
+        try:
+            server.recv()
+        except ProtocolError:
+            return
+        raise AssertionError("Unmasked client frame accepted")
+
+    def test_text_event(self):
+        event = TextEvent("Räksmörgås", -3, 12, 100, 14, False)
+        message = websocket.encode_text_event(event)
+        if message[0] != websocket.ChannelMessage.TEXT_EVENT:
+            raise AssertionError("Invalid message type")
+        if struct.unpack(">hhHH", message[1:9]) != (-3, 12, 100, 14):
+            raise AssertionError("Invalid text event header")
+        if websocket.decode_text_event(message[1:]) != event:
+            raise AssertionError("Text event not decoded")
+
+
+class TestChannel:
+    def test_concurrent_requests(self):
+        client, server = websocket_pair()
+        channel = Channel(client)
+        results: dict[str, bytes] = {}
+
+        apdu = threading.Thread(target=lambda: results.update(apdu=channel.request(ChannelMessage.APDU, b"\xe0\x01")))
+        apdu.start()
+        if server.recv() != (OP_BINARY, bytes([ChannelMessage.APDU]) + b"\xe0\x01"):
+            raise AssertionError("APDU request not received")
+
+        # A button is pressed while the APDU waits for a user approval
+        button = threading.Thread(target=lambda: results.update(button=channel.request(ChannelMessage.BUTTON, b"\x01")))
+        button.start()
+        if server.recv() != (OP_BINARY, bytes([ChannelMessage.BUTTON, 1])):
+            raise AssertionError("Button request not received")
+        server.send(bytes([ChannelMessage.BUTTON]))
+        button.join(timeout=5)
+        if button.is_alive() or results.get("button") != b"":
+            raise AssertionError(f"Button request not answered: {results}")
+
+        server.send(websocket.encode_text_event(TextEvent("Approve", 0, 0, 10, 10, False)))
+        server.send(bytes([ChannelMessage.APDU]) + b"\x90\x00")
+        apdu.join(timeout=5)
+        if apdu.is_alive() or results.get("apdu") != b"\x90\x00":
+            raise AssertionError(f"APDU request not answered: {results}")
+        if channel.next_event()["text"] != "Approve":
+            raise AssertionError("Text event lost")
+
+    def test_error(self):
+        client, server = websocket_pair()
+        channel = Channel(client)
+        server.send(bytes([ChannelMessage.ERROR, ChannelMessage.APDU]) + b"timeout")
+        try:
+            channel.request(ChannelMessage.APDU, b"\x00\x00\x00\x00\xe0")
+        except TimeoutError:
+            return
+        raise AssertionError("Expected a timeout")
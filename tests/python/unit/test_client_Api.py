@@ -3,6 +3,38 @@ from unittest import TestCase
 from speculos.client import Api
 
 
+class FakeResponse:
+    status_code = 200
+
+    def __init__(self, result: dict) -> None:
+        self.result = result
+
+    def __enter__(self) -> "FakeResponse":
+        return self
+
+    def __exit__(self, *args) -> None:
+        pass
+
+    def json(self) -> dict:
+        return self.result
+
+
+class FakeEventsSession:
+    """Answer GET /events?since=... as the server does, from a list of events."""
+
+    def __init__(self, texts: list[str]) -> None:
+        self.texts = texts
+
+    def get(self, url: str, params: dict) -> FakeResponse:
+        since = params.get("since", len(self.texts))
+        events = [
+            {"text": text, "seq": seq}
+            for seq, text in enumerate(self.texts)
+            if seq >= since and params.get("regexp", text) == text
+        ]
+        return FakeResponse({"events": events, "next": len(self.texts)})
+
+
 class TestApi(TestCase):
     def setUp(self):
         self.api_url = "some random url"
@@ -11,3 +43,18 @@ class TestApi(TestCase):
     def test_close_stream_None_should_not_raise(self):
         self.assertIsNone(self.api.stream)
         self.api.close_stream()
+
+    def test_wait_for_event_ignores_previous_events(self):
+        session = FakeEventsSession(["Approve", "Reject"])
+        self.api.session = session
+        # Both were received on a previous screen
+        self.api.sync_events()
+        session.texts.append("Approve")
+        event = self.api.wait_for_event(regexp="Approve", timeout=0)
+        self.assertEqual(event, {"text": "Approve"})
+        self.assertEqual(self.api.event_seq, 3)
+
+    def test_wait_for_event_syncs_first(self):
+        self.api.session = FakeEventsSession(["Approve"])
+        with self.assertRaises(TimeoutError):
+            self.api.wait_for_event(regexp="Approve", timeout=0)
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+
+"""
+Measure the APDU throughput and latency of speculos, end to end.
+
+An app (apps/boil.elf by default) is started headless, then an APDU script is
+replayed over each transport:
+
+- tcp: the ApduServer (--apdu-port), with its 4-byte length framing,
+- http: one POST /apdu request per APDU,
+- ws: the binary /ws WebSocket channel, the raw path without any HTTP overhead.
+
+The results are printed as JSON: throughput, latency percentiles (in
+milliseconds), startup time and peak RSS of speculos and QEMU.
+
+The script is a text file with one hex-encoded APDU per line, blank lines and
+lines starting with '#' being ignored.
+"""
+
+import argparse
+import json
+import logging
+import math
+import shlex
+import socket
+import sys
+import tempfile
+import time
+from collections.abc import Callable
+from pathlib import Path
+
+import requests
+
+from speculos import websocket
+from speculos.client import SpeculosInstance, split_apdu
+from speculos.websocket import APDU_HEADER, ChannelMessage
+
+# Returns 3 bytes of version on apps/boil.elf
+DEFAULT_SCRIPT = ["e003000000"]
+
+TRANSPORTS = ["tcp", "http", "ws"]
+
+
+def load_script(path: str | None) -> list[bytes]:
+    if path is None:
+        return [bytes.fromhex(apdu) for apdu in DEFAULT_SCRIPT]
+
+    apdus = []
+    for line in Path(path).read_text().splitlines():
+        line = line.strip()
+        if line and not line.startswith("#"):
+            apdus.append(bytes.fromhex(line))
+    if not apdus:
+        raise ValueError(f"no APDU in {path}")
+    return apdus
+
+
+def recv_exactly(sock: socket.socket, size: int) -> bytes:
+    data = b""
+    while len(data) < size:
+        chunk = sock.recv(size - len(data))
+        if not chunk:
+            raise ConnectionError("connection closed by speculos")
+        data += chunk
+    return data
+
+
+class TcpTransport:
+    def __init__(self, port: int) -> None:
+        self.sock = socket.create_connection(("127.0.0.1", port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    def exchange(self, apdu: bytes) -> bytes:
+        self.sock.sendall(len(apdu).to_bytes(4, "big") + apdu)
+        # The length doesn't include the status word
+        size = int.from_bytes(recv_exactly(self.sock, 4), "big")
+        return recv_exactly(self.sock, size + 2)
+
+    def close(self) -> None:
+        self.sock.close()
+
+
+class HttpTransport:
+    def __init__(self, api_url: str) -> None:
+        self.api_url = api_url
+        self.session = requests.Session()
+
+    def exchange(self, apdu: bytes) -> bytes:
+        with self.session.post(f"{self.api_url}/apdu", json={"data": apdu.hex()}) as response:
+            if response.status_code != 200:
+                raise AssertionError(f"/apdu failed, status code: {response.status_code}")
+            return bytes.fromhex(response.json()["data"])
+
+    def close(self) -> None:
+        self.session.close()
+
+
+class WsTransport:
+    def __init__(self, api_url: str) -> None:
+        self.ws = websocket.connect(f"ws{api_url.removeprefix('http')}/ws")
+        self.ws._sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    def exchange(self, apdu: bytes) -> bytes:
+        self.ws.send(bytes([ChannelMessage.APDU]) + APDU_HEADER.pack(0) + apdu)
+        while True:
+            message = self.ws.recv()
+            if message is None:
+                raise ConnectionError("WebSocket channel closed by speculos")
+            _, payload = message
+            # Skip the text events and screen changes
+            if payload[0] == ChannelMessage.APDU:
+                return payload[1:]
+            if payload[0] == ChannelMessage.ERROR:
+                raise AssertionError(f"APDU failed: {payload[2:].decode()}")
+
+    def close(self) -> None:
+        self.ws.close()
+
+
+def percentile(sorted_values: list[float], p: float) -> float:
+    """Nearest-rank percentile of an already sorted list."""
+
+    index = max(math.ceil(p / 100 * len(sorted_values)) - 1, 0)
+    return sorted_values[index]
+
+
+def run_transport(exchange: Callable[[bytes], bytes], script: list[bytes], iterations: int, warmup: int) -> dict:
+    for apdu in script * warmup:
+        exchange(apdu)
+
+    latencies = []
+    status_words: dict[str, int] = {}
+    start = time.perf_counter()
+    for _ in range(iterations):
+        for apdu in script:
+            t0 = time.perf_counter()
+            response = exchange(apdu)
+            latencies.append(time.perf_counter() - t0)
+            _, sw = split_apdu(response)
+            status_words[f"{sw:04x}"] = status_words.get(f"{sw:04x}", 0) + 1
+    elapsed = time.perf_counter() - start
+
+    latencies.sort()
+    return {
+        "apdus": len(latencies),
+        "seconds": round(elapsed, 4),
+        "apdus_per_sec": round(len(latencies) / elapsed, 1),
+        "latency_ms": {
+            "mean": round(sum(latencies) / len(latencies) * 1000, 3),
+            "p50": round(percentile(latencies, 50) * 1000, 3),
+            "p90": round(percentile(latencies, 90) * 1000, 3),
+            "p99": round(percentile(latencies, 99) * 1000, 3),
+            "max": round(latencies[-1] * 1000, 3),
+        },
+        "status_words": status_words,
+    }
+
+
+def process_tree(pid: int) -> list[int]:
+    """Return pid and the pids of all its descendants (Linux only)."""
+
+    pids = [pid]
+    for task in Path(f"/proc/{pid}/task").glob("*"):
+        try:
+            children = (task / "children").read_text().split()
+        except OSError:
+            continue
+        for child in children:
+            pids += process_tree(int(child))
+    return pids
+
+
+def peak_rss(pid: int) -> dict[str, int]:
+    """Peak resident set size in KiB of each process of the tree, by name."""
+
+    result: dict[str, int] = {}
+    for p in process_tree(pid):
+        try:
+            status = Path(f"/proc/{p}/status").read_text()
+        except OSError:
+            continue
+        fields = dict(line.split(":", 1) for line in status.splitlines() if ":" in line)
+        if "VmHWM" in fields:
+            name = fields["Name"].strip()
+            result[name] = result.get(name, 0) + int(fields["VmHWM"].split()[0])
+    return result
+
+
+def benchmark(args: argparse.Namespace) -> dict:
+    script = load_script(args.script)
+    api_url = f"http://127.0.0.1:{args.api_port}"
+
+    with tempfile.NamedTemporaryFile(mode="r", suffix=".json") as profile:
+        speculos_args = [
+            "--display",
+            "headless",
+            "--api-port",
+            str(args.api_port),
+            "--apdu-port",
+            str(args.apdu_port),
+            "--startup-profile",
+            profile.name,
+            *shlex.split(args.speculos_args),
+        ]
+        instance = SpeculosInstance(args.app, speculos_args)
+
+        start = time.monotonic()
+        instance.start()
+        try:
+            api_ready = time.monotonic() - start
+            first = HttpTransport(api_url)
+            first.exchange(script[0])
+            first.close()
+            first_apdu = time.monotonic() - start
+
+            results = {}
+            for name in args.transports:
+                logging.info(f"benchmarking {name}")
+                if name == "tcp":
+                    transport: TcpTransport | HttpTransport | WsTransport = TcpTransport(args.apdu_port)
+                elif name == "http":
+                    transport = HttpTransport(api_url)
+                else:
+                    transport = WsTransport(api_url)
+                try:
+                    results[name] = run_transport(transport.exchange, script, args.iterations, args.warmup)
+                finally:
+                    transport.close()
+
+            rss = peak_rss(instance.process.pid) if instance.process is not None else {}
+        finally:
+            instance.stop()
+
+        # Milestones measured by speculos itself, relatively to its startup
+        milestones = {}
+        for line in profile.read().splitlines():
+            milestones.update(json.loads(line).get("startup_profile", {}))
+
+    return {
+        "app": args.app,
+        "script_apdus": len(script),
+        "iterations": args.iterations,
+        "startup": {
+            "api_ready_seconds": round(api_ready, 4),
+            "first_apdu_seconds": round(first_apdu, 4),
+            "milestones": milestones,
+        },
+        "peak_rss_kib": rss,
+        "transports": results,
+    }
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Benchmark the APDU throughput and latency of speculos.")
+    parser.add_argument("app", nargs="?", default="apps/boil.elf", help="App to emulate")
+    parser.add_argument("--script", help="File with one hex APDU per line (default: the version APDU of boil.elf)")
+    parser.add_argument("--iterations", type=int, default=200, help="Number of times the script is replayed")
+    parser.add_argument("--warmup", type=int, default=5, help="Number of unmeasured replays of the script")
+    parser.add_argument(
+        "--transports",
+        type=lambda value: value.split(","),
+        default=TRANSPORTS,
+        help=f"Comma-separated transports among {','.join(TRANSPORTS)} (default: all)",
+    )
+    parser.add_argument("--api-port", type=int, default=5000, help="REST API port")
+    parser.add_argument("--apdu-port", type=int, default=9999, help="ApduServer TCP port")
+    parser.add_argument("--output", default="-", help="Output file (default: stdout)")
+    parser.add_argument("--speculos-args", default="", help="Extra speculos arguments, e.g. '--model nanox'")
+    args = parser.parse_args()
+
+    unknown = set(args.transports) - set(TRANSPORTS)
+    if unknown:
+        parser.error(f"unknown transports: {','.join(sorted(unknown))}")
+
+    logging.basicConfig(level=logging.INFO, stream=sys.stderr)
+
+    report = json.dumps(benchmark(args), indent=2)
+    if args.output == "-":
+        print(report)
+    else:
+        Path(args.output).write_text(report + "\n")
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+
+"""
+Build or inspect the BAGL font pack (speculos/fonts/bagl-fonts.bin) loaded by speculos/mcu/bagl_font.py.
+
+The pack is built from a Python module declaring a FONTS list of Font(font_id, bpp, char_height, baseline_height,
+char_kerning, first_char, last_char, characters, bitmap) entries, characters being (char_width, bitmap_byte_count,
+bitmap_offset) tuples: this is the layout of the former speculos/mcu/bagl_font.py.
+
+Layout (little endian), see speculos/mcu/bagl_font.py:
+- header: magic, version, number of fonts
+- one index entry per font, with the offsets of its characters and bitmap
+- characters and bitmaps of every font
+"""
+
+import argparse
+import importlib.util
+import struct
+import sys
+from pathlib import Path
+
+MAGIC = b"BAGLFONT"
+VERSION = 1
+HEADER = struct.Struct("<8sHH")
+FONT_ENTRY = struct.Struct("<HBBBBHHHIII")
+CHARACTER = struct.Struct("<BBH")
+
+
+def load_fonts(path: Path) -> list:
+    spec = importlib.util.spec_from_file_location("bagl_font_source", path)
+    if spec is None or spec.loader is None:
+        raise ValueError(f"can't load {path}")
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module.FONTS
+
+
+def pack(fonts: list) -> bytes:
+    data_offset = HEADER.size + len(fonts) * FONT_ENTRY.size
+    index = [HEADER.pack(MAGIC, VERSION, len(fonts))]
+    data = []
+
+    for font in fonts:
+        characters = b"".join(CHARACTER.pack(*c) for c in font.characters)
+        bitmap = bytes(font.bitmap)
+        characters_offset = data_offset
+        bitmap_offset = characters_offset + len(characters)
+        data_offset = bitmap_offset + len(bitmap)
+        index.append(
+            FONT_ENTRY.pack(
+                font.font_id,
+                font.bpp,
+                font.char_height,
+                font.baseline_height,
+                font.char_kerning,
+                font.first_char,
+                font.last_char,
+                len(font.characters),
+                characters_offset,
+                bitmap_offset,
+                len(bitmap),
+            )
+        )
+        data += [characters, bitmap]
+
+    return b"".join(index + data)
+
+
+def dump(pack_data: bytes) -> None:
+    magic, version, count = HEADER.unpack_from(pack_data)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("not a BAGL font pack, or unsupported version")
+    for i in range(count):
+        entry = FONT_ENTRY.unpack_from(pack_data, HEADER.size + i * FONT_ENTRY.size)
+        font_id, bpp, height, baseline, _, first, last, nb_chars, _, _, bitmap_len = entry
+        print(
+            f"font {font_id:2d}: bpp={bpp} height={height} baseline={baseline} "
+            f"chars=0x{first:02X}-0x{last:02X} ({nb_chars}) bitmap={bitmap_len} bytes"
+        )
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Build or inspect the BAGL font pack.")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+    build_parser = subparsers.add_parser("build", help="build the pack from a Python font module")
+    build_parser.add_argument("source", type=Path, help="Python module declaring FONTS")
+    build_parser.add_argument("output", type=Path, help="font pack to write")
+    dump_parser = subparsers.add_parser("dump", help="list the fonts of a pack")
+    dump_parser.add_argument("pack", type=Path, help="font pack to read")
+    args = parser.parse_args()
+
+    if args.command == "build":
+        args.output.write_bytes(pack(load_fonts(args.source)))
+    else:
+        try:
+            dump(args.pack.read_bytes())
+        except ValueError as e:
+            print(f"Error: {e}", file=sys.stderr)
+            sys.exit(1)
@@ -5,39 +5,53 @@ Record an emulated device screen and save the animation as a gif.
 """
 
 import argparse
-import io
 import logging
+import struct
 import tempfile
+import zlib
 from pathlib import Path
 
 import requests
 from PIL import Image
 
+# Format of /screen/stream, see speculos/api/screen.py
+STREAM_MAGIC = b"SPECSTRM"
+STREAM_HEADER = struct.Struct(">8sHH")
+FRAME_HEADER = struct.Struct(">IdHHHHI")
 
-def take_screenshot(session, api_url):
-    response = session.get(f"{api_url}/screenshot")
-    if response.status_code != 200:
-        raise AssertionError(f"Failed to take screenshot, status code: {response.status_code}")
-    return response.content
+
+def read_exactly(stream, size):
+    data = stream.read(size)
+    if len(data) != size:
+        raise EOFError()
+    return data
 
 
 def record_images(api_url):
+    """Return the list of (image, timestamp) of each frame."""
+
     images = []
 
     logging.info("press CTRL-C to stop recording")
 
     try:
-        with requests.Session() as session:
-            with session.get(f"{api_url}/events?stream=true", stream=True) as stream:
-                while True:
-                    image = take_screenshot(session, api_url)
-                    if len(images) == 0 or image != images[-1]:
-                        images.append(image)
-                    line = stream.raw.readline()
-                    logging.debug(f"got event: {line}")
-                    if not line:
-                        break
-    except KeyboardInterrupt:
+        with requests.get(f"{api_url}/screen/stream", stream=True) as response:
+            if response.status_code != 200:
+                raise AssertionError(f"Failed to stream the screen, status code: {response.status_code}")
+            stream = response.raw
+            magic, width, height = STREAM_HEADER.unpack(read_exactly(stream, STREAM_HEADER.size))
+            if magic != STREAM_MAGIC:
+                raise AssertionError("Invalid screen stream")
+
+            screen = Image.new("RGB", (width, height))
+            while True:
+                seq, timestamp, x, y, w, h, size = FRAME_HEADER.unpack(read_exactly(stream, FRAME_HEADER.size))
+                data = zlib.decompress(read_exactly(stream, size))
+                screen.paste(Image.frombytes("RGB", (w, h), data), (x, y))
+                logging.debug(f"frame {seq}: {w}x{h} at ({x}, {y})")
+                if len(images) == 0 or screen.tobytes() != images[-1][0].tobytes():
+                    images.append((screen.copy(), timestamp))
+    except (KeyboardInterrupt, EOFError):
         pass
 
     return images
@@ -45,8 +59,11 @@ def record_images(api_url):
 
 def save_gif(outfile, images, duration=500):
     logging.info(f"saving images to {outfile}")
-    images = [Image.open(io.BytesIO(image)) for image in images]
-    images[0].save(outfile, save_all=True, append_images=images[1:], duration=duration, loop=0)
+    # Each image lasts until the next one, the last one lasts duration ms
+    timestamps = [timestamp for _, timestamp in images]
+    durations = [max(int((end - start) * 1000), 20) for start, end in zip(timestamps, timestamps[1:], strict=False)] + [duration]
+    frames = [image for image, _ in images]
+    frames[0].save(outfile, save_all=True, append_images=frames[1:], duration=durations, loop=0)
 
 
 if __name__ == "__main__":
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+
+"""
+Benchmark the rendering of the display packets of an app.
+
+The packets are recorded once with `speculos --seph-capture FILE app.elf`,
+then replayed without the app through the drawing functions of the MCU
+(BAGL, NBGL, frame buffer) and each display backend: headless and qt (with
+the offscreen platform by default).
+
+The results are printed as JSON: frames per second, time spent by packet tag,
+peak memory allocated per frame and the cost of a PNG screenshot.
+"""
+
+import argparse
+import json
+import logging
+import os
+import sys
+import time
+import tracemalloc
+from collections import defaultdict
+
+from speculos.mcu.display import Display
+from speculos.mcu.seph_capture import read_capture
+from speculos.mcu.seproxyhal import RENDER_METHOD, DisplayPackets, SephTag
+from speculos.mcu.struct import DisplayArgs, ServerArgs
+
+BACKENDS = ["headless", "qt"]
+
+
+def split_frames(packets: list[tuple[int, bytes]]) -> list[list[tuple[int, bytes]]]:
+    """Split the packets after each status, which is when the app waits for the screen to be updated."""
+
+    frames: list[list[tuple[int, bytes]]] = [[]]
+    for tag, data in packets:
+        if tag == SephTag.GENERAL_STATUS and int.from_bytes(data[:2], "big") != SephTag.GENERAL_STATUS_LAST_COMMAND:
+            continue
+        frames[-1].append((tag, data))
+        if tag == SephTag.GENERAL_STATUS:
+            frames.append([])
+    return [frame for frame in frames if frame]
+
+
+class Backend:
+    def __init__(self, name: str, model: str) -> None:
+        self.name = name
+        display_args = DisplayArgs("MATTE_BLACK", model, False, RENDER_METHOD.FLUSHED, None, 1, None, None)
+        server_args = ServerArgs(None, None, None, None, None, None)
+        self._qapp = None
+
+        if name == "headless":
+            from speculos.mcu.headless import Headless
+
+            self.display: Display = Headless(display_args, server_args)
+        else:
+            from PyQt6.QtWidgets import QApplication
+
+            from speculos.mcu.screen import App, Screen
+
+            self._qapp = QApplication.instance() or QApplication([])
+            screen = Screen(display_args, server_args)
+            screen.set_app(App(self._qapp, display_args, server_args))
+            screen.app.show()
+            self.display = screen
+
+    def end_of_frame(self) -> None:
+        # Let Qt paint the updated rectangle
+        if self._qapp is not None:
+            self._qapp.processEvents()
+
+    def close(self) -> None:
+        if self._qapp is not None:
+            self.display.app.close()
+            self._qapp.processEvents()
+
+
+def replay(backend: Backend, frames: list[list[tuple[int, bytes]]], by_tag: dict[str, float] | None = None) -> None:
+    # Drawn as by SeProxyHal.handle_packet(), without OCR and automation
+    packets = DisplayPackets()
+    for frame in frames:
+        for tag, data in frame:
+            if by_tag is None:
+                packets.replay(backend.display, tag, data)
+            else:
+                start = time.perf_counter()
+                packets.replay(backend.display, tag, data)
+                by_tag[SephTag(tag).name] += time.perf_counter() - start
+        backend.end_of_frame()
+
+
+def benchmark(backend: Backend, frames: list[list[tuple[int, bytes]]], min_time: float) -> dict:
+    # Warm up the caches (fonts, colors...)
+    replay(backend, frames)
+
+    by_tag: dict[str, float] = defaultdict(float)
+    replays = 0
+    start = time.perf_counter()
+    while True:
+        replay(backend, frames, by_tag)
+        replays += 1
+        elapsed = time.perf_counter() - start
+        if elapsed >= min_time:
+            break
+    n = replays * len(frames)
+
+    # Memory allocated while drawing a frame, measured separately as tracing is slow
+    peaks = []
+    packets = DisplayPackets()
+    tracemalloc.start()
+    for frame in frames:
+        tracemalloc.reset_peak()
+        base, _ = tracemalloc.get_traced_memory()
+        for tag, data in frame:
+            packets.replay(backend.display, tag, data)
+        backend.end_of_frame()
+        _, peak = tracemalloc.get_traced_memory()
+        peaks.append(peak - base)
+    tracemalloc.stop()
+
+    # Screenshot of the final screen, as served by the REST API
+    fb = backend.display.m
+    screenshots = 0
+    start = time.perf_counter()
+    while time.perf_counter() - start < min_time / 4 or screenshots == 0:
+        fb._get_image()
+        screenshots += 1
+    get_image_time = (time.perf_counter() - start) / screenshots
+    screenshots = 0
+    start = time.perf_counter()
+    while time.perf_counter() - start < min_time / 4 or screenshots == 0:
+        fb._get_screenshot_iobytes_value()
+        screenshots += 1
+    png_time = (time.perf_counter() - start) / screenshots
+
+    return {
+        "frames": n,
+        "frames_per_sec": round(n / elapsed, 1),
+        "ms_per_frame": round(elapsed * 1000 / n, 3),
+        "ms_per_frame_by_tag": {name: round(t * 1000 / n, 3) for name, t in sorted(by_tag.items())},
+        "peak_alloc_bytes_per_frame": {
+            "mean": round(sum(peaks) / len(peaks)),
+            "max": max(peaks),
+        },
+        "get_image_ms": round(get_image_time * 1000, 3),
+        "png_screenshot_ms": round(png_time * 1000, 3),
+    }
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Benchmark the rendering of captured display packets.")
+    parser.add_argument("captures", nargs="+", help="Files recorded with speculos --seph-capture")
+    parser.add_argument(
+        "--backends",
+        type=lambda value: value.split(","),
+        default=["headless"],
+        help=f"Comma-separated display backends among {','.join(BACKENDS)} (default: headless)",
+    )
+    parser.add_argument("--min-time", type=float, default=2.0, help="Minimum replay time per capture and backend")
+    parser.add_argument("--output", default="-", help="Output file (default: stdout)")
+    args = parser.parse_args()
+
+    unknown = set(args.backends) - set(BACKENDS)
+    if unknown:
+        parser.error(f"unknown backends: {','.join(sorted(unknown))}")
+
+    logging.basicConfig(level=logging.INFO, stream=sys.stderr)
+    os.environ.setdefault("QT_QPA_PLATFORM", "offscreen")
+
+    results = []
+    for path in args.captures:
+        model, packets = read_capture(path)
+        frames = split_frames(packets)
+        if not frames:
+            logging.warning(f"no frame in {path}")
+            continue
+
+        result: dict = {"capture": path, "model": model, "frames": len(frames), "backends": {}}
+        for name in args.backends:
+            logging.info(f"replaying {path} ({model}, {len(frames)} frames) with the {name} display")
+            backend = Backend(name, model)
+            try:
+                result["backends"][name] = benchmark(backend, frames, args.min_time)
+            finally:
+                backend.close()
+        results.append(result)
+
+    report = json.dumps({"captures": results}, indent=2)
+    if args.output == "-":
+        print(report)
+    else:
+        with open(args.output, "w") as fp:
+            fp.write(report + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())